@@ -0,0 +1,176 @@
+#include "ArenaSDF.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+namespace {
+    // Standard Soccar dimensions (unreal units)
+    constexpr float SIDE_WALL_X = 4096.0f;
+    constexpr float BACK_WALL_Y = 5120.0f;
+    constexpr float CEILING_Z = 2044.0f;
+    constexpr float CORNER_PLANE = 8064.0f;        // |x| + |y| of the 45 degree corner walls
+    constexpr float RAMP_RADIUS = 256.0f;          // Floor <-> wall transition
+    constexpr float CEILING_RAMP_RADIUS = 256.0f;  // Ceiling <-> wall transition
+    constexpr float GOAL_HALF_WIDTH = 893.0f;
+    constexpr float GOAL_HEIGHT = 642.775f;
+    constexpr float GOAL_DEPTH = 880.0f;
+
+    constexpr float INV_SQRT2 = 0.70710678f;
+    constexpr float DISTANCE_SCALE = 1.0f / 8.0f;  // 1/8 uu resolution, +-4095 uu range
+    constexpr size_t MAX_CELLS = 16u * 1024u * 1024u;
+
+    // Intersection of two half-spaces (a, b > 0 inside) with the concave edge
+    // replaced by a fillet of radius r.
+    float RoundedIntersect(float a, float b, float r) {
+        if (a < r && b < r) {
+            float da = r - a;
+            float db = r - b;
+            return r - std::sqrt(da * da + db * db);
+        }
+        return (std::min)(a, b);
+    }
+
+    int8_t QuantizeNormal(float v) {
+        return static_cast<int8_t>(std::lround(MathUtils::Clamp(v, -1.0f, 1.0f) * 127.0f));
+    }
+}
+
+float ArenaSDF::SoccarDistance(const Vec3& worldPos) {
+    const float x = std::fabs(worldPos.X);
+    const float y = std::fabs(worldPos.Y);
+    const float z = worldPos.Z;
+
+    float side = SIDE_WALL_X - x;
+    float back = BACK_WALL_Y - y;
+    float corner = (CORNER_PLANE - x - y) * INV_SQRT2;
+    float wall = (std::min)({ side, back, corner });
+
+    float lower = RoundedIntersect(z, wall, RAMP_RADIUS);
+    float upper = RoundedIntersect(CEILING_Z - z, wall, CEILING_RAMP_RADIUS);
+    float field = (std::min)(lower, upper);
+
+    // Goal box is a plain rectangular pocket behind the back wall
+    float goal = (std::min)({ GOAL_HALF_WIDTH - x, GOAL_HEIGHT - z, z, BACK_WALL_Y + GOAL_DEPTH - y });
+
+    return (std::max)(field, goal);
+}
+
+void ArenaSDF::BuildSoccar(float cellSize) {
+    if (cellSize <= 1.0f) cellSize = 64.0f;
+
+    const float margin = cellSize * 2.0f;
+    header_ = FileHeader{};
+    header_.OriginX = 0.0f;
+    header_.OriginY = 0.0f;
+    header_.OriginZ = -margin;
+    header_.CellSize = cellSize;
+    header_.DistanceScale = DISTANCE_SCALE;
+    header_.Flags = Flag_MirrorXY;
+    header_.DimX = static_cast<uint32_t>(std::ceil((SIDE_WALL_X + margin) / cellSize)) + 1;
+    header_.DimY = static_cast<uint32_t>(std::ceil((BACK_WALL_Y + GOAL_DEPTH + margin) / cellSize)) + 1;
+    header_.DimZ = static_cast<uint32_t>(std::ceil((CEILING_Z + margin * 2.0f) / cellSize)) + 1;
+
+    cells_.assign(static_cast<size_t>(header_.DimX) * header_.DimY * header_.DimZ, Cell{});
+
+    const float h = 1.0f; // Central difference step for the normals
+    const float maxQuantized = 32767.0f * DISTANCE_SCALE;
+
+    for (uint32_t iz = 0; iz < header_.DimZ; ++iz) {
+        for (uint32_t iy = 0; iy < header_.DimY; ++iy) {
+            for (uint32_t ix = 0; ix < header_.DimX; ++ix) {
+                Vec3 p(header_.OriginX + ix * cellSize, header_.OriginY + iy * cellSize, header_.OriginZ + iz * cellSize);
+
+                float d = SoccarDistance(p);
+                Vec3 grad(
+                    SoccarDistance({ p.X + h, p.Y, p.Z }) - SoccarDistance({ p.X - h, p.Y, p.Z }),
+                    SoccarDistance({ p.X, p.Y + h, p.Z }) - SoccarDistance({ p.X, p.Y - h, p.Z }),
+                    SoccarDistance({ p.X, p.Y, p.Z + h }) - SoccarDistance({ p.X, p.Y, p.Z - h }));
+                Vec3 n = MathUtils::Normalize(grad);
+
+                Cell& c = cells_[(static_cast<size_t>(iz) * header_.DimY + iy) * header_.DimX + ix];
+                c.Distance = static_cast<int16_t>(std::lround(MathUtils::Clamp(d, -maxQuantized, maxQuantized) / DISTANCE_SCALE));
+                c.Normal[0] = QuantizeNormal(n.X);
+                c.Normal[1] = QuantizeNormal(n.Y);
+                c.Normal[2] = QuantizeNormal(n.Z);
+            }
+        }
+    }
+}
+
+bool ArenaSDF::LoadFromFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) return false;
+
+    FileHeader header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (header.Magic != FileMagic || header.Version != FileVersion) return false;
+    if (header.DimX < 2 || header.DimY < 2 || header.DimZ < 2) return false;
+    if (header.CellSize <= 0.0f || header.DistanceScale <= 0.0f) return false;
+
+    size_t count = static_cast<size_t>(header.DimX) * header.DimY * header.DimZ;
+    if (count > MAX_CELLS) return false;
+
+    std::vector<Cell> cells(count);
+    if (!file.read(reinterpret_cast<char*>(cells.data()), static_cast<std::streamsize>(count * sizeof(Cell)))) return false;
+
+    header_ = header;
+    cells_ = std::move(cells);
+    return true;
+}
+
+bool ArenaSDF::SaveToFile(const std::string& path) const {
+    if (!IsLoaded()) return false;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    file.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+    file.write(reinterpret_cast<const char*>(cells_.data()), static_cast<std::streamsize>(cells_.size() * sizeof(Cell)));
+    return static_cast<bool>(file);
+}
+
+bool ArenaSDF::Sample(const Vec3& worldPos, float& outDistance, Vec3& outNormal) const {
+    if (cells_.empty()) return false;
+
+    const bool mirror = (header_.Flags & Flag_MirrorXY) != 0;
+    const float qx = mirror ? std::fabs(worldPos.X) : worldPos.X;
+    const float qy = mirror ? std::fabs(worldPos.Y) : worldPos.Y;
+
+    const float invCell = 1.0f / header_.CellSize;
+    const float gx = (qx - header_.OriginX) * invCell;
+    const float gy = (qy - header_.OriginY) * invCell;
+    const float gz = (worldPos.Z - header_.OriginZ) * invCell;
+
+    if (gx < 0.0f || gy < 0.0f || gz < 0.0f) return false;
+    if (gx > header_.DimX - 1 || gy > header_.DimY - 1 || gz > header_.DimZ - 1) return false;
+
+    const uint32_t ix = (std::min)(static_cast<uint32_t>(gx), header_.DimX - 2);
+    const uint32_t iy = (std::min)(static_cast<uint32_t>(gy), header_.DimY - 2);
+    const uint32_t iz = (std::min)(static_cast<uint32_t>(gz), header_.DimZ - 2);
+    const float fx = gx - ix;
+    const float fy = gy - iy;
+    const float fz = gz - iz;
+
+    float d = 0.0f;
+    float n[3] = { 0.0f, 0.0f, 0.0f };
+    for (int corner = 0; corner < 8; ++corner) {
+        const uint32_t ox = corner & 1;
+        const uint32_t oy = (corner >> 1) & 1;
+        const uint32_t oz = (corner >> 2) & 1;
+        const float w = (ox ? fx : 1.0f - fx) * (oy ? fy : 1.0f - fy) * (oz ? fz : 1.0f - fz);
+
+        const Cell& c = CellAt(ix + ox, iy + oy, iz + oz);
+        d += w * c.Distance;
+        n[0] += w * c.Normal[0];
+        n[1] += w * c.Normal[1];
+        n[2] += w * c.Normal[2];
+    }
+
+    outDistance = d * header_.DistanceScale;
+    outNormal = MathUtils::Normalize({ n[0], n[1], n[2] });
+    if (mirror) {
+        if (worldPos.X < 0.0f) outNormal.X = -outNormal.X;
+        if (worldPos.Y < 0.0f) outNormal.Y = -outNormal.Y;
+    }
+    return true;
+}
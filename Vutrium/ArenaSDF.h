@@ -0,0 +1,67 @@
+#ifndef ARENA_SDF_H
+#define ARENA_SDF_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "MathUtils.h"
+
+// Quantized signed-distance field of the standard Soccar arena.
+// Distances are positive inside the playable volume and negative inside geometry.
+// Only the +X/+Y quadrant is stored; the arena is mirror-symmetric on both axes.
+class ArenaSDF {
+public:
+    static constexpr uint32_t FileMagic = 0x46445356; // "VSDF"
+    static constexpr uint32_t FileVersion = 1;
+    static constexpr uint32_t Flag_MirrorXY = 1u << 0;
+
+#pragma pack(push, 1)
+    struct FileHeader {
+        uint32_t Magic = FileMagic;
+        uint32_t Version = FileVersion;
+        uint32_t DimX = 0, DimY = 0, DimZ = 0;
+        float OriginX = 0.0f, OriginY = 0.0f, OriginZ = 0.0f;
+        float CellSize = 0.0f;       // World units between samples
+        float DistanceScale = 0.0f;  // World units per quantized distance step
+        uint32_t Flags = 0;
+    }; // Size: 0x2C
+
+    struct Cell {
+        int16_t Distance = 0;        // Distance / DistanceScale
+        int8_t Normal[3] = { 0, 0, 0 }; // Unit normal * 127
+        uint8_t Reserved = 0;
+    }; // Size: 0x06
+#pragma pack(pop)
+    static_assert(sizeof(FileHeader) == 0x2C, "FileHeader is the on-disk .vsdf header");
+    static_assert(sizeof(Cell) == 0x06, "Cell is the on-disk .vsdf sample");
+
+    ArenaSDF() = default;
+
+    bool LoadFromFile(const std::string& path);
+    bool SaveToFile(const std::string& path) const;
+
+    // Bakes the grid from the analytic arena description below (floor/ceiling/walls,
+    // 45 degree corners, rounded ramps and the goal boxes).
+    void BuildSoccar(float cellSize = 64.0f);
+
+    bool IsLoaded() const { return !cells_.empty(); }
+    const FileHeader& GetHeader() const { return header_; }
+    size_t GetCellCount() const { return cells_.size(); }
+    const Cell* GetCells() const { return cells_.data(); }
+
+    // One trilinear lookup. Returns false if the point is outside the baked volume.
+    bool Sample(const Vec3& worldPos, float& outDistance, Vec3& outNormal) const;
+
+    // Exact analytic distance used for baking (and as a reference when debugging the grid).
+    static float SoccarDistance(const Vec3& worldPos);
+
+private:
+    const Cell& CellAt(uint32_t x, uint32_t y, uint32_t z) const {
+        return cells_[(static_cast<size_t>(z) * header_.DimY + y) * header_.DimX + x];
+    }
+
+    FileHeader header_;
+    std::vector<Cell> cells_;
+};
+
+#endif // ARENA_SDF_H
@@ -0,0 +1,451 @@
+#include "BallPredictor.h"
+#include "ArenaSDF.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define VUTRIUM_HAS_AVX2 1
+#define VUTRIUM_AVX2_TARGET
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define VUTRIUM_HAS_AVX2 1
+#define VUTRIUM_AVX2_TARGET __attribute__((target("avx2,fma")))
+#else
+#define VUTRIUM_HAS_AVX2 0
+#endif
+
+namespace {
+    constexpr float FLOOR_Z_PHYSICAL = 0.0f;
+    constexpr float CEILING_Z_PHYSICAL = 2044.0f;
+    constexpr float WALL_X_LIMIT_PHYSICAL = 4096.0f;
+    constexpr float WALL_Y_LIMIT_PHYSICAL = 5120.0f;
+
+    constexpr float GOAL_HEIGHT_PHYSICAL = 642.775f;
+    constexpr float GOAL_WIDTH_PHYSICAL = 1786.0f;
+    constexpr float GOAL_DEPTH_PHYSICAL = 880.0f;
+
+    constexpr float FLOOR_NORMAL_MIN_Z = 0.7f;      // Anything flatter than ~45 degrees counts as floor/ceiling
+    constexpr float FLOOR_SPIN_RETAIN = 0.3f;
+
+    void ClampBallVelocity(Vec3& vel, float maxSpeed) {
+        float speedSq = MathUtils::LengthSquared(vel);
+        if (speedSq > maxSpeed * maxSpeed) {
+            vel *= maxSpeed / std::sqrt(speedSq);
+        }
+    }
+}
+
+BallPredictor::BallPredictor(const ArenaSDF* arena)
+    : arena_(arena), spinDampPerStep_(std::pow(SpinDamping, TimeStep)) {}
+
+bool BallPredictor::IsUsingSDF() const {
+    return arena_ != nullptr && arena_->IsLoaded();
+}
+
+bool BallPredictor::IsInGoal(const Vec3& location) {
+    return std::abs(location.Y) > WALL_Y_LIMIT_PHYSICAL &&
+        std::abs(location.X) < (GOAL_WIDTH_PHYSICAL / 2.0f - BallRadius) &&
+        location.Z < (GOAL_HEIGHT_PHYSICAL - BallRadius);
+}
+
+BallPredictor::ContactType BallPredictor::Step(BallState& state) const {
+    state.AngularVelocity *= spinDampPerStep_;
+
+    state.Velocity.Z += Gravity * TimeStep;
+    ClampBallVelocity(state.Velocity, MaxBallSpeed);
+
+    state.Location += state.Velocity * TimeStep;
+
+    return IsUsingSDF() ? ResolveSDF(state) : ResolvePlanes(state);
+}
+
+void BallPredictor::Predict(const BallState& initial, std::vector<Slice>& out, int steps) const {
+    out.clear();
+    if (steps <= 0) return;
+    out.reserve(static_cast<size_t>(steps));
+
+    BallState state = initial;
+    for (int step = 1; step <= steps; ++step) {
+        Slice slice;
+        slice.Contact = Step(state);
+        slice.State = state;
+        slice.Step = step;
+        slice.InGoal = IsInGoal(state.Location);
+        out.push_back(slice);
+    }
+}
+
+BallPredictor::ContactType BallPredictor::ResolveSDF(BallState& state) const {
+    float distance = 0.0f;
+    Vec3 normal;
+    if (!arena_->Sample(state.Location, distance, normal)) {
+        // Left the baked volume (only happens with garbage input); keep the ball in the box
+        return ResolvePlanes(state);
+    }
+    if (distance >= BallRadius) return ContactType::None;
+
+    state.Location += normal * (BallRadius - distance);
+
+    float normalSpeed = MathUtils::Dot(state.Velocity, normal);
+    if (normalSpeed < 0.0f) {
+        Vec3 normalVel = normal * normalSpeed;
+        Vec3 tangentVel = state.Velocity - normalVel;
+        state.Velocity = tangentVel * GroundFriction - normalVel * Restitution;
+    }
+
+    if (normal.Z > FLOOR_NORMAL_MIN_Z) {
+        state.AngularVelocity.X *= FLOOR_SPIN_RETAIN;
+        state.AngularVelocity.Y *= FLOOR_SPIN_RETAIN;
+        return ContactType::Floor;
+    }
+    if (normal.Z < -FLOOR_NORMAL_MIN_Z) return ContactType::Ceiling;
+    return ContactType::Wall;
+}
+
+BallPredictor::ContactType BallPredictor::ResolvePlanes(BallState& state) const {
+    const float FLOOR_Z_EFFECTIVE = FLOOR_Z_PHYSICAL + BallRadius;
+    const float CEILING_Z_EFFECTIVE = CEILING_Z_PHYSICAL - BallRadius;
+    const float WALL_X_EFFECTIVE = WALL_X_LIMIT_PHYSICAL - BallRadius;
+    const float WALL_Y_EFFECTIVE = WALL_Y_LIMIT_PHYSICAL - BallRadius;
+
+    Vec3& pos = state.Location;
+    Vec3& vel = state.Velocity;
+    ContactType contact = ContactType::None;
+
+    if (pos.Z <= FLOOR_Z_EFFECTIVE) {
+        pos.Z = FLOOR_Z_EFFECTIVE;
+        vel.Z *= -Restitution;
+        vel.X *= GroundFriction;
+        vel.Y *= GroundFriction;
+
+        state.AngularVelocity.X *= FLOOR_SPIN_RETAIN;
+        state.AngularVelocity.Y *= FLOOR_SPIN_RETAIN;
+        contact = ContactType::Floor;
+    }
+    else if (pos.Z >= CEILING_Z_EFFECTIVE) {
+        pos.Z = CEILING_Z_EFFECTIVE;
+        vel.Z *= -Restitution;
+        contact = ContactType::Ceiling;
+    }
+
+    if (std::abs(pos.X) >= WALL_X_EFFECTIVE) {
+        pos.X = (pos.X > 0 ? 1.f : -1.f) * WALL_X_EFFECTIVE;
+        vel.X *= -Restitution;
+        contact = ContactType::Wall;
+    }
+    if (std::abs(pos.Y) >= WALL_Y_EFFECTIVE) {
+        bool inGoalAreaX = std::abs(pos.X) < (GOAL_WIDTH_PHYSICAL / 2.0f - BallRadius);
+        bool inGoalAreaZ = pos.Z < (GOAL_HEIGHT_PHYSICAL - BallRadius);
+
+        if (inGoalAreaX && inGoalAreaZ) {
+            float goalBackPlaneY = (pos.Y > 0) ?
+                (WALL_Y_LIMIT_PHYSICAL + GOAL_DEPTH_PHYSICAL - BallRadius) :
+                -(WALL_Y_LIMIT_PHYSICAL + GOAL_DEPTH_PHYSICAL - BallRadius);
+
+            if ((pos.Y > 0 && pos.Y >= goalBackPlaneY && vel.Y > 0) ||
+                (pos.Y < 0 && pos.Y <= goalBackPlaneY && vel.Y < 0)) {
+                pos.Y = goalBackPlaneY;
+                vel.Y *= -Restitution;
+                contact = ContactType::Wall;
+            }
+        }
+        else {
+            pos.Y = (pos.Y > 0 ? 1.f : -1.f) * WALL_Y_EFFECTIVE;
+            vel.Y *= -Restitution;
+            contact = ContactType::Wall;
+        }
+    }
+
+    return contact;
+}
+
+Vec3 BallPredictor::BatchResult::GetLocation(int trajectory, int stepIndex) const {
+    size_t i = Index(trajectory, stepIndex);
+    return { LocationX[i], LocationY[i], LocationZ[i] };
+}
+
+Vec3 BallPredictor::BatchResult::GetVelocity(int trajectory, int stepIndex) const {
+    size_t i = Index(trajectory, stepIndex);
+    return { VelocityX[i], VelocityY[i], VelocityZ[i] };
+}
+
+BallPredictor::ContactType BallPredictor::BatchResult::GetContact(int trajectory, int stepIndex) const {
+    return static_cast<ContactType>(Contacts[Index(trajectory, stepIndex)]);
+}
+
+bool BallPredictor::IsSimdAvailable() {
+#if VUTRIUM_HAS_AVX2 && defined(_MSC_VER)
+    static const bool available = [] {
+        int info[4] = { 0 };
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+        __cpuid(info, 1);
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        bool fma = (info[2] & (1 << 12)) != 0;
+        __cpuidex(info, 7, 0);
+        bool avx2 = (info[1] & (1 << 5)) != 0;
+        if (!(osxsave && avx && fma && avx2)) return false;
+        return (_xgetbv(0) & 0x6) == 0x6; // OS saves XMM and YMM state
+    }();
+    return available;
+#elif VUTRIUM_HAS_AVX2
+    static const bool available = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    return available;
+#else
+    return false;
+#endif
+}
+
+void BallPredictor::PredictBatch(const std::vector<BallState>& initial, int steps, BatchResult& out, bool allowSimd) const {
+    int count = static_cast<int>((std::min)(initial.size(), static_cast<size_t>(MaxBatchCount)));
+    steps = (std::max)(0, (std::min)(steps, MaxBatchSteps));
+
+    out.Count = count;
+    out.Steps = steps;
+    out.Stride = ((count + BatchLaneWidth - 1) / BatchLaneWidth) * BatchLaneWidth;
+
+    const size_t cells = static_cast<size_t>(out.Stride) * steps;
+    out.LocationX.resize(cells);
+    out.LocationY.resize(cells);
+    out.LocationZ.resize(cells);
+    out.VelocityX.resize(cells);
+    out.VelocityY.resize(cells);
+    out.VelocityZ.resize(cells);
+    out.Contacts.resize(cells);
+
+    if (count == 0 || steps == 0) return;
+
+    if (allowSimd && IsUsingSDF() && IsSimdAvailable()) {
+        PredictBatchAVX2(initial, out);
+    }
+    else {
+        PredictBatchScalar(initial, out);
+    }
+}
+
+void BallPredictor::PredictBatchScalar(const std::vector<BallState>& initial, BatchResult& out) const {
+    for (int lane = 0; lane < out.Count; ++lane) {
+        BallState state = initial[lane];
+        for (int s = 0; s < out.Steps; ++s) {
+            ContactType contact = Step(state);
+            size_t i = out.Index(lane, s);
+            out.LocationX[i] = state.Location.X;
+            out.LocationY[i] = state.Location.Y;
+            out.LocationZ[i] = state.Location.Z;
+            out.VelocityX[i] = state.Velocity.X;
+            out.VelocityY[i] = state.Velocity.Y;
+            out.VelocityZ[i] = state.Velocity.Z;
+            out.Contacts[i] = static_cast<uint8_t>(contact);
+        }
+    }
+}
+
+#if VUTRIUM_HAS_AVX2
+// Same integration and SDF response as Step()/ResolveSDF(), eight balls per iteration.
+// Lanes that leave the baked volume are clamped to its boundary instead of falling back to
+// the plane collisions; that only matters for nonsense input.
+VUTRIUM_AVX2_TARGET
+void BallPredictor::PredictBatchAVX2(const std::vector<BallState>& initial, BatchResult& out) const {
+    const ArenaSDF::FileHeader& h = arena_->GetHeader();
+    const int* cellBase = reinterpret_cast<const int*>(arena_->GetCells());
+
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 dt = _mm256_set1_ps(TimeStep);
+    const __m256 gravityStep = _mm256_set1_ps(Gravity * TimeStep);
+    const __m256 spinDamp = _mm256_set1_ps(spinDampPerStep_);
+    const __m256 maxSpeed = _mm256_set1_ps(MaxBallSpeed);
+    const __m256 maxSpeedSq = _mm256_set1_ps(MaxBallSpeed * MaxBallSpeed);
+    const __m256 radius = _mm256_set1_ps(BallRadius);
+    const __m256 restitution = _mm256_set1_ps(Restitution);
+    const __m256 friction = _mm256_set1_ps(GroundFriction);
+    const __m256 floorSpin = _mm256_set1_ps(0.3f);
+    const __m256 floorNormalZ = _mm256_set1_ps(0.7f);
+    const __m256 ceilingNormalZ = _mm256_set1_ps(-0.7f);
+    const __m256 tinyLength = _mm256_set1_ps(1e-6f);
+
+    const __m256 originX = _mm256_set1_ps(h.OriginX);
+    const __m256 originY = _mm256_set1_ps(h.OriginY);
+    const __m256 originZ = _mm256_set1_ps(h.OriginZ);
+    const __m256 invCell = _mm256_set1_ps(1.0f / h.CellSize);
+    const __m256 distScale = _mm256_set1_ps(h.DistanceScale);
+    const __m256 maxGX = _mm256_set1_ps(static_cast<float>(h.DimX - 1));
+    const __m256 maxGY = _mm256_set1_ps(static_cast<float>(h.DimY - 1));
+    const __m256 maxGZ = _mm256_set1_ps(static_cast<float>(h.DimZ - 1));
+    const __m256 maxIX = _mm256_set1_ps(static_cast<float>(h.DimX - 2));
+    const __m256 maxIY = _mm256_set1_ps(static_cast<float>(h.DimY - 2));
+    const __m256 maxIZ = _mm256_set1_ps(static_cast<float>(h.DimZ - 2));
+
+    const int cellSize = static_cast<int>(sizeof(ArenaSDF::Cell));
+    const int strideY = static_cast<int>(h.DimX) * cellSize;
+    const int strideZ = static_cast<int>(h.DimX * h.DimY) * cellSize;
+    const __m256i vCellSize = _mm256_set1_epi32(cellSize);
+    const __m256i vStrideY = _mm256_set1_epi32(strideY);
+    const __m256i vStrideZ = _mm256_set1_epi32(strideZ);
+    int cornerOffsets[8];
+    for (int c = 0; c < 8; ++c) {
+        cornerOffsets[c] = ((c & 1) ? cellSize : 0) + ((c & 2) ? strideY : 0) + ((c & 4) ? strideZ : 0);
+    }
+
+    alignas(32) float lanes[9][BatchLaneWidth];
+    alignas(32) int32_t contactLanes[BatchLaneWidth];
+
+    for (int lane0 = 0; lane0 < out.Stride; lane0 += BatchLaneWidth) {
+        for (int l = 0; l < BatchLaneWidth; ++l) {
+            // Padding lanes replay the first state so they stay finite
+            const BallState& st = initial[(lane0 + l < out.Count) ? lane0 + l : 0];
+            lanes[0][l] = st.Location.X; lanes[1][l] = st.Location.Y; lanes[2][l] = st.Location.Z;
+            lanes[3][l] = st.Velocity.X; lanes[4][l] = st.Velocity.Y; lanes[5][l] = st.Velocity.Z;
+            lanes[6][l] = st.AngularVelocity.X; lanes[7][l] = st.AngularVelocity.Y; lanes[8][l] = st.AngularVelocity.Z;
+        }
+        __m256 px = _mm256_load_ps(lanes[0]), py = _mm256_load_ps(lanes[1]), pz = _mm256_load_ps(lanes[2]);
+        __m256 vx = _mm256_load_ps(lanes[3]), vy = _mm256_load_ps(lanes[4]), vz = _mm256_load_ps(lanes[5]);
+        __m256 wx = _mm256_load_ps(lanes[6]), wy = _mm256_load_ps(lanes[7]), wz = _mm256_load_ps(lanes[8]);
+
+        for (int s = 0; s < out.Steps; ++s) {
+            wx = _mm256_mul_ps(wx, spinDamp);
+            wy = _mm256_mul_ps(wy, spinDamp);
+            wz = _mm256_mul_ps(wz, spinDamp);
+
+            vz = _mm256_add_ps(vz, gravityStep);
+            __m256 speedSq = _mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vz, vz)));
+            __m256 overSpeed = _mm256_cmp_ps(speedSq, maxSpeedSq, _CMP_GT_OQ);
+            __m256 speedScale = _mm256_blendv_ps(one, _mm256_div_ps(maxSpeed, _mm256_sqrt_ps(speedSq)), overSpeed);
+            vx = _mm256_mul_ps(vx, speedScale);
+            vy = _mm256_mul_ps(vy, speedScale);
+            vz = _mm256_mul_ps(vz, speedScale);
+
+            px = _mm256_fmadd_ps(vx, dt, px);
+            py = _mm256_fmadd_ps(vy, dt, py);
+            pz = _mm256_fmadd_ps(vz, dt, pz);
+
+            // --- SDF lookup (mirrored quadrant, trilinear) ---
+            __m256 gx = _mm256_mul_ps(_mm256_sub_ps(_mm256_andnot_ps(signMask, px), originX), invCell);
+            __m256 gy = _mm256_mul_ps(_mm256_sub_ps(_mm256_andnot_ps(signMask, py), originY), invCell);
+            __m256 gz = _mm256_mul_ps(_mm256_sub_ps(pz, originZ), invCell);
+            gx = _mm256_min_ps(_mm256_max_ps(gx, zero), maxGX);
+            gy = _mm256_min_ps(_mm256_max_ps(gy, zero), maxGY);
+            gz = _mm256_min_ps(_mm256_max_ps(gz, zero), maxGZ);
+
+            __m256 cx = _mm256_min_ps(_mm256_floor_ps(gx), maxIX);
+            __m256 cy = _mm256_min_ps(_mm256_floor_ps(gy), maxIY);
+            __m256 cz = _mm256_min_ps(_mm256_floor_ps(gz), maxIZ);
+            __m256 fx = _mm256_sub_ps(gx, cx);
+            __m256 fy = _mm256_sub_ps(gy, cy);
+            __m256 fz = _mm256_sub_ps(gz, cz);
+
+            __m256i base = _mm256_add_epi32(
+                _mm256_mullo_epi32(_mm256_cvttps_epi32(cx), vCellSize),
+                _mm256_add_epi32(_mm256_mullo_epi32(_mm256_cvttps_epi32(cy), vStrideY),
+                    _mm256_mullo_epi32(_mm256_cvttps_epi32(cz), vStrideZ)));
+
+            __m256 dist = zero, nx = zero, ny = zero, nz = zero;
+            for (int c = 0; c < 8; ++c) {
+                __m256 w = _mm256_mul_ps(
+                    (c & 1) ? fx : _mm256_sub_ps(one, fx),
+                    _mm256_mul_ps((c & 2) ? fy : _mm256_sub_ps(one, fy), (c & 4) ? fz : _mm256_sub_ps(one, fz)));
+
+                __m256i offset = _mm256_add_epi32(base, _mm256_set1_epi32(cornerOffsets[c]));
+                // Cell = { int16 Distance, int8 Normal[3], pad }: bytes 0-3 and 2-5
+                __m256i lo = _mm256_i32gather_epi32(cellBase, offset, 1);
+                __m256i hi = _mm256_i32gather_epi32(cellBase, _mm256_add_epi32(offset, _mm256_set1_epi32(2)), 1);
+
+                dist = _mm256_fmadd_ps(w, _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(lo, 16), 16)), dist);
+                nx = _mm256_fmadd_ps(w, _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(hi, 24), 24)), nx);
+                ny = _mm256_fmadd_ps(w, _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(hi, 16), 24)), ny);
+                nz = _mm256_fmadd_ps(w, _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(hi, 8), 24)), nz);
+            }
+            dist = _mm256_mul_ps(dist, distScale);
+
+            __m256 len = _mm256_sqrt_ps(_mm256_fmadd_ps(nx, nx, _mm256_fmadd_ps(ny, ny, _mm256_mul_ps(nz, nz))));
+            __m256 degenerate = _mm256_cmp_ps(len, tinyLength, _CMP_LT_OQ);
+            __m256 invLen = _mm256_div_ps(one, _mm256_max_ps(len, tinyLength));
+            nx = _mm256_blendv_ps(_mm256_mul_ps(nx, invLen), zero, degenerate);
+            ny = _mm256_blendv_ps(_mm256_mul_ps(ny, invLen), zero, degenerate);
+            nz = _mm256_blendv_ps(_mm256_mul_ps(nz, invLen), one, degenerate);
+            nx = _mm256_xor_ps(nx, _mm256_and_ps(px, signMask));
+            ny = _mm256_xor_ps(ny, _mm256_and_ps(py, signMask));
+
+            // --- Contact response ---
+            __m256 contact = _mm256_cmp_ps(dist, radius, _CMP_LT_OQ);
+            __m256 push = _mm256_and_ps(contact, _mm256_sub_ps(radius, dist));
+            px = _mm256_fmadd_ps(nx, push, px);
+            py = _mm256_fmadd_ps(ny, push, py);
+            pz = _mm256_fmadd_ps(nz, push, pz);
+
+            __m256 normalSpeed = _mm256_fmadd_ps(vx, nx, _mm256_fmadd_ps(vy, ny, _mm256_mul_ps(vz, nz)));
+            __m256 reflect = _mm256_and_ps(contact, _mm256_cmp_ps(normalSpeed, zero, _CMP_LT_OQ));
+            __m256 nvx = _mm256_mul_ps(nx, normalSpeed);
+            __m256 nvy = _mm256_mul_ps(ny, normalSpeed);
+            __m256 nvz = _mm256_mul_ps(nz, normalSpeed);
+            vx = _mm256_blendv_ps(vx, _mm256_fnmadd_ps(nvx, restitution, _mm256_mul_ps(_mm256_sub_ps(vx, nvx), friction)), reflect);
+            vy = _mm256_blendv_ps(vy, _mm256_fnmadd_ps(nvy, restitution, _mm256_mul_ps(_mm256_sub_ps(vy, nvy), friction)), reflect);
+            vz = _mm256_blendv_ps(vz, _mm256_fnmadd_ps(nvz, restitution, _mm256_mul_ps(_mm256_sub_ps(vz, nvz), friction)), reflect);
+
+            __m256 floorContact = _mm256_and_ps(contact, _mm256_cmp_ps(nz, floorNormalZ, _CMP_GT_OQ));
+            __m256 ceilingContact = _mm256_and_ps(contact, _mm256_cmp_ps(nz, ceilingNormalZ, _CMP_LT_OQ));
+            wx = _mm256_blendv_ps(wx, _mm256_mul_ps(wx, floorSpin), floorContact);
+            wy = _mm256_blendv_ps(wy, _mm256_mul_ps(wy, floorSpin), floorContact);
+
+            __m256i contactType = _mm256_and_si256(_mm256_castps_si256(contact), _mm256_set1_epi32(static_cast<int>(ContactType::Wall)));
+            contactType = _mm256_blendv_epi8(contactType, _mm256_set1_epi32(static_cast<int>(ContactType::Floor)), _mm256_castps_si256(floorContact));
+            contactType = _mm256_blendv_epi8(contactType, _mm256_set1_epi32(static_cast<int>(ContactType::Ceiling)), _mm256_castps_si256(ceilingContact));
+
+            const size_t row = static_cast<size_t>(s) * out.Stride + lane0;
+            _mm256_storeu_ps(&out.LocationX[row], px);
+            _mm256_storeu_ps(&out.LocationY[row], py);
+            _mm256_storeu_ps(&out.LocationZ[row], pz);
+            _mm256_storeu_ps(&out.VelocityX[row], vx);
+            _mm256_storeu_ps(&out.VelocityY[row], vy);
+            _mm256_storeu_ps(&out.VelocityZ[row], vz);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(contactLanes), contactType);
+            for (int l = 0; l < BatchLaneWidth; ++l) {
+                out.Contacts[row + l] = static_cast<uint8_t>(contactLanes[l]);
+            }
+        }
+    }
+}
+#else
+void BallPredictor::PredictBatchAVX2(const std::vector<BallState>& initial, BatchResult& out) const {
+    PredictBatchScalar(initial, out);
+}
+#endif
+
+BallPredictor::BatchBenchmark BallPredictor::BenchmarkBatch(int count, int steps, int iterations) const {
+    BatchBenchmark result;
+    result.Count = (std::max)(1, (std::min)(count, MaxBatchCount));
+    result.Steps = (std::max)(1, (std::min)(steps, MaxBatchSteps));
+    result.SimdAvailable = IsUsingSDF() && IsSimdAvailable();
+    iterations = (std::max)(1, iterations);
+
+    // Kickoff-ish ball hit with a fan of impulses, so trajectories touch floor, walls and corners
+    std::vector<BallState> states(static_cast<size_t>(result.Count));
+    for (int i = 0; i < result.Count; ++i) {
+        float angle = 6.2831853f * static_cast<float>(i) / static_cast<float>(result.Count);
+        float speed = 1500.0f + 2500.0f * static_cast<float>(i % 4) / 3.0f;
+        states[i].Location = { 0.0f, 0.0f, 93.15f };
+        states[i].Velocity = { std::cos(angle) * speed, std::sin(angle) * speed, 400.0f + 150.0f * static_cast<float>(i % 5) };
+        states[i].AngularVelocity = { 0.0f, 0.0f, 0.0f };
+    }
+
+    BatchResult scratch;
+    auto timeRun = [&](bool simd) {
+        PredictBatch(states, result.Steps, scratch, simd); // Warm-up, sizes the buffers
+        auto start = std::chrono::steady_clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            PredictBatch(states, result.Steps, scratch, simd);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return seconds > 0.0 ? (static_cast<double>(result.Count) * iterations) / seconds : 0.0;
+    };
+
+    result.ScalarTrajectoriesPerSecond = timeRun(false);
+    if (result.SimdAvailable) {
+        result.SimdTrajectoriesPerSecond = timeRun(true);
+    }
+    return result;
+}
@@ -0,0 +1,106 @@
+#ifndef BALL_PREDICTOR_H
+#define BALL_PREDICTOR_H
+
+#include <cstdint>
+#include <vector>
+#include "MathUtils.h"
+
+class ArenaSDF;
+
+// Fixed-step ball simulation used by the overlay (and anything else that needs a trajectory).
+// Collision uses the baked ArenaSDF when one is set, otherwise the old axis-aligned planes.
+class BallPredictor {
+public:
+    static constexpr float Gravity = -650.0f;
+    static constexpr float BallRadius = 91.25f;
+    static constexpr float Restitution = 0.6f;
+    static constexpr float GroundFriction = 0.98f;
+    static constexpr float SpinDamping = 0.995f;
+    static constexpr float MaxBallSpeed = 6000.0f;
+
+    static constexpr float TimeStep = 1.0f / 120.0f;
+    static constexpr float HorizonSeconds = 3.0f;
+    static constexpr int MaxSteps = static_cast<int>(HorizonSeconds * 120.0f);
+
+    // Values match the collision types the overlay already colours by
+    enum class ContactType : uint8_t {
+        None = 0,
+        Floor = 1,
+        Ceiling = 2,
+        Wall = 3
+    };
+
+    struct BallState {
+        Vec3 Location;
+        Vec3 Velocity;
+        Vec3 AngularVelocity;
+    };
+
+    struct Slice {
+        BallState State;
+        int32_t Step = 0;                 // 1-based step index, time = Step * TimeStep
+        ContactType Contact = ContactType::None;
+        bool InGoal = false;
+    };
+
+    // Structure-of-arrays output of PredictBatch. Rows are steps, columns are trajectories
+    // (padded to BatchLaneWidth) so each step can be written with full-width vector stores.
+    struct BatchResult {
+        int Count = 0;
+        int Steps = 0;
+        int Stride = 0;
+        std::vector<float> LocationX, LocationY, LocationZ;
+        std::vector<float> VelocityX, VelocityY, VelocityZ;
+        std::vector<uint8_t> Contacts; // ContactType per cell
+
+        size_t Index(int trajectory, int stepIndex) const { return static_cast<size_t>(stepIndex) * Stride + trajectory; }
+        Vec3 GetLocation(int trajectory, int stepIndex) const;
+        Vec3 GetVelocity(int trajectory, int stepIndex) const;
+        ContactType GetContact(int trajectory, int stepIndex) const;
+    };
+
+    struct BatchBenchmark {
+        int Count = 0;
+        int Steps = 0;
+        bool SimdAvailable = false;
+        double ScalarTrajectoriesPerSecond = 0.0;
+        double SimdTrajectoriesPerSecond = 0.0;
+    };
+
+    static constexpr int BatchLaneWidth = 8;
+    static constexpr int MaxBatchCount = 1024;
+    static constexpr int MaxBatchSteps = MaxSteps * 2;
+
+    explicit BallPredictor(const ArenaSDF* arena = nullptr);
+
+    void SetArena(const ArenaSDF* arena) { arena_ = arena; }
+    bool IsUsingSDF() const;
+
+    // Advances a single state by one TimeStep and resolves collisions.
+    ContactType Step(BallState& state) const;
+
+    // Fills 'out' with 'steps' slices. 'out' is cleared but keeps its capacity.
+    void Predict(const BallState& initial, std::vector<Slice>& out, int steps = MaxSteps) const;
+
+    // Advances every state in 'initial' in lockstep. Uses the AVX2 kernel when the CPU supports
+    // it and an SDF is loaded, otherwise runs Step() per trajectory.
+    void PredictBatch(const std::vector<BallState>& initial, int steps, BatchResult& out, bool allowSimd = true) const;
+
+    // Times the scalar and SIMD batch paths on 'count' synthetic shots and reports trajectories/sec.
+    BatchBenchmark BenchmarkBatch(int count = 64, int steps = MaxSteps, int iterations = 20) const;
+
+    static bool IsInGoal(const Vec3& location);
+    static bool IsSimdAvailable();
+
+private:
+    ContactType ResolveSDF(BallState& state) const;
+    ContactType ResolvePlanes(BallState& state) const;
+
+    void PredictBatchScalar(const std::vector<BallState>& initial, BatchResult& out) const;
+    void PredictBatchAVX2(const std::vector<BallState>& initial, BatchResult& out) const;
+
+    const ArenaSDF* arena_ = nullptr;
+    float spinDampPerStep_ = 1.0f;
+};
+
+#endif // BALL_PREDICTOR_H
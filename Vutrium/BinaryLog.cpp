@@ -0,0 +1,80 @@
+#include "BinaryLog.h"
+#include <cinttypes>
+#include <cstdio>
+
+namespace {
+    // Reads one argument at 'offset' and appends its text; returns false at the end or on a
+    // malformed payload.
+    bool AppendArgument(std::string& out, const uint8_t* payload, size_t size, size_t& offset) {
+        if (offset >= size) return false;
+        uint8_t type = payload[offset];
+        char buffer[32];
+        if (type == BinaryLog::Arg_String) {
+            uint16_t length = 0;
+            if (size - offset < 3) return false;
+            std::memcpy(&length, payload + offset + 1, sizeof(length));
+            if (size - offset - 3 < length) return false;
+            out.append(reinterpret_cast<const char*>(payload + offset + 3), length);
+            offset += 3 + length;
+            return true;
+        }
+
+        if (size - offset < 9) return false;
+        uint64_t bits = 0;
+        std::memcpy(&bits, payload + offset + 1, sizeof(bits));
+        switch (type) {
+        case BinaryLog::Arg_Int: snprintf(buffer, sizeof(buffer), "%" PRId64, static_cast<int64_t>(bits)); break;
+        case BinaryLog::Arg_UInt: snprintf(buffer, sizeof(buffer), "%" PRIu64, bits); break;
+        case BinaryLog::Arg_Hex: snprintf(buffer, sizeof(buffer), "0x%" PRIx64, bits); break;
+        case BinaryLog::Arg_Float: {
+            double value = 0.0;
+            std::memcpy(&value, &bits, sizeof(value));
+            snprintf(buffer, sizeof(buffer), "%f", value); // Same digits as std::to_string
+            break;
+        }
+        default: return false;
+        }
+        out += buffer;
+        offset += 9;
+        return true;
+    }
+}
+
+namespace BinaryLog {
+    std::string Render(std::string_view format, const uint8_t* payload, size_t size) {
+        std::string out;
+        out.reserve(format.size() + size);
+        size_t offset = 0;
+        size_t position = 0;
+        while (position < format.size()) {
+            size_t placeholder = format.find("{}", position);
+            if (placeholder == std::string_view::npos) {
+                out.append(format.substr(position));
+                break;
+            }
+            out.append(format.substr(position, placeholder - position));
+            if (!AppendArgument(out, payload, size, offset)) out += "{?}";
+            position = placeholder + 2;
+        }
+        while (offset < size) {
+            out += " | ";
+            if (!AppendArgument(out, payload, size, offset)) break;
+        }
+        return out;
+    }
+
+    std::string RenderRecord(uint16_t formatId, std::string_view format, const uint8_t* payload, size_t size) {
+        if (formatId == static_cast<uint16_t>(LogFormat::Text)) {
+            return std::string(reinterpret_cast<const char*>(payload), size);
+        }
+        return Render(format, payload, size);
+    }
+
+    const char* LevelName(LogLevel level) {
+        switch (level) {
+        case LogLevel::Warning: return "WARN";
+        case LogLevel::Error: return "ERROR";
+        default: return "INFO";
+        }
+    }
+}
@@ -0,0 +1,154 @@
+#ifndef BINARY_LOG_H
+#define BINARY_LOG_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include "LogFormats.h"
+
+// Argument encoding for Logger::Log and the on-disk layout of a binary log (.vlog), shared by the
+// logger and tools/LogDecodeMain.cpp.
+//
+// A record's payload is a sequence of tagged arguments (ArgType, then the value: 8 raw bytes for
+// numbers, or a uint16 length and the bytes for strings). LogFormat::Text records are the one
+// exception: their payload is the message itself.
+//
+// The file is a HeaderSize header (FileHeader, then the format table) followed by BlockCount
+// ring blocks of BlockSize bytes. Records never straddle a block; each block starts with a
+// BlockHeader whose Sequence orders the blocks, so the oldest ones are simply overwritten and
+// a reader sorts by Sequence and skips unused (zero) blocks. All values are little endian.
+namespace BinaryLog {
+    inline constexpr char Magic[8] = { 'V', 'L', 'O', 'G', 'B', 'I', 'N', '\0' };
+    constexpr uint32_t SchemaVersion = 1;
+    constexpr uint32_t BlockSize = 0x1000;
+    constexpr size_t DefaultFileSize = 8 * 1024 * 1024;
+    constexpr size_t MaxPayload = 1024;       // Per record; longer text and strings are truncated
+    constexpr size_t MaxStringArg = 255;
+
+    enum ArgType : uint8_t {
+        Arg_Int,      // int64
+        Arg_UInt,     // uint64
+        Arg_Hex,      // uint64, rendered as 0x... like Logger::to_hex
+        Arg_Float,    // double
+        Arg_String    // uint16 length, then the bytes
+    };
+
+#pragma pack(push, 1)
+    struct FileHeader {
+        char Magic[8];
+        uint32_t SchemaVersion;
+        uint32_t HeaderSize;          // Offset of the first block
+        uint32_t BlockSize;
+        uint32_t BlockCount;
+        uint32_t FormatCount;         // Entries in the format table after this header
+        uint32_t Reserved0;
+        int64_t StartUnixMicroseconds;
+        int64_t StartSteadyNanoseconds; // Record stamps are steady-clock; wall = start + (stamp - this)
+        uint8_t Reserved[64];
+    };
+
+    // Format table entry; followed by FormatLength bytes of the format string.
+    struct FormatEntry {
+        uint8_t Level;
+        uint8_t Reserved;
+        uint16_t FormatLength;
+    };
+
+    struct BlockHeader {
+        uint64_t Sequence;            // 1 for the first block written, 0 if never used
+        uint32_t UsedBytes;           // Including this header
+        uint32_t RecordCount;
+    }; // Size: 0x10
+
+    struct RecordHeader {
+        int64_t SteadyNanoseconds;
+        uint16_t FormatId;
+        uint16_t PayloadSize;
+        uint8_t Level;
+        uint8_t Reserved[3];
+    }; // Size: 0x10
+#pragma pack(pop)
+
+    static_assert(sizeof(BlockHeader) == 16 && sizeof(RecordHeader) == 16, "Unexpected record layout");
+    static_assert(sizeof(BlockHeader) + sizeof(RecordHeader) + MaxPayload <= BlockSize, "A full record must fit a block");
+
+    // Hex(address) renders as "0x1a2b..." without building a string on the calling thread.
+    struct Hex {
+        uint64_t Value;
+        template<typename T>
+        explicit Hex(T value) : Value(static_cast<uint64_t>(value)) {}
+    };
+
+    // Appends tagged arguments to a fixed buffer; arguments that do not fit are dropped whole.
+    class ArgWriter {
+    public:
+        ArgWriter(uint8_t* buffer, size_t capacity) : buffer_(buffer), capacity_(capacity) {}
+        size_t Size() const { return size_; }
+
+        template<typename T>
+        void Put(const T& value) {
+            if constexpr (std::is_same_v<T, Hex>) {
+                PutNumber(Arg_Hex, value.Value);
+            }
+            else if constexpr (std::is_same_v<T, bool>) {
+                PutString(value ? "true" : "false");
+            }
+            else if constexpr (std::is_floating_point_v<T>) {
+                PutNumber(Arg_Float, static_cast<double>(value));
+            }
+            else if constexpr (std::is_enum_v<T>) {
+                PutNumber(Arg_Int, static_cast<int64_t>(value));
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+                PutNumber(Arg_Int, static_cast<int64_t>(value));
+            }
+            else if constexpr (std::is_integral_v<T>) {
+                PutNumber(Arg_UInt, static_cast<uint64_t>(value));
+            }
+            else if constexpr (std::is_pointer_v<T> && !std::is_convertible_v<T, const char*>) {
+                PutNumber(Arg_Hex, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+            }
+            else {
+                PutString(std::string_view(value));
+            }
+        }
+
+    private:
+        template<typename N>
+        void PutNumber(ArgType type, N value) {
+            static_assert(sizeof(N) == 8, "Numbers are stored as 8 bytes");
+            if (capacity_ - size_ < 1 + sizeof(N)) return;
+            buffer_[size_] = type;
+            std::memcpy(buffer_ + size_ + 1, &value, sizeof(N));
+            size_ += 1 + sizeof(N);
+        }
+
+        void PutString(std::string_view text) {
+            if (capacity_ - size_ < 3) return;
+            uint16_t length = static_cast<uint16_t>(std::min({ text.size(), MaxStringArg, capacity_ - size_ - 3 }));
+            buffer_[size_] = Arg_String;
+            std::memcpy(buffer_ + size_ + 1, &length, sizeof(length));
+            std::memcpy(buffer_ + size_ + 3, text.data(), length);
+            size_ += 3 + length;
+        }
+
+        uint8_t* buffer_;
+        size_t capacity_;
+        size_t size_ = 0;
+    };
+
+    // Substitutes the payload's arguments into 'format' ({} placeholders). Missing arguments
+    // render as "{?}", and surplus ones are appended, so a mismatched table still shows everything.
+    std::string Render(std::string_view format, const uint8_t* payload, size_t size);
+
+    // Text for any record: the payload itself for LogFormat::Text, otherwise Render().
+    std::string RenderRecord(uint16_t formatId, std::string_view format, const uint8_t* payload, size_t size);
+
+    const char* LevelName(LogLevel level);
+}
+
+#endif // BINARY_LOG_H
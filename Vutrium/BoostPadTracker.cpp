@@ -0,0 +1,132 @@
+#include "BoostPadTracker.h"
+#include "RLSDK.h"
+#include "Logger.h"
+#include "ReadStats.h"
+
+void BoostPadTracker::Clear() {
+    gameEventAddress_ = 0;
+    actors_.fill(0);
+    pickupData_.fill(SDK::FPickupData{});
+    readSlots_.fill(0);
+    padReadCount_ = 0;
+    readCount_ = 0;
+    resolvedCount_ = 0;
+    clock_ = GameClock{};
+    gameTime_ = 0.0f;
+    lastResolveAttempt_ = std::chrono::steady_clock::time_point();
+}
+
+void BoostPadTracker::Reset(SDK::FieldState& field) {
+    Clear();
+    field.ResetBoostPads();
+    for (auto& pad : field.BoostPads) {
+        pad.PickupActorAddress = 0;
+    }
+    field.GameTime = 0.0f;
+}
+
+bool BoostPadTracker::Update(const RLSDK& sdk, const SDK::AGameEvent& gameEvent, SDK::FieldState& field) {
+    ReadScope readScope(ReadCategory::Pads);
+    if (!gameEvent.IsValid() || field.BoostPads.size() != PadCount) {
+        if (gameEventAddress_ != 0) {
+            Reset(field);
+        }
+        return false;
+    }
+
+    if (gameEvent.Address != gameEventAddress_) {
+        Reset(field);
+        gameEventAddress_ = gameEvent.Address;
+        RebuildReads();
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (resolvedCount_ < PadCount) {
+        std::chrono::duration<float> sinceAttempt = now - lastResolveAttempt_;
+        if (lastResolveAttempt_ == std::chrono::steady_clock::time_point() || sinceAttempt.count() >= ResolveRetrySeconds) {
+            lastResolveAttempt_ = now;
+            if (Resolve(sdk, field) > 0) {
+                RebuildReads();
+            }
+        }
+    }
+
+    const MemoryManager& mem = sdk.GetMemoryManager();
+    mem.ReadScatter(reads_.data(), readCount_);
+
+    clock_.Complete(reads_.data() + padReadCount_, readCount_ - padReadCount_);
+    if (!clock_.IsValid()) {
+        return false; // GameEvent went away mid-tick; it'll be dropped on the next revalidation
+    }
+    gameTime_ = clock_.Get<SDK::AGameEvent::TotalGameTimePlayed>() + clock_.Get<SDK::AGameEvent::OvertimePlayed>();
+    field.GameTime = gameTime_;
+
+    bool lostActor = false;
+    for (size_t i = 0; i < padReadCount_; ++i) {
+        const size_t slot = readSlots_[i];
+        SDK::BoostPadState& pad = field.BoostPads[slot];
+        if (!reads_[i].Success) {
+            // Actor was destroyed (or moved out of readable memory); resolve it again later.
+            actors_[slot] = 0;
+            pad.PickupActorAddress = 0;
+            pad.Reset();
+            --resolvedCount_;
+            lostActor = true;
+            continue;
+        }
+        pad.ApplyPickedUp(pickupData_[slot].IsPickedUp(), gameTime_);
+    }
+
+    if (lostActor) {
+        RebuildReads();
+    }
+    return true;
+}
+
+size_t BoostPadTracker::Resolve(const RLSDK& sdk, SDK::FieldState& field) {
+    SDK::UClass pickupClass = sdk.FindStaticClass(PickupClassName);
+    if (!pickupClass.IsValid()) {
+        return 0;
+    }
+
+    const MemoryManager& mem = sdk.GetMemoryManager();
+    size_t newlyResolved = 0;
+    // Newest objects first, so leftovers from a previous match that haven't been collected yet
+    // lose to this match's actors. The class default object and archetypes sit at the origin
+    // and never land within MatchTolerance of a pad.
+    // The instances come from GObjectsTable's per-class index once ObjectDiscovery has run a
+    // Refresh(), so this no longer walks GObjects.
+    sdk.GetGObjectsTable().ForEachInstanceFromTail(mem, pickupClass.Address, [&](const SDK::UObject& object) {
+        SDK::AVehiclePickup_Boost pickup(object.Address);
+        int slot = field.FindNearestPadIndex(SDK::Vector3D(pickup.GetLocation(mem)), MatchTolerance);
+        if (slot >= 0 && actors_[slot] == 0) {
+            actors_[slot] = object.Address;
+            field.BoostPads[slot].PickupActorAddress = object.Address;
+            ++resolvedCount_;
+            ++newlyResolved;
+        }
+        return resolvedCount_ < PadCount;
+    });
+
+    if (newlyResolved > 0) {
+        VUTRIUM_LOG_INFO("BoostPadTracker: Resolved " + std::to_string(resolvedCount_) + "/" + std::to_string(PadCount) + " boost pickup actors.");
+    }
+    return newlyResolved;
+}
+
+void BoostPadTracker::RebuildReads() {
+    readCount_ = 0;
+    for (size_t slot = 0; slot < PadCount; ++slot) {
+        if (actors_[slot] == 0) continue;
+
+        MemoryManager::ScatterRead& read = reads_[readCount_];
+        read.Address = actors_[slot] + SDK::AVehiclePickup::PickupData::Offset();
+        read.Buffer = &pickupData_[slot];
+        read.Size = sizeof(SDK::FPickupData);
+        readSlots_[readCount_] = static_cast<uint8_t>(slot);
+        ++readCount_;
+    }
+
+    padReadCount_ = readCount_;
+    readCount_ += clock_.Request(gameEventAddress_, reads_.data() + readCount_);
+}
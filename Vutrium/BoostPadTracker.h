@@ -0,0 +1,60 @@
+#ifndef BOOST_PAD_TRACKER_H
+#define BOOST_PAD_TRACKER_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include "MemoryManager.h"
+#include "Objects.hpp"
+#include "ObjectPath.h"
+
+class RLSDK;
+
+// Tracks boost pad availability by polling the pickup actors instead of relying on the
+// pickup hooks. The AVehiclePickup_Boost actors are resolved once per match and bound to
+// their FieldState slot by nearest BOOST_LOCATIONS entry; after that every Update() is a
+// single scatter read of all pickup flags plus the GameEvent clock.
+// Not thread safe: owned and driven by one thread (the FrameWorker).
+class BoostPadTracker {
+public:
+    static constexpr size_t PadCount = std::size(SDK::FieldState::BOOST_LOCATIONS);
+    static constexpr float MatchTolerance = 150.0f;   // Max distance from an actor to its BOOST_LOCATIONS entry
+    static constexpr float ResolveRetrySeconds = 2.0f; // Pads can replicate in after the GameEvent does
+    static constexpr SDK::ObjectPath PickupClassName{ "Class TAGame.VehiclePickup_Boost_TA" };
+
+    BoostPadTracker() { Clear(); }
+
+    // Call once per tick. Re-resolves when the GameEvent changes or a pickup actor stops
+    // being readable, then polls every resolved pad and applies transitions to 'field'.
+    // Returns false when the pads couldn't be polled this tick.
+    bool Update(const RLSDK& sdk, const SDK::AGameEvent& gameEvent, SDK::FieldState& field);
+
+    // Forget the current match (e.g. after leaving it). Pads in 'field' are reset as well.
+    void Reset(SDK::FieldState& field);
+
+    size_t GetResolvedCount() const { return resolvedCount_; }
+    float GetGameTime() const { return gameTime_; }
+
+private:
+    // TotalGameTimePlayed and OvertimePlayed are adjacent in AGameEvent; read them as one.
+    using GameClock = SDK::FieldSnapshot<SDK::AGameEvent::TotalGameTimePlayed, SDK::AGameEvent::OvertimePlayed>;
+
+    void Clear();
+    size_t Resolve(const RLSDK& sdk, SDK::FieldState& field);
+    void RebuildReads();
+
+    uintptr_t gameEventAddress_ = 0;
+    std::array<uintptr_t, PadCount> actors_;                 // Indexed like FieldState::BoostPads
+    std::array<SDK::FPickupData, PadCount> pickupData_;
+    std::array<MemoryManager::ScatterRead, PadCount + GameClock::MaxReads> reads_; // Resolved pads first, then the clock
+    std::array<uint8_t, PadCount> readSlots_;                // reads_[i] -> BoostPads index
+    size_t padReadCount_ = 0;
+    size_t readCount_ = 0;
+    size_t resolvedCount_ = 0;
+    GameClock clock_;
+    float gameTime_ = 0.0f;
+    std::chrono::steady_clock::time_point lastResolveAttempt_;
+};
+
+#endif // BOOST_PAD_TRACKER_H
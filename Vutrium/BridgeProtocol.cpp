@@ -0,0 +1,238 @@
+#include "BridgeProtocol.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr size_t STATE_VALUES_MIN = 6; // Location and velocity
+    constexpr size_t STATE_VALUES_MAX = 9; // Plus angular velocity; nothing in between
+
+    int16_t QuantizeComponent(float value) {
+        if (!std::isfinite(value)) return 0;
+        float rounded = std::round(value);
+        return static_cast<int16_t>((std::max)(-32768.0f, (std::min)(32767.0f, rounded)));
+    }
+
+    bool ReadState(const nlohmann::json& values, BallPredictor::BallState& outState) {
+        if (!values.is_array() || (values.size() != STATE_VALUES_MIN && values.size() != STATE_VALUES_MAX)) return false;
+
+        float v[STATE_VALUES_MAX] = { 0.0f };
+        for (size_t i = 0; i < values.size(); ++i) {
+            if (!values[i].is_number()) return false;
+            v[i] = values[i].get<float>();
+            if (!std::isfinite(v[i])) return false;
+        }
+
+        outState.Location = { v[0], v[1], v[2] };
+        outState.Velocity = { v[3], v[4], v[5] };
+        outState.AngularVelocity = { v[6], v[7], v[8] };
+        return true;
+    }
+
+    // Accumulates one trajectory step by step: keeps every stride-th slice and reports
+    // bounce starts and the first goal-line crossing at full step resolution.
+    class TrajectoryWriter {
+    public:
+        explicit TrajectoryWriter(int stride) : stride_((std::max)(1, stride)) {}
+
+        void Add(int step, const Vec3& location, const Vec3& velocity, BallPredictor::ContactType contact) {
+            if ((step % stride_) == 0) {
+                slices_.push_back(Bridge::QuantizeSlice(location, velocity));
+            }
+
+            if (contact != BallPredictor::ContactType::None && previousContact_ == BallPredictor::ContactType::None) {
+                events_.push_back({ step, static_cast<int>(contact) });
+            }
+            previousContact_ = contact;
+
+            if (!goalReported_ && BallPredictor::IsInGoal(location)) {
+                events_.push_back({ step, static_cast<int>(Bridge::EventCode::Goal) });
+                goalReported_ = true;
+            }
+        }
+
+        void WriteTo(nlohmann::json& out) {
+            out["slices"] = Bridge::Base64Encode(slices_.data(), slices_.size() * sizeof(Bridge::QuantizedSlice));
+            out["events"] = std::move(events_);
+        }
+
+    private:
+        int stride_;
+        std::vector<Bridge::QuantizedSlice> slices_;
+        nlohmann::json events_ = nlohmann::json::array();
+        BallPredictor::ContactType previousContact_ = BallPredictor::ContactType::None;
+        bool goalReported_ = false;
+    };
+}
+
+namespace Bridge {
+    QuantizedSlice QuantizeSlice(const Vec3& location, const Vec3& velocity) {
+        QuantizedSlice q;
+        q.X = QuantizeComponent(location.X);
+        q.Y = QuantizeComponent(location.Y);
+        q.Z = QuantizeComponent(location.Z);
+        q.VX = QuantizeComponent(velocity.X);
+        q.VY = QuantizeComponent(velocity.Y);
+        q.VZ = QuantizeComponent(velocity.Z);
+        return q;
+    }
+
+    std::string Base64Encode(const void* data, size_t size) {
+        static const char* table = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+        std::string out;
+        out.reserve(((size + 2) / 3) * 4);
+
+        size_t i = 0;
+        for (; i + 2 < size; i += 3) {
+            uint32_t triple = (bytes[i] << 16) | (bytes[i + 1] << 8) | bytes[i + 2];
+            out.push_back(table[(triple >> 18) & 0x3F]);
+            out.push_back(table[(triple >> 12) & 0x3F]);
+            out.push_back(table[(triple >> 6) & 0x3F]);
+            out.push_back(table[triple & 0x3F]);
+        }
+        if (i < size) {
+            uint32_t triple = bytes[i] << 16;
+            if (i + 1 < size) triple |= bytes[i + 1] << 8;
+            out.push_back(table[(triple >> 18) & 0x3F]);
+            out.push_back(table[(triple >> 12) & 0x3F]);
+            out.push_back(i + 1 < size ? table[(triple >> 6) & 0x3F] : '=');
+            out.push_back('=');
+        }
+        return out;
+    }
+
+    std::optional<PredictBatchRequest> ParsePredictBatchRequest(const nlohmann::json& message, std::string& outError) {
+        PredictBatchRequest request;
+
+        if (message.contains("id") && message["id"].is_number_integer()) {
+            request.Id = message["id"].get<int64_t>();
+        }
+        if (message.contains("steps")) {
+            if (!message["steps"].is_number_integer()) { outError = "steps must be an integer"; return std::nullopt; }
+            request.Steps = message["steps"].get<int>();
+        }
+        if (message.contains("stride")) {
+            if (!message["stride"].is_number_integer()) { outError = "stride must be an integer"; return std::nullopt; }
+            request.Stride = message["stride"].get<int>();
+        }
+        if (request.Steps < 1 || request.Steps > BallPredictor::MaxBatchSteps) {
+            outError = "steps must be in [1, " + std::to_string(BallPredictor::MaxBatchSteps) + "]";
+            return std::nullopt;
+        }
+        if (request.Stride < 1 || request.Stride > request.Steps) {
+            outError = "stride must be in [1, steps]";
+            return std::nullopt;
+        }
+
+        if (!message.contains("states") || !message["states"].is_array()) {
+            outError = "states must be an array";
+            return std::nullopt;
+        }
+        const auto& states = message["states"];
+        if (states.empty() || states.size() > static_cast<size_t>(BallPredictor::MaxBatchCount)) {
+            outError = "states must contain 1-" + std::to_string(BallPredictor::MaxBatchCount) + " entries";
+            return std::nullopt;
+        }
+
+        request.States.resize(states.size());
+        for (size_t i = 0; i < states.size(); ++i) {
+            if (!ReadState(states[i], request.States[i])) {
+                outError = "states[" + std::to_string(i) + "] must be 6 or 9 finite numbers";
+                return std::nullopt;
+            }
+        }
+        return request;
+    }
+
+    std::string EncodePredictBatchResult(int64_t id, int stride, const BallPredictor::BatchResult& result) {
+        stride = (std::max)(1, stride);
+
+        nlohmann::json trajectories = nlohmann::json::array();
+        for (int t = 0; t < result.Count; ++t) {
+            TrajectoryWriter writer(stride);
+            for (int s = 0; s < result.Steps; ++s) {
+                writer.Add(s + 1, result.GetLocation(t, s), result.GetVelocity(t, s), result.GetContact(t, s));
+            }
+
+            nlohmann::json trajectory = nlohmann::json::object();
+            writer.WriteTo(trajectory);
+            trajectories.push_back(std::move(trajectory));
+        }
+
+        nlohmann::json message = {
+            { "type", MessageType::PredictBatchResult },
+            { "version", ProtocolVersion },
+            { "id", id },
+            { "dt", BallPredictor::TimeStep },
+            { "steps", result.Steps },
+            { "stride", stride },
+            { "count", result.Count },
+            { "trajectories", std::move(trajectories) }
+        };
+        return message.dump() + "\n";
+    }
+
+    std::string EncodeBallPrediction(uint64_t tick, const BallPredictor::BallState& current,
+                                     const std::vector<BallPredictor::Slice>& slices, int stride) {
+        stride = (std::max)(1, stride);
+
+        TrajectoryWriter writer(stride);
+        for (const auto& slice : slices) {
+            writer.Add(slice.Step, slice.State.Location, slice.State.Velocity, slice.Contact);
+        }
+
+        QuantizedSlice ball = QuantizeSlice(current.Location, current.Velocity);
+        nlohmann::json message = {
+            { "type", MessageType::BallPrediction },
+            { "version", ProtocolVersion },
+            { "tick", tick },
+            { "dt", BallPredictor::TimeStep },
+            { "steps", static_cast<int>(slices.size()) },
+            { "stride", stride },
+            { "ball", { ball.X, ball.Y, ball.Z, ball.VX, ball.VY, ball.VZ } }
+        };
+        writer.WriteTo(message);
+        return message.dump() + "\n";
+    }
+
+    std::string EncodeError(int64_t id, const std::string& requestType, const std::string& message) {
+        nlohmann::json error = {
+            { "type", MessageType::Error },
+            { "version", ProtocolVersion },
+            { "id", id },
+            { "request", requestType },
+            { "message", message }
+        };
+        return error.dump() + "\n";
+    }
+
+    std::string EncodeSettings(const ClientSettings& settings) {
+        std::string json_str = "{";
+        json_str += "\"bot_enabled\":" + std::string(settings.BotEnabled ? "true" : "false") + ",";
+        json_str += "\"auto_ball_cam\":" + std::string(settings.AutoBallCam ? "true" : "false") + ",";
+        json_str += "\"speedflip_kickoff_enabled\":" + std::string(settings.SpeedflipKickoff ? "true" : "false") + ",";
+        json_str += "\"debug\":" + std::string(settings.Debug ? "true" : "false") + ",";
+        json_str += "\"monitoring\":" + std::string(settings.Monitoring ? "true" : "false") + ",";
+        json_str += "\"selected_bot\":\"" + settings.SelectedBot + "\",";
+        json_str += "\"nexto_beta\":1.0,";
+        json_str += "\"clock\":" + std::string(settings.Clock ? "true" : "false") + ",";
+        json_str += "\"ball_prediction_stream\":" + std::string(settings.BallPredictionStream ? "true" : "false");
+        json_str += "}\n";
+        return json_str;
+    }
+
+    bool BallPredictionStream::Update(const BallPredictor::BallState& state, const BallPredictor& predictor, std::string& outMessage) {
+        if (hasLastState_ &&
+            MathUtils::LengthSquared(state.Location - lastState_.Location) == 0.0f &&
+            MathUtils::LengthSquared(state.Velocity - lastState_.Velocity) == 0.0f) {
+            return false;
+        }
+        lastState_ = state;
+        hasLastState_ = true;
+
+        predictor.Predict(state, slices_);
+        outMessage = EncodeBallPrediction(++tick_, state, slices_, BallPredictionStride);
+        return true;
+    }
+}
@@ -0,0 +1,102 @@
+#ifndef BRIDGE_PROTOCOL_H
+#define BRIDGE_PROTOCOL_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+#include "BallPredictor.h"
+
+// Message encoding for the TCP bridge to the Python client.
+// Every message is one JSON object per line ("\n" terminated) with a "type" field.
+//
+// Trajectories are sent quantized: each slice is six little-endian int16
+// (x, y, z in uu, vx, vy, vz in uu/s), base64 encoded in "slices". Slice i covers
+// step (i + 1) * stride, time = step * dt. Bounces and goals are listed separately
+// in "events" as [step, EventCode] pairs.
+namespace Bridge {
+    constexpr int ProtocolVersion = 1;
+    constexpr size_t MaxClientMessageBytes = 1024 * 1024;
+    constexpr int BallPredictionStride = 4; // 30 slices per second of prediction
+
+    namespace MessageType {
+        inline constexpr const char* PredictBatch = "predict_batch";
+        inline constexpr const char* PredictBatchResult = "predict_batch_result";
+        inline constexpr const char* BallPrediction = "ball_prediction";
+        inline constexpr const char* Error = "error";
+    }
+
+    enum class EventCode : uint8_t {
+        FloorBounce = 1,
+        CeilingBounce = 2,
+        WallBounce = 3,
+        Goal = 4
+    };
+
+#pragma pack(push, 1)
+    struct QuantizedSlice {
+        int16_t X, Y, Z;
+        int16_t VX, VY, VZ;
+    }; // Size: 0x0C
+#pragma pack(pop)
+
+    // { "type": "predict_batch", "id": 7, "steps": 240, "stride": 2,
+    //   "states": [[px, py, pz, vx, vy, vz(, wx, wy, wz)], ...] }
+    struct PredictBatchRequest {
+        int64_t Id = 0;
+        int Steps = BallPredictor::MaxSteps;
+        int Stride = 1;
+        std::vector<BallPredictor::BallState> States;
+    };
+
+    std::optional<PredictBatchRequest> ParsePredictBatchRequest(const nlohmann::json& message, std::string& outError);
+
+    std::string EncodePredictBatchResult(int64_t id, int stride, const BallPredictor::BatchResult& result);
+
+    // Pushed every time the ball moves on to a new physics frame:
+    // { "type": "ball_prediction", "tick": n, "dt", "steps", "stride",
+    //   "ball": [x, y, z, vx, vy, vz], "slices": base64, "events": [[step, code], ...] }
+    std::string EncodeBallPrediction(uint64_t tick, const BallPredictor::BallState& current,
+                                     const std::vector<BallPredictor::Slice>& slices, int stride);
+    std::string EncodeError(int64_t id, const std::string& requestType, const std::string& message);
+
+    // Overlay toggles the client follows. Sent on connect and whenever one changes; this message
+    // predates "type"/"version" and the client still parses it bare:
+    // { "bot_enabled": b, "auto_ball_cam": b, ..., "selected_bot": "name", "ball_prediction_stream": b }
+    struct ClientSettings {
+        bool BotEnabled = false;
+        bool AutoBallCam = false;
+        bool SpeedflipKickoff = false;
+        bool Debug = false;
+        bool Monitoring = false;
+        std::string SelectedBot;
+        bool Clock = false;
+        bool BallPredictionStream = false;
+    };
+
+    std::string EncodeSettings(const ClientSettings& settings);
+
+    // Turns sampled ball states into "ball_prediction" messages, one per new physics frame
+    // (repeated samples of the same frame are dropped). Used by the server thread and the replay tool.
+    class BallPredictionStream {
+    public:
+        // Returns true and sets outMessage when 'state' starts a new physics frame.
+        bool Update(const BallPredictor::BallState& state, const BallPredictor& predictor, std::string& outMessage);
+        void Reset() { hasLastState_ = false; }
+
+        uint64_t GetTick() const { return tick_; }
+        const std::vector<BallPredictor::Slice>& GetSlices() const { return slices_; }
+
+    private:
+        uint64_t tick_ = 0;
+        bool hasLastState_ = false;
+        BallPredictor::BallState lastState_;
+        std::vector<BallPredictor::Slice> slices_;
+    };
+
+    QuantizedSlice QuantizeSlice(const Vec3& location, const Vec3& velocity);
+    std::string Base64Encode(const void* data, size_t size);
+}
+
+#endif // BRIDGE_PROTOCOL_H
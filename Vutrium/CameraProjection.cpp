@@ -0,0 +1,134 @@
+#include "CameraProjection.h"
+#include <emmintrin.h>
+
+namespace {
+    constexpr float ROTATOR_TO_RADIANS = 3.14159265f / 32768.0f;
+
+    const Vec3& PointAt(const Vec3* first, size_t strideBytes, size_t index) {
+        return *reinterpret_cast<const Vec3*>(reinterpret_cast<const uint8_t*>(first) + index * strideBytes);
+    }
+}
+
+CameraProjection::CameraProjection(const Vec3& location, int32_t pitch, int32_t yaw, int32_t roll,
+                                   float fovDegrees, float screenWidth, float screenHeight)
+    : location_(location), screenWidth_(screenWidth), screenHeight_(screenHeight) {
+    const float sy = std::sin(yaw * ROTATOR_TO_RADIANS);
+    const float cy = std::cos(yaw * ROTATOR_TO_RADIANS);
+    const float sp = std::sin(pitch * ROTATOR_TO_RADIANS);
+    const float cp = std::cos(pitch * ROTATOR_TO_RADIANS);
+    const float sr = std::sin(roll * ROTATOR_TO_RADIANS);
+    const float cr = std::cos(roll * ROTATOR_TO_RADIANS);
+
+    axisX_ = MathUtils::Normalize({ cp * cy, cp * sy, sp });
+    axisY_ = MathUtils::Normalize({ sr * sp * cy - cr * sy, sr * sp * sy + cr * cy, -sr * cp });
+    axisZ_ = MathUtils::Normalize({ -(cr * sp * cy + sr * sy), -(cr * sp * sy - sr * cy), cr * cp });
+
+    centerX_ = screenWidth * 0.5f;
+    centerY_ = screenHeight * 0.5f;
+
+    const float tanHalfFov = std::tan(fovDegrees * 3.14159265f / 360.0f);
+    projectionScale_ = tanHalfFov > 0.0f ? centerX_ / tanHalfFov : 0.0f;
+
+    valid_ = projectionScale_ > 0.0f && screenWidth > 0.0f && screenHeight > 0.0f;
+}
+
+bool CameraProjection::Project(const Vec3& world, ScreenPoint& outPoint, float margin) const {
+    const Vec3 delta = world - location_;
+    const float depth = MathUtils::Dot(delta, axisX_);
+
+    outPoint.Depth = depth;
+    outPoint.Flags = 0;
+    if (!valid_ || depth <= NearPlane) {
+        return false;
+    }
+
+    const float scale = projectionScale_ / depth;
+    outPoint.X = centerX_ + MathUtils::Dot(delta, axisY_) * scale;
+    outPoint.Y = centerY_ - MathUtils::Dot(delta, axisZ_) * scale;
+    outPoint.Flags = Visible_InFront;
+
+    if (outPoint.X >= -margin && outPoint.X <= screenWidth_ + margin &&
+        outPoint.Y >= -margin && outPoint.Y <= screenHeight_ + margin) {
+        outPoint.Flags |= Visible_OnScreen;
+    }
+    return true;
+}
+
+size_t CameraProjection::ProjectBatch(const Vec3* firstPoint, size_t strideBytes, size_t count,
+                                      ScreenPoint* out, float margin) const {
+    if (!valid_) {
+        for (size_t i = 0; i < count; ++i) out[i] = ScreenPoint();
+        return 0;
+    }
+
+    const __m128 camX = _mm_set1_ps(location_.X), camY = _mm_set1_ps(location_.Y), camZ = _mm_set1_ps(location_.Z);
+    const __m128 fwdX = _mm_set1_ps(axisX_.X), fwdY = _mm_set1_ps(axisX_.Y), fwdZ = _mm_set1_ps(axisX_.Z);
+    const __m128 rightX = _mm_set1_ps(axisY_.X), rightY = _mm_set1_ps(axisY_.Y), rightZ = _mm_set1_ps(axisY_.Z);
+    const __m128 upX = _mm_set1_ps(axisZ_.X), upY = _mm_set1_ps(axisZ_.Y), upZ = _mm_set1_ps(axisZ_.Z);
+    const __m128 scale = _mm_set1_ps(projectionScale_);
+    const __m128 centerX = _mm_set1_ps(centerX_), centerY = _mm_set1_ps(centerY_);
+    const __m128 nearPlane = _mm_set1_ps(NearPlane);
+    const __m128 minBound = _mm_set1_ps(-margin);
+    const __m128 maxX = _mm_set1_ps(screenWidth_ + margin), maxY = _mm_set1_ps(screenHeight_ + margin);
+
+    size_t onScreen = 0;
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const Vec3& p0 = PointAt(firstPoint, strideBytes, i);
+        const Vec3& p1 = PointAt(firstPoint, strideBytes, i + 1);
+        const Vec3& p2 = PointAt(firstPoint, strideBytes, i + 2);
+        const Vec3& p3 = PointAt(firstPoint, strideBytes, i + 3);
+
+        const __m128 dx = _mm_sub_ps(_mm_setr_ps(p0.X, p1.X, p2.X, p3.X), camX);
+        const __m128 dy = _mm_sub_ps(_mm_setr_ps(p0.Y, p1.Y, p2.Y, p3.Y), camY);
+        const __m128 dz = _mm_sub_ps(_mm_setr_ps(p0.Z, p1.Z, p2.Z, p3.Z), camZ);
+
+        const __m128 depth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, fwdX), _mm_mul_ps(dy, fwdY)), _mm_mul_ps(dz, fwdZ));
+        const __m128 right = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, rightX), _mm_mul_ps(dy, rightY)), _mm_mul_ps(dz, rightZ));
+        const __m128 up = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, upX), _mm_mul_ps(dy, upY)), _mm_mul_ps(dz, upZ));
+
+        const __m128 inFront = _mm_cmpgt_ps(depth, nearPlane);
+        // Keep the divide finite for lanes behind the camera; they're masked out below.
+        const __m128 safeDepth = _mm_or_ps(_mm_and_ps(inFront, depth), _mm_andnot_ps(inFront, nearPlane));
+        const __m128 perspective = _mm_div_ps(scale, safeDepth);
+
+        const __m128 sx = _mm_add_ps(centerX, _mm_mul_ps(right, perspective));
+        const __m128 sy = _mm_sub_ps(centerY, _mm_mul_ps(up, perspective));
+
+        const __m128 inside = _mm_and_ps(
+            _mm_and_ps(_mm_cmpge_ps(sx, minBound), _mm_cmple_ps(sx, maxX)),
+            _mm_and_ps(_mm_cmpge_ps(sy, minBound), _mm_cmple_ps(sy, maxY)));
+
+        const int frontMask = _mm_movemask_ps(inFront);
+        const int screenMask = _mm_movemask_ps(_mm_and_ps(inFront, inside));
+
+        alignas(16) float xs[4], ys[4], ds[4];
+        _mm_store_ps(xs, sx);
+        _mm_store_ps(ys, sy);
+        _mm_store_ps(ds, depth);
+
+        for (int lane = 0; lane < 4; ++lane) {
+            ScreenPoint& sp = out[i + lane];
+            sp.X = xs[lane];
+            sp.Y = ys[lane];
+            sp.Depth = ds[lane];
+            sp.Flags = static_cast<uint8_t>(((frontMask >> lane) & 1) * Visible_InFront |
+                                            ((screenMask >> lane) & 1) * Visible_OnScreen);
+        }
+        onScreen += static_cast<size_t>(((screenMask >> 0) & 1) + ((screenMask >> 1) & 1) +
+                                        ((screenMask >> 2) & 1) + ((screenMask >> 3) & 1));
+    }
+
+    for (; i < count; ++i) {
+        if (Project(PointAt(firstPoint, strideBytes, i), out[i], margin) && out[i].OnScreen()) {
+            ++onScreen;
+        }
+    }
+    return onScreen;
+}
+
+void CameraProjection::ScreenDirection(const Vec3& world, float& outX, float& outY) const {
+    const Vec3 delta = world - location_;
+    outX = MathUtils::Dot(delta, axisY_);
+    outY = MathUtils::Dot(delta, axisZ_);
+}
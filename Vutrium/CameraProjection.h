@@ -0,0 +1,79 @@
+#ifndef CAMERA_PROJECTION_H
+#define CAMERA_PROJECTION_H
+
+#include <cstddef>
+#include <cstdint>
+#include "MathUtils.h"
+
+// World-to-screen projection for one camera pose. Build it once per frame from the
+// camera location/rotation/FOV; the basis vectors and projection scale are computed
+// up front so projecting a point is just three dot products and a divide.
+class CameraProjection {
+public:
+    static constexpr float NearPlane = 0.1f;
+    static constexpr float DefaultScreenMargin = 100.0f;
+
+    enum VisibilityFlags : uint8_t {
+        Visible_InFront = 1 << 0,  // In front of the near plane, X/Y are valid
+        Visible_OnScreen = 1 << 1  // Also inside the screen rect grown by the margin
+    };
+
+    struct ScreenPoint {
+        float X = 0.0f;
+        float Y = 0.0f;
+        float Depth = 0.0f;        // Distance along the view axis
+        uint8_t Flags = 0;
+
+        bool InFront() const { return (Flags & Visible_InFront) != 0; }
+        bool OnScreen() const { return (Flags & Visible_OnScreen) != 0; }
+    };
+
+    CameraProjection() = default;
+
+    // Rotation is in Unreal rotator units (65536 = full turn), FOV is the horizontal angle in degrees.
+    CameraProjection(const Vec3& location, int32_t pitch, int32_t yaw, int32_t roll,
+                     float fovDegrees, float screenWidth, float screenHeight);
+
+    bool IsValid() const { return valid_; }
+
+    // Single point. Returns false (and leaves outPoint.Flags == 0) if the point is behind the camera.
+    bool Project(const Vec3& world, ScreenPoint& outPoint, float margin = DefaultScreenMargin) const;
+
+    // Projects 'count' points, four at a time with SSE. Points are read 'strideBytes' apart so
+    // arrays of structs (e.g. prediction slices) can be projected in place.
+    // Returns how many points ended up on screen.
+    size_t ProjectBatch(const Vec3* firstPoint, size_t strideBytes, size_t count,
+                        ScreenPoint* out, float margin = DefaultScreenMargin) const;
+    size_t ProjectBatch(const Vec3* points, size_t count, ScreenPoint* out, float margin = DefaultScreenMargin) const {
+        return ProjectBatch(points, sizeof(Vec3), count, out, margin);
+    }
+
+    // Screen-space direction (x right, y up, not normalized) towards a world point,
+    // valid even when the point is behind the camera. Used for off-screen indicators.
+    void ScreenDirection(const Vec3& world, float& outX, float& outY) const;
+
+    // Screen-space radius of a sphere of 'worldRadius' at 'depth'.
+    float ProjectRadius(float worldRadius, float depth) const {
+        return depth > NearPlane ? (worldRadius * projectionScale_) / depth : 0.0f;
+    }
+
+    const Vec3& GetLocation() const { return location_; }
+    const Vec3& GetForward() const { return axisX_; }
+    const Vec3& GetRight() const { return axisY_; }
+    const Vec3& GetUp() const { return axisZ_; }
+    float GetProjectionScale() const { return projectionScale_; }
+    float GetScreenWidth() const { return screenWidth_; }
+    float GetScreenHeight() const { return screenHeight_; }
+
+private:
+    Vec3 location_;
+    Vec3 axisX_, axisY_, axisZ_;
+    float projectionScale_ = 0.0f;
+    float centerX_ = 0.0f;
+    float centerY_ = 0.0f;
+    float screenWidth_ = 0.0f;
+    float screenHeight_ = 0.0f;
+    bool valid_ = false;
+};
+
+#endif // CAMERA_PROJECTION_H
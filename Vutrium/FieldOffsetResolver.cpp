@@ -0,0 +1,347 @@
+#include "FieldOffsetResolver.h"
+#include "GNameTable.h"
+#include "GObjectsTable.h"
+#include "Logger.h"
+#include "ObjectPath.h"
+#include "ReadStats.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SDK {
+
+    namespace {
+        enum class FieldOwner : uint8_t {
+#define VUTRIUM_FIELD_OWNER_ID(owner, package, name) owner,
+            VUTRIUM_FIELD_OWNERS(VUTRIUM_FIELD_OWNER_ID)
+#undef VUTRIUM_FIELD_OWNER_ID
+            Count
+        };
+        constexpr size_t OwnerCount = static_cast<size_t>(FieldOwner::Count);
+        constexpr size_t FieldCount = FieldOffsetReport::FieldCount;
+        static_assert(OwnerCount <= 32, "Struct::Owners is a 32-bit mask");
+
+        constexpr ObjectPath OwnerClasses[OwnerCount] = {
+#define VUTRIUM_FIELD_OWNER_CLASS(owner, package, name) ObjectPath("Class " package "." name),
+            VUTRIUM_FIELD_OWNERS(VUTRIUM_FIELD_OWNER_CLASS)
+#undef VUTRIUM_FIELD_OWNER_CLASS
+        };
+        constexpr const char* OwnerNames[OwnerCount] = {
+#define VUTRIUM_FIELD_OWNER_NAME(owner, package, name) #owner,
+            VUTRIUM_FIELD_OWNERS(VUTRIUM_FIELD_OWNER_NAME)
+#undef VUTRIUM_FIELD_OWNER_NAME
+        };
+        constexpr FieldOwner FieldOwners[FieldCount] = {
+#define VUTRIUM_FIELD_OWNER_OF(owner, name, type, offset, property) FieldOwner::owner,
+            VUTRIUM_OBJECT_FIELDS(VUTRIUM_FIELD_OWNER_OF)
+#undef VUTRIUM_FIELD_OWNER_OF
+        };
+
+        constexpr int32_t MaxSuperDepth = 64;     // Same guard as IsA's hierarchy walk
+        constexpr size_t MaxChainLength = 8192;   // Members per struct; a cycle in garbage ends here
+
+        // Actor's first manifest property. It must resolve past its super's (UObject's) members
+        // for the layout to be trusted, wherever a game update has moved it.
+        constexpr FieldId AnchorField = FieldId::AActor_Location;
+        constexpr int32_t MaxCheckedAlignment = 4; // Structs and 8-byte members are only 4-aligned in some UE3 classes
+
+        // Alignment an offset needs for a property of 'elementSize' bytes: its lowest set bit, capped.
+        constexpr int32_t RequiredAlignment(int32_t elementSize) {
+            return (std::min)(elementSize & -elementSize, MaxCheckedAlignment);
+        }
+
+        // A found field, in the order the member walk met it.
+        struct ChainPosition {
+            size_t Struct = 0;
+            size_t Visited = 0;
+            size_t Field = 0;
+        };
+
+        // SuperField, Children and PropertySize are adjacent and read as one block.
+        struct StructHeader {
+            uintptr_t SuperField = 0;
+            uintptr_t Children = 0;
+            uint32_t PropertySize = 0;
+        };
+        static_assert(UStruct::Offset_Children == UStruct::Offset_SuperField + sizeof(uintptr_t)
+                      && UStruct::Offset_PropertySize == UStruct::Offset_Children + sizeof(uintptr_t),
+                      "StructHeader mirrors UStruct");
+        constexpr size_t StructHeaderSize = UStruct::Offset_PropertySize + sizeof(uint32_t) - UStruct::Offset_SuperField;
+
+        // One member of a Children chain, from its Name through the UProperty Offset. Functions,
+        // consts and structs share the chain; only the Name and Next of those are meaningful.
+        // A member whose full block can't be read (a small UConst or UEnum at the end of a
+        // mapped region) is read again up to Next, so the chain goes on past it.
+        constexpr uintptr_t MemberBegin = UObject::Offset_Name;
+        constexpr uintptr_t MemberEnd = UProperty::Offset_Offset + sizeof(int32_t);
+        constexpr size_t MemberLinkSize = UField::Offset_Next + sizeof(uintptr_t) - MemberBegin;
+        static_assert(UField::Offset_Next > MemberBegin && UField::Offset_Next + sizeof(uintptr_t) <= MemberEnd,
+                      "MemberBlock covers Next");
+        struct MemberBlock {
+            uint8_t Bytes[MemberEnd - MemberBegin];
+
+            template<typename T>
+            T At(uintptr_t offset) const {
+                T value;
+                std::memcpy(&value, Bytes + (offset - MemberBegin), sizeof(T));
+                return value;
+            }
+        };
+
+        struct Struct {
+            uintptr_t Address = 0;
+            size_t Super = SIZE_MAX;    // Index in 'structs', SIZE_MAX for none
+            uintptr_t Cursor = 0;       // Next member to read; 0 once the chain is done
+            size_t Visited = 0;
+            uint32_t PropertySize = 0;
+            uint32_t Owners = 0;        // Bit per FieldOwner whose class is this struct or derives from it
+        };
+    }
+
+    FieldOffsetReport ResolveFieldOffsets(const MemoryManager& pm, const GNameTable& gnames, const GObjectsTable& gobjects, bool apply) {
+        ReadScope scope(ReadCategory::GObjects);
+        const auto start = std::chrono::steady_clock::now();
+        FieldOffsetReport report;
+
+        // --- The owner classes, then their supers one level at a time ---
+        std::vector<Struct> structs;
+        std::unordered_map<uintptr_t, size_t> structIndex;
+        std::array<size_t, OwnerCount> ownerStructs;
+        ownerStructs.fill(SIZE_MAX);
+        std::vector<size_t> level;
+        auto addStruct = [&](uintptr_t address) -> std::pair<size_t, bool> {
+            auto [it, inserted] = structIndex.emplace(address, structs.size());
+            if (inserted) {
+                Struct added;
+                added.Address = address;
+                structs.push_back(added);
+            }
+            return { it->second, inserted };
+        };
+        for (size_t owner = 0; owner < OwnerCount; ++owner) {
+            const UClass ownerClass = gobjects.FindStaticClass(OwnerClasses[owner]);
+            if (!ownerClass.IsValid()) {
+                VUTRIUM_LOG(LogFormat::FieldOffsetClassMissing, OwnerClasses[owner].FullName, OwnerNames[owner]);
+                continue;
+            }
+            const auto [index, inserted] = addStruct(ownerClass.Address);
+            ownerStructs[owner] = index;
+            if (inserted) level.push_back(index);
+        }
+
+        std::vector<StructHeader> headers;
+        std::vector<MemoryManager::ScatterRead> reads;
+        std::vector<size_t> nextLevel;
+        for (int32_t depth = 0; !level.empty() && depth < MaxSuperDepth; ++depth) {
+            headers.assign(level.size(), StructHeader{});
+            reads.resize(level.size());
+            for (size_t i = 0; i < level.size(); ++i) {
+                reads[i] = { structs[level[i]].Address + UStruct::Offset_SuperField, &headers[i], StructHeaderSize, false };
+            }
+            pm.ReadScatter(reads.data(), reads.size());
+            ++report.Batches;
+
+            nextLevel.clear();
+            for (size_t i = 0; i < level.size(); ++i) {
+                if (!reads[i].Success) continue;
+                structs[level[i]].Cursor = headers[i].Children;
+                structs[level[i]].PropertySize = headers[i].PropertySize;
+                if (headers[i].SuperField == 0) continue;
+                const auto [super, inserted] = addStruct(headers[i].SuperField);
+                structs[level[i]].Super = super;
+                if (inserted) nextLevel.push_back(super);
+            }
+            level.swap(nextLevel);
+        }
+        report.StructsWalked = structs.size();
+
+        // Every struct an owner's class inherits from gets the owner's bit.
+        for (size_t owner = 0; owner < OwnerCount; ++owner) {
+            int32_t depth = 0;
+            for (size_t index = ownerStructs[owner]; index != SIZE_MAX && depth < MaxSuperDepth; index = structs[index].Super, ++depth) {
+                structs[index].Owners |= 1u << owner;
+            }
+        }
+
+        // --- Property names, as FName ids sorted for lookup by the member walk ---
+        std::vector<std::pair<int32_t, size_t>> wanted; // (name id, field)
+        wanted.reserve(FieldCount);
+        for (size_t field = 0; field < FieldCount; ++field) {
+            if (ownerStructs[static_cast<size_t>(FieldOwners[field])] == SIZE_MAX) continue;
+            const int32_t nameId = gnames.FindNameId(GetFieldInfo(static_cast<FieldId>(field)).Property);
+            if (nameId != GNameTable::InvalidNameId) wanted.emplace_back(nameId, field);
+        }
+        std::sort(wanted.begin(), wanted.end());
+
+        // --- Every struct's Children/Next chain in lockstep, one scatter read per step ---
+        std::array<bool, FieldCount> found{};
+        std::array<int32_t, FieldCount> elementSizes{};
+        std::array<size_t, FieldCount> foundIn{};  // Index in 'structs' of the class that declares it
+        std::vector<ChainPosition> positions;
+        positions.reserve(FieldCount);
+        size_t remaining = wanted.size();
+        std::vector<size_t> active;
+        for (size_t index = 0; index < structs.size(); ++index) {
+            if (structs[index].Cursor != 0 && structs[index].Owners != 0) active.push_back(index);
+        }
+        std::vector<MemberBlock> blocks;
+        std::vector<size_t> retried;                        // Indices in 'active' whose block read failed
+        std::vector<MemoryManager::ScatterRead> retryReads; // Their Name..Next reads
+        while (!active.empty() && remaining > 0) {
+            blocks.resize(active.size());
+            reads.resize(active.size());
+            for (size_t i = 0; i < active.size(); ++i) {
+                reads[i] = { structs[active[i]].Cursor + MemberBegin, &blocks[i], sizeof(MemberBlock), false };
+            }
+            pm.ReadScatter(reads.data(), reads.size());
+            ++report.Batches;
+
+            retried.clear();
+            retryReads.clear();
+            for (size_t i = 0; i < active.size(); ++i) {
+                if (reads[i].Success) continue;
+                reads[i].Size = MemberLinkSize;
+                retried.push_back(i);
+                retryReads.push_back(reads[i]);
+            }
+            if (!retried.empty()) {
+                pm.ReadScatter(retryReads.data(), retryReads.size());
+                ++report.Batches;
+                for (size_t r = 0; r < retried.size(); ++r) reads[retried[r]].Success = retryReads[r].Success;
+            }
+
+            size_t kept = 0;
+            for (size_t i = 0; i < active.size(); ++i) {
+                Struct& owner = structs[active[i]];
+                if (!reads[i].Success) continue; // Not even Next is readable; the chain ends here
+                ++report.MembersVisited;
+
+                // Only Name and Next came back for a retried member: not a property we can use.
+                const int32_t nameId = blocks[i].At<int32_t>(UObject::Offset_Name);
+                auto match = std::lower_bound(wanted.begin(), wanted.end(), std::make_pair(nameId, size_t(0)));
+                for (; reads[i].Size != MemberLinkSize && match != wanted.end() && match->first == nameId; ++match) {
+                    const size_t field = match->second;
+                    if (found[field] || (owner.Owners & (1u << static_cast<size_t>(FieldOwners[field]))) == 0) continue;
+                    found[field] = true;
+                    report.GameOffset[field] = blocks[i].At<int32_t>(UProperty::Offset_Offset);
+                    elementSizes[field] = blocks[i].At<int32_t>(UProperty::Offset_ElementSize);
+                    foundIn[field] = active[i];
+                    positions.push_back({ active[i], owner.Visited, field });
+                    --remaining;
+                }
+
+                owner.Cursor = blocks[i].At<uintptr_t>(UField::Offset_Next);
+                if (owner.Cursor != 0 && ++owner.Visited < MaxChainLength) active[kept++] = active[i];
+            }
+            active.resize(kept);
+        }
+
+        // --- Verdicts ---
+        for (size_t field = 0; field < FieldCount; ++field) {
+            const FieldInfo& info = GetFieldInfo(static_cast<FieldId>(field));
+            const size_t ownerStruct = ownerStructs[static_cast<size_t>(FieldOwners[field])];
+            FieldOffsetStatus& status = report.Status[field];
+            const int32_t gameOffset = report.GameOffset[field];
+
+            if (!found[field]) {
+                status = FieldOffsetStatus::Missing;
+                ++report.Missing;
+            }
+            else if (gameOffset < 0 || elementSizes[field] < static_cast<int32_t>(info.Size)
+                     || (structs[ownerStruct].PropertySize != 0
+                         && static_cast<uint64_t>(gameOffset) + info.Size > structs[ownerStruct].PropertySize)) {
+                status = FieldOffsetStatus::Rejected;
+                ++report.Rejected;
+            }
+            else if (static_cast<uintptr_t>(gameOffset) == info.DefaultOffset) {
+                status = FieldOffsetStatus::Verified;
+                ++report.Verified;
+            }
+            else {
+                status = FieldOffsetStatus::Moved;
+                ++report.Moved;
+            }
+        }
+
+        // --- Layout checks ---
+        // A wrong UProperty::Offset_Offset or Offset_ElementSize guess reads some other int32 for
+        // every property. How many fields kept their defaults says nothing about that: a member
+        // added to a base class moves every field derived from it. So the layout is judged on its
+        // structure, and one failed check keeps every default.
+        auto usable = [&](size_t field) {
+            return report.Status[field] == FieldOffsetStatus::Verified || report.Status[field] == FieldOffsetStatus::Moved;
+        };
+        const char* layoutProblem = nullptr;
+        size_t problemField = static_cast<size_t>(AnchorField);
+        const size_t anchor = static_cast<size_t>(AnchorField);
+        if (!usable(anchor)) {
+            layoutProblem = "anchor property missing or rejected";
+        }
+        else if (const size_t super = structs[foundIn[anchor]].Super;
+                 super != SIZE_MAX && static_cast<uint32_t>(report.GameOffset[anchor]) < structs[super].PropertySize) {
+            layoutProblem = "anchor property inside its super class's members";
+        }
+        for (size_t field = 0; field < FieldCount && layoutProblem == nullptr; ++field) {
+            if (usable(field) && report.GameOffset[field] % RequiredAlignment(elementSizes[field]) != 0) {
+                layoutProblem = "offset not aligned to its element size";
+                problemField = field;
+            }
+        }
+        // Properties are linked in declaration order, so offsets never decrease along a chain
+        // (bitfield bools share one).
+        std::sort(positions.begin(), positions.end(), [](const ChainPosition& a, const ChainPosition& b) {
+            return a.Struct != b.Struct ? a.Struct < b.Struct : a.Visited < b.Visited;
+        });
+        const ChainPosition* previous = nullptr;
+        for (const ChainPosition& position : positions) {
+            if (layoutProblem != nullptr) break;
+            if (!usable(position.Field)) continue;
+            if (previous != nullptr && previous->Struct == position.Struct
+                && report.GameOffset[position.Field] < report.GameOffset[previous->Field]) {
+                layoutProblem = "offset below an earlier member of its Children chain";
+                problemField = position.Field;
+            }
+            previous = &position;
+        }
+        report.LayoutRejected = layoutProblem != nullptr;
+        if (report.LayoutRejected) {
+            const FieldInfo& info = GetFieldInfo(static_cast<FieldId>(problemField));
+            VUTRIUM_LOG(LogFormat::FieldOffsetLayoutRejected, info.Owner, info.Name, info.Property,
+                        Logger::Hex(static_cast<uint32_t>(report.GameOffset[problemField])), layoutProblem);
+        }
+
+        for (size_t field = 0; field < FieldCount; ++field) {
+            const FieldInfo& info = GetFieldInfo(static_cast<FieldId>(field));
+            const FieldOffsetStatus status = report.Status[field];
+            const int32_t gameOffset = report.GameOffset[field];
+            if (!report.LayoutRejected) {
+                if (status == FieldOffsetStatus::Missing && ownerStructs[static_cast<size_t>(FieldOwners[field])] != SIZE_MAX) {
+                    // A missing class was reported above
+                    VUTRIUM_LOG(LogFormat::FieldOffsetMissing, info.Owner, info.Name, info.Property, Logger::Hex(info.DefaultOffset));
+                }
+                else if (status == FieldOffsetStatus::Rejected) {
+                    VUTRIUM_LOG(LogFormat::FieldOffsetRejected, info.Owner, info.Name, info.Property,
+                                Logger::Hex(static_cast<uint32_t>(gameOffset)), elementSizes[field], info.Size, Logger::Hex(info.DefaultOffset));
+                }
+                else if (status == FieldOffsetStatus::Moved) {
+                    VUTRIUM_LOG(LogFormat::FieldOffsetMoved, info.Owner, info.Name, info.Property,
+                                Logger::Hex(static_cast<uint32_t>(gameOffset)), Logger::Hex(info.DefaultOffset));
+                }
+            }
+
+            if (apply) {
+                const bool useGame = !report.LayoutRejected && status == FieldOffsetStatus::Moved;
+                FieldOffsets[field] = useGame ? static_cast<uintptr_t>(gameOffset) : info.DefaultOffset;
+            }
+        }
+
+        report.Milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        VUTRIUM_LOG(LogFormat::FieldOffsetsChecked, FieldCount, report.Milliseconds, report.Verified, report.Moved,
+                    report.Rejected, report.Missing, report.StructsWalked, report.MembersVisited);
+        return report;
+    }
+
+} // namespace SDK
@@ -0,0 +1,56 @@
+#ifndef FIELD_OFFSET_RESOLVER_H
+#define FIELD_OFFSET_RESOLVER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "MemoryManager.h"
+#include "Objects.hpp"
+
+class GNameTable;
+class GObjectsTable;
+
+namespace SDK {
+
+    // What the game's reflection data says about one manifest field.
+    enum class FieldOffsetStatus : uint8_t {
+        Missing,   // Property (or its owner's class) not found; the default is kept
+        Verified,  // Found at the default offset
+        Moved,     // Found at another offset; used instead of the default when applied
+        Rejected,  // Found, but its element size or offset can't be what the SDK reads; the default is kept
+    };
+
+    struct FieldOffsetReport {
+        static constexpr size_t FieldCount = static_cast<size_t>(FieldId::Count);
+
+        std::array<FieldOffsetStatus, FieldCount> Status{};
+        std::array<int32_t, FieldCount> GameOffset{};       // UProperty::Offset, when found
+        size_t Verified = 0;
+        size_t Moved = 0;
+        size_t Rejected = 0;
+        size_t Missing = 0;
+        bool LayoutRejected = false;  // A layout check failed; every default kept
+        size_t StructsWalked = 0;   // The owner classes and their supers
+        size_t MembersVisited = 0;  // Children/Next entries read
+        size_t Batches = 0;         // ReadScatter calls
+        double Milliseconds = 0.0;
+    };
+
+    // Looks every manifest field up by property name in its owner's class and that class's
+    // supers (VUTRIUM_FIELD_OWNERS in ObjectFields.h) and compares the UProperty's Offset with
+    // the default. All the classes are walked together: one scatter read per SuperField level,
+    // then one per step down the Children/Next chains, covering every chain still being walked,
+    // until every field is found or the chains end. A property whose ElementSize is smaller than
+    // the SDK's read, or that runs past its class's PropertySize, is rejected rather than trusted.
+    // If the found offsets don't look like a class layout (the anchor property outside Actor's own
+    // members, an offset misaligned for its element size, or offsets going backwards along a
+    // Children chain), the UProperty layout itself is taken to be wrong (LayoutRejected) and no
+    // game offset is used. With 'apply', FieldOffsets is set from the result (moved fields get
+    // the game's offset, everything else its default). Mismatches are logged. Call once
+    // GObjectsTable is initialized and before any thread reads fields.
+    FieldOffsetReport ResolveFieldOffsets(const MemoryManager& pm, const GNameTable& gnames, const GObjectsTable& gobjects,
+                                          bool apply = true);
+
+} // namespace SDK
+
+#endif // FIELD_OFFSET_RESOLVER_H
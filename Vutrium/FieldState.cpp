@@ -0,0 +1,105 @@
+#include "Objects.hpp"
+
+#include <algorithm>
+
+// Boost pad bookkeeping that doesn't touch game memory, kept out of Objects.cpp so the
+// headless replay tool can link it without the rest of the SDK.
+namespace SDK {
+    // --- BoostPadState Method Definitions ---
+    void BoostPadState::Reset() {
+        IsActive = true;
+        PickedUpGameTime = -1.0f; // Not timed
+    }
+
+    float BoostPadState::RespawnTimeSeconds() const {
+        return IsBigPad ? 10.0f : 4.0f; // Big pads take 10 seconds, small pads take 4 seconds
+    }
+
+    std::optional<float> BoostPadState::GetElapsedSeconds(float gameTime) const {
+        // If we don't have a pickup time, return nullopt
+        if (PickedUpGameTime < 0.0f) {
+            return std::nullopt;
+        }
+        return std::max(0.0f, gameTime - PickedUpGameTime);
+    }
+
+    std::optional<float> BoostPadState::GetRemainingSeconds(float gameTime) const {
+        auto elapsed = GetElapsedSeconds(gameTime);
+        if (!elapsed) {
+            return std::nullopt;
+        }
+        
+        // Calculate remaining time
+        float respawnTime = RespawnTimeSeconds();
+        float remaining = respawnTime - *elapsed;
+        return std::max(0.0f, remaining); // Don't return negative time
+    }
+
+    void BoostPadState::MarkInactive(float gameTime) {
+        IsActive = false;
+        PickedUpGameTime = gameTime;
+    }
+
+    void BoostPadState::ApplyPickedUp(bool isPickedUp, float gameTime) {
+        // The pickup flag is authoritative; the timestamp only drives the countdown
+        if (IsActive && isPickedUp) {
+            MarkInactive(gameTime);
+        }
+        else if (!IsActive && !isPickedUp) {
+            Reset();
+        }
+    }
+
+    // --- FieldState Method Definitions ---
+    void FieldState::ResetBoostPads() {
+        for (auto& pad : BoostPads) {
+            pad.Reset();
+        }
+    }
+
+    BoostPadState* FieldState::FindPadByLocation(const Vector3D& location, float tolerance) {
+        for (auto& pad : BoostPads) {
+            if (pad.Location.DistanceTo(location) <= tolerance) {
+                return &pad;
+            }
+        }
+        return nullptr;
+    }
+
+    int FieldState::FindNearestPadIndex(const Vector3D& location, float tolerance) const {
+        int nearest = -1;
+        float nearestDistance = tolerance;
+        for (size_t i = 0; i < BoostPads.size(); ++i) {
+            float distance = BoostPads[i].Location.DistanceTo(location);
+            if (distance <= nearestDistance) {
+                nearestDistance = distance;
+                nearest = static_cast<int>(i);
+            }
+        }
+        return nearest;
+    }
+
+    BoostPadState* FieldState::FindPadByActorAddress(uintptr_t actorAddress) {
+        for (auto& pad : BoostPads) {
+            if (pad.PickupActorAddress == actorAddress) {
+                return &pad;
+            }
+        }
+        return nullptr;
+    }
+
+    uint64_t FieldState::GetActiveMask() const {
+        uint64_t mask = 0;
+        for (size_t i = 0; i < BoostPads.size() && i < 64; ++i) {
+            if (BoostPads[i].IsActive) mask |= uint64_t(1) << i;
+        }
+        return mask;
+    }
+
+    void FieldState::ApplyActiveMask(uint64_t activeMask, float gameTime) {
+        GameTime = gameTime;
+        for (size_t i = 0; i < BoostPads.size() && i < 64; ++i) {
+            BoostPads[i].ApplyPickedUp(((activeMask >> i) & 1) == 0, gameTime);
+        }
+    }
+}
@@ -0,0 +1,17 @@
+#include "FrameModel.h"
+
+void FrameModel::CapturePads(const SDK::FieldState& field) {
+    GameTime = field.GameTime;
+    PadActiveMask = field.GetActiveMask();
+    PadTimers.clear();
+    for (const auto& pad : field.BoostPads) {
+        if (pad.IsActive) continue;
+        if (auto remaining = pad.GetRemainingSeconds(field.GameTime)) {
+            PadTimer timer;
+            timer.Location = { pad.Location.X, pad.Location.Y, pad.Location.Z };
+            timer.IsBigPad = pad.IsBigPad;
+            timer.RemainingSeconds = *remaining;
+            PadTimers.push_back(timer);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef FRAME_MODEL_H
+#define FRAME_MODEL_H
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Objects.hpp"
+#include "BallPredictor.h"
+
+// Snapshot of everything the overlay draws, captured off the render thread.
+// Once published a FrameModel is never modified, so hkPresent can read it without locks.
+struct FrameModel {
+    struct CarInfo {
+        uintptr_t Address = 0;
+        SDK::FVectorData Location;
+        SDK::FVectorData Velocity;
+        SDK::FRotatorData Rotation;
+        bool HasBoost = false;
+        float BoostAmount = 0.0f;
+        int32_t TeamIndex = -1;            // -1 when the PRI/team isn't available
+        SDK::FColorData TeamColor;
+        std::string Name;
+    };
+
+    struct PadTimer {
+        SDK::FVectorData Location;
+        bool IsBigPad = false;
+        float RemainingSeconds = 0.0f;
+    };
+
+    uint64_t Sequence = 0;
+    std::chrono::steady_clock::time_point CapturedAt;
+    double BuildMicroseconds = 0.0;
+    size_t CachedLinks = 0;                // Pointer links the FrameWorker served from its PointerCache
+
+    uintptr_t GameEventAddress = 0;
+    std::string Error;                     // Set when the frame couldn't be fully captured
+
+    bool HasBall = false;
+    BallPredictor::BallState Ball;
+    std::vector<BallPredictor::Slice> Prediction;
+
+    bool HasCamera = false;
+    SDK::FVectorData CameraLocation;
+    SDK::FRotatorData CameraRotation;
+    float CameraFOV = 90.0f;
+
+    std::vector<CarInfo> Cars;
+    int LocalCarIndex = -1;
+
+    float GameTime = 0.0f;                 // Clock the pad timers run on (FieldState::GameTime)
+    uint64_t PadActiveMask = 0;            // Bit i set when FieldState::BoostPads[i] is available
+    std::vector<PadTimer> PadTimers;
+
+    bool InMatch() const { return GameEventAddress != 0; }
+    bool CanDraw() const { return HasBall && HasCamera; }
+    const CarInfo* GetLocalCar() const { return LocalCarIndex >= 0 ? &Cars[LocalCarIndex] : nullptr; }
+
+    // Fills GameTime, PadActiveMask and PadTimers from the tracked field state.
+    void CapturePads(const SDK::FieldState& field);
+};
+
+#endif // FRAME_MODEL_H
@@ -0,0 +1,216 @@
+#include "FrameWorker.h"
+#include "RLSDK.h"
+#include "Logger.h"
+#include "MatchRecorder.h"
+#include "ReadStats.h"
+
+FrameWorker::~FrameWorker() {
+    // Joining here could run under the loader lock (global destructor on DLL detach),
+    // so a worker that wasn't stopped explicitly is just told to exit and let go.
+    running_ = false;
+    if (thread_.joinable()) {
+        thread_.detach();
+    }
+}
+
+void FrameWorker::Start(RLSDK* sdk, const BallPredictor* predictor, SDK::FieldState* fieldState) {
+    if (running_.load()) return;
+
+    sdk_ = sdk;
+    predictor_ = predictor;
+    fieldState_ = fieldState;
+
+    running_ = true;
+    thread_ = std::thread(&FrameWorker::Run, this);
+    VUTRIUM_LOG_INFO("FrameWorker: Started.");
+}
+
+void FrameWorker::Stop() {
+    if (!running_.exchange(false)) return;
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    VUTRIUM_LOG_INFO("FrameWorker: Stopped.");
+}
+
+std::shared_ptr<const FrameModel> FrameWorker::GetLatest() const {
+    std::lock_guard<std::mutex> lock(latestMutex_);
+    return latest_;
+}
+
+void FrameWorker::Publish(std::shared_ptr<FrameModel> model) {
+    model->Sequence = ++sequence_;
+    std::shared_ptr<const FrameModel> published = std::move(model);
+
+    std::lock_guard<std::mutex> lock(latestMutex_);
+    latest_.swap(published);
+    // The previous model (now in 'published') is released after the lock, outside the render thread.
+}
+
+void FrameWorker::Run() {
+    auto nextCapture = std::chrono::steady_clock::now();
+    auto lastReadStatsLog = nextCapture;
+    ReadStats::Snapshot lastReadStats;
+    while (running_.load(std::memory_order_relaxed)) {
+        nextCapture += DefaultPeriod;
+
+        if (enabled_.load(std::memory_order_relaxed) && sdk_) {
+            try {
+                std::shared_ptr<FrameModel> model = Capture();
+                Publish(model);
+                if (MatchRecorder* recorder = recorder_.load(std::memory_order_relaxed)) {
+                    recorder->Append(*model);
+                }
+            }
+            catch (const std::exception& e) {
+                auto model = std::make_shared<FrameModel>();
+                model->Error = std::string("Capture exception: ") + e.what();
+                Publish(std::move(model));
+            }
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if constexpr (ReadStats::Enabled) {
+            std::chrono::duration<double> sinceLog = now - lastReadStatsLog;
+            if (sinceLog.count() >= ReadStats::LogIntervalSeconds) {
+                ReadStats::Snapshot current = ReadStats::Collect();
+                std::string summary = ReadStats::FormatSummary(current.Since(lastReadStats), sinceLog.count());
+                if (!summary.empty()) {
+                    VUTRIUM_LOG_INFO("ReadStats: " + summary);
+                }
+                lastReadStats = current;
+                lastReadStatsLog = now;
+            }
+        }
+
+        if (nextCapture < now) {
+            nextCapture = now; // Fell behind (or was idle); don't try to catch up
+        }
+        std::this_thread::sleep_until(nextCapture);
+    }
+}
+
+std::shared_ptr<FrameModel> FrameWorker::Capture() {
+    ReadScope readScope(ReadCategory::Frame);
+    auto captureStart = std::chrono::steady_clock::now();
+    auto model = std::make_shared<FrameModel>();
+    model->CapturedAt = captureStart;
+
+    SDK::AGameEvent ge = sdk_->GetCurrentGameEvent();
+    if (fieldState_) {
+        padTracker_.Update(*sdk_, ge, *fieldState_);
+    }
+    const MemoryManager& mem = sdk_->GetMemoryManager();
+    links_.BeginFrame(mem, ge.Address);
+    if (!ge.IsValid()) {
+        model->Error = "GameEvent Not Found (Not in match?)";
+        return model;
+    }
+    model->GameEventAddress = ge.Address;
+    if (ge.Address != nameCacheGameEvent_) {
+        // A new match can reuse a name buffer (same pointer and length) for a different name.
+        nameCache_.Clear();
+        nameCacheGameEvent_ = ge.Address;
+    }
+
+    auto balls = ge.GetBalls(mem);
+    SDK::ActorMotionSnapshot ballMotion;
+    if (!balls.empty() && ballMotion.Read(mem, balls[0].Address)) {
+        SDK::FVectorData loc = ballMotion.Get<SDK::AActor::Location>();
+        SDK::FVectorData vel = ballMotion.Get<SDK::AActor::Velocity>();
+        SDK::FVectorData angVel = ballMotion.Get<SDK::AActor::AngularVelocity>();
+        model->Ball.Location = { loc.X, loc.Y, loc.Z };
+        model->Ball.Velocity = { vel.X, vel.Y, vel.Z };
+        model->Ball.AngularVelocity = { angVel.X, angVel.Y, angVel.Z };
+        model->HasBall = true;
+    }
+    else {
+        model->Error = "Ball not found or invalid";
+    }
+
+    uintptr_t localPRIAddress = 0;
+    auto localPlayers = ge.GetLocalPlayers(mem);
+    if (!localPlayers.empty() && localPlayers[0].IsValid()) {
+        SDK::APlayerController pc = localPlayers[0];
+        SDK::APRI pri = links_.Resolve<SDK::APlayerController::PlayerReplicationInfo>(mem, pc.Address);
+        if (pri.IsValid()) {
+            localPRIAddress = pri.Address;
+            SDK::ACameraSettingsActor settingsActor = links_.Resolve<SDK::APRI::CameraSettings>(mem, pri.Address);
+            if (auto settings = settingsActor.GetProfileSettings(mem)) {
+                model->CameraFOV = settings->FOV;
+            }
+        }
+
+        SDK::ACamera camera = links_.Resolve<SDK::APlayerController::PlayerCamera>(mem, pc.Address);
+        SDK::FieldSnapshot<SDK::AActor::Location, SDK::AActor::Rotation> view;
+        if (view.Read(mem, camera.Address)) {
+            model->CameraLocation = view.Get<SDK::AActor::Location>();
+            model->CameraRotation = view.Get<SDK::AActor::Rotation>();
+            model->HasCamera = true;
+        }
+        else if (model->Error.empty()) {
+            model->Error = "PlayerCamera actor not found or invalid";
+        }
+    }
+    else if (model->Error.empty()) {
+        model->Error = "Local player controller not found or invalid";
+    }
+
+    // Every car's motion comes from one scatter read; the view has no null entries.
+    auto cars = ge.GetCars(mem);
+    carMotion_.resize(cars.size());
+    SDK::ReadFieldSnapshots(mem, cars.Data(), carMotion_.data(), cars.size(), motionReads_);
+    model->Cars.reserve(cars.size());
+    for (size_t i = 0; i < cars.size(); ++i) {
+        const SDK::ACar car = cars[i];
+        const SDK::ActorMotionSnapshot& motion = carMotion_[i];
+        if (!motion.IsValid()) continue;
+
+        FrameModel::CarInfo info;
+        info.Address = car.Address;
+        info.Location = motion.Get<SDK::AActor::Location>();
+        info.Velocity = motion.Get<SDK::AActor::Velocity>();
+        info.Rotation = motion.Get<SDK::AActor::Rotation>();
+
+        // The links are cached for the match; only the leaf values below are read every frame.
+        SDK::UBoostComponent boost = links_.Resolve<SDK::AVehicle::BoostComponent>(mem, car.Address);
+        if (boost.IsValid()) {
+            info.HasBoost = true;
+            info.BoostAmount = boost.GetAmount(mem);
+        }
+
+        SDK::APRI pri = links_.Resolve<SDK::AVehicle::PRI>(mem, car.Address);
+        if (pri.IsValid()) {
+            info.Name = pri.GetPlayerName(mem, nameCache_);
+
+            SDK::ATeamInfo team = links_.Resolve<SDK::APRI::TeamInfo>(mem, pri.Address);
+            SDK::FieldSnapshot<SDK::ATeamInfo::TeamIndex, SDK::ATeamInfo::TeamColor> teamState;
+            if (teamState.Read(mem, team.Address)) {
+                info.TeamIndex = teamState.Get<SDK::ATeamInfo::TeamIndex>();
+                info.TeamColor = teamState.Get<SDK::ATeamInfo::TeamColor>();
+            }
+
+            if (localPRIAddress != 0 && pri.Address == localPRIAddress) {
+                model->LocalCarIndex = static_cast<int>(model->Cars.size());
+            }
+        }
+
+        model->Cars.push_back(std::move(info));
+    }
+    // Without a local PRI the first car is assumed to be ours, as the overlay always did.
+    if (localPRIAddress == 0 && !model->Cars.empty()) {
+        model->LocalCarIndex = 0;
+    }
+
+    if (fieldState_) {
+        model->CapturePads(*fieldState_);
+    }
+
+    if (model->HasBall && predictor_ && predictionEnabled_.load(std::memory_order_relaxed)) {
+        predictor_->Predict(model->Ball, model->Prediction);
+    }
+
+    model->CachedLinks = links_.GetEntryCount();
+    model->BuildMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - captureStart).count();
+    return model;
+}
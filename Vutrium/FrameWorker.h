@@ -0,0 +1,68 @@
+#ifndef FRAME_WORKER_H
+#define FRAME_WORKER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "FrameModel.h"
+#include "BoostPadTracker.h"
+#include "Objects.hpp"
+#include "PointerCache.h"
+
+class RLSDK;
+class MatchRecorder;
+
+// Background thread that reads game memory and publishes a new FrameModel roughly once
+// per physics tick. All memory reads that used to happen inside hkPresent live here.
+class FrameWorker {
+public:
+    static constexpr std::chrono::microseconds DefaultPeriod{ 8333 }; // 120 Hz
+
+    FrameWorker() = default;
+    ~FrameWorker();
+    FrameWorker(const FrameWorker&) = delete; FrameWorker& operator=(const FrameWorker&) = delete;
+
+    void Start(RLSDK* sdk, const BallPredictor* predictor, SDK::FieldState* fieldState);
+    void Stop();
+    bool IsRunning() const { return running_.load(std::memory_order_relaxed); }
+
+    // Capturing is skipped entirely while nothing on screen needs it.
+    void SetEnabled(bool enabled) { enabled_.store(enabled, std::memory_order_relaxed); }
+    void SetPredictionEnabled(bool enabled) { predictionEnabled_.store(enabled, std::memory_order_relaxed); }
+    // Every published model is also appended to 'recorder' (may be null to stop).
+    void SetRecorder(MatchRecorder* recorder) { recorder_.store(recorder, std::memory_order_relaxed); }
+
+    // Latest published model; never null once Start() has been called.
+    std::shared_ptr<const FrameModel> GetLatest() const;
+
+private:
+    void Run();
+    std::shared_ptr<FrameModel> Capture();
+    void Publish(std::shared_ptr<FrameModel> model);
+
+    RLSDK* sdk_ = nullptr;
+    const BallPredictor* predictor_ = nullptr;
+    SDK::FieldState* fieldState_ = nullptr;
+    BoostPadTracker padTracker_;           // Sole writer of *fieldState_ while running
+    SDK::FStringCache nameCache_;          // Player names; dropped whenever the GameEvent changes
+    uintptr_t nameCacheGameEvent_ = 0;
+    SDK::PointerCache links_;              // car -> PRI -> TeamInfo, car -> BoostComponent, PC -> camera
+    std::vector<SDK::ActorMotionSnapshot> carMotion_;     // Staging: every car's motion, one scatter read
+    std::vector<MemoryManager::ScatterRead> motionReads_; // Staging
+
+    std::thread thread_;
+    std::atomic<bool> running_ = false;
+    std::atomic<bool> enabled_ = false;
+    std::atomic<bool> predictionEnabled_ = false;
+    std::atomic<MatchRecorder*> recorder_ = nullptr;
+
+    mutable std::mutex latestMutex_;
+    std::shared_ptr<const FrameModel> latest_ = std::make_shared<FrameModel>();
+    uint64_t sequence_ = 0;
+};
+
+#endif // FRAME_WORKER_H
@@ -1,13 +1,20 @@
 #include "GNameTable.h"
 #include "Objects.hpp" // Include full Objects.hpp here for SDK::TArrayLayout definition
+#include "ReadStats.h"
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <cstring>
 
 GNameTable::GNameTable() : gnamesArrayAddress_(0), initialized_(false) {}
 
 bool GNameTable::Initialize(const MemoryManager& pm, uintptr_t moduleBase, uintptr_t gnamesOffset) {
+    ReadScope readScope(ReadCategory::GNames);
     initialized_ = false;
-    names_.clear();
+    arena_.clear();
+    slots_.clear();
+    nameCount_ = 0;
+    idBuckets_.clear();
     if (!pm.IsAttached() || moduleBase == 0 || gnamesOffset == 0) return false;
 
     gnamesArrayAddress_ = moduleBase + gnamesOffset;
@@ -18,88 +25,157 @@ bool GNameTable::Initialize(const MemoryManager& pm, uintptr_t moduleBase, uintp
     SDK::TArrayLayout layout = *layoutOpt;
     if (layout.ArrayData == 0 || layout.ArrayCount <= 0 || layout.ArrayCount > 500000) { gnamesArrayAddress_ = 0; return false; }
 
-    names_.reserve(static_cast<size_t>(layout.ArrayCount));
-    constexpr size_t pointerSize = sizeof(uintptr_t);
-    int successfulLoads = 0;
-
-    for (int32_t i = 0; i < layout.ArrayCount; ++i) {
-        uintptr_t entryPtrAddress = layout.ArrayData + i * pointerSize;
-        auto entryPtrOpt = pm.Read<uintptr_t>(entryPtrAddress);
-        if (!entryPtrOpt || *entryPtrOpt == 0) continue;
-        uintptr_t entryAddress = *entryPtrOpt;
-
-        // Read the index from the entry for validation using the offset defined in FNameEntry
-        auto indexOpt = pm.Read<int32_t>(entryAddress + SDK::FNameEntry::Offset_IndexInEntry);
-        if (!indexOpt) continue;
-        
-        // CRITICAL CHECK: Validate index matches expected slot index
-        int32_t readIndex = *indexOpt;
-        if (readIndex != i) continue;  // Skip if index doesn't match (corrupted/reallocated entry)
-        
-        std::optional<std::string> nameOpt = ReadNameString(pm, entryAddress);
-        if (nameOpt && !nameOpt->empty()) {
-            names_[i] = *nameOpt;
-            successfulLoads++;
+    static_assert(SDK::FNameEntry::IsWideChar, "Names are converted from UTF-16");
+    static_assert(SDK::FNameEntry::Offset_StringData > SDK::FNameEntry::Offset_IndexInEntry, "Index must precede the string");
+    constexpr size_t windowStringOffset = SDK::FNameEntry::Offset_StringData - SDK::FNameEntry::Offset_IndexInEntry;
+    constexpr size_t windowSize = windowStringOffset + WindowChars * sizeof(char16_t);
+
+    slots_.resize(static_cast<size_t>(layout.ArrayCount));
+    arena_.reserve(static_cast<size_t>(layout.ArrayCount) * 16);
+
+    // Per chunk: one bulk read of the entry pointers, then one scatter read covering each entry's
+    // index and its first WindowChars characters. Entries sit close together, so the scatter read
+    // mostly collapses into a few large reads. Only names longer than the window get a read of their own.
+    std::vector<uintptr_t> entries(ReadChunkSize);
+    std::vector<uint8_t> windows(ReadChunkSize * windowSize);
+    std::vector<MemoryManager::ScatterRead> reads;
+    std::vector<int32_t> readIndices;
+    std::vector<char16_t> longName(SDK::FNameEntry::MaxNameLength);
+    reads.reserve(ReadChunkSize);
+    readIndices.reserve(ReadChunkSize);
+
+    for (int32_t begin = 0; begin < layout.ArrayCount; begin += ReadChunkSize) {
+        const int32_t count = (std::min)(ReadChunkSize, layout.ArrayCount - begin);
+        if (!pm.ReadBytes(layout.ArrayData + static_cast<uintptr_t>(begin) * sizeof(uintptr_t),
+                          entries.data(), static_cast<size_t>(count) * sizeof(uintptr_t))) {
+            continue; // Unreadable stretch of the pointer array; those names stay missing
+        }
+
+        reads.clear();
+        readIndices.clear();
+        for (int32_t i = 0; i < count; ++i) {
+            if (entries[i] == 0) continue;
+            MemoryManager::ScatterRead read;
+            read.Address = entries[i] + SDK::FNameEntry::Offset_IndexInEntry;
+            read.Buffer = windows.data() + reads.size() * windowSize;
+            read.Size = windowSize;
+            reads.push_back(read);
+            readIndices.push_back(begin + i);
+        }
+        pm.ReadScatter(reads.data(), reads.size());
+
+        for (size_t r = 0; r < reads.size(); ++r) {
+            const int32_t index = readIndices[r];
+            const uintptr_t entryAddress = entries[index - begin];
+            const uint8_t* window = static_cast<const uint8_t*>(reads[r].Buffer);
+            if (!reads[r].Success) {
+                // The window ran past readable memory (e.g. the last entry of a block); read it exactly.
+                auto indexOpt = pm.Read<int32_t>(entryAddress + SDK::FNameEntry::Offset_IndexInEntry);
+                if (!indexOpt || *indexOpt != index) continue;
+                const int32_t length = ReadNameChars(pm, entryAddress, longName.data());
+                if (length > 0) AppendName(index, longName.data(), static_cast<size_t>(length));
+                continue;
+            }
+
+            // CRITICAL CHECK: Validate index matches expected slot index
+            int32_t readIndex;
+            std::memcpy(&readIndex, window, sizeof(readIndex));
+            if (readIndex != index) continue;  // Skip if index doesn't match (corrupted/reallocated entry)
+
+            char16_t chars[WindowChars];
+            std::memcpy(chars, window + windowStringOffset, sizeof(chars));
+            size_t length = 0;
+            while (length < WindowChars && chars[length] != u'\0') ++length;
+            if (length < WindowChars) {
+                AppendName(index, chars, length);
+                continue;
+            }
+            const int32_t fullLength = ReadNameChars(pm, entryAddress, longName.data());
+            if (fullLength > 0) AppendName(index, longName.data(), static_cast<size_t>(fullLength));
         }
     }
 
-    if (names_.empty() && successfulLoads == 0) { gnamesArrayAddress_ = 0; return false; }
+    if (nameCount_ == 0) { gnamesArrayAddress_ = 0; slots_.clear(); return false; }
+
+    // Reverse index for FindNameId(): a flat table of ids at most half full, so building it is
+    // one pass with no allocation per name. Ascending ids keep the lowest for duplicates.
+    size_t bucketCount = 1;
+    while (bucketCount < nameCount_ * 2) bucketCount <<= 1;
+    idBuckets_.assign(bucketCount, InvalidNameId);
+    const size_t mask = bucketCount - 1;
+    for (size_t id = 0; id < slots_.size(); ++id) {
+        if (slots_[id].Length == 0) continue;
+        const std::string_view name = NameAt(id);
+        for (size_t bucket = HashName(name) & mask;; bucket = (bucket + 1) & mask) {
+            const int32_t existing = idBuckets_[bucket];
+            if (existing == InvalidNameId) {
+                idBuckets_[bucket] = static_cast<int32_t>(id);
+                break;
+            }
+            if (NameAt(static_cast<size_t>(existing)) == name) break;
+        }
+    }
     initialized_ = true;
     return true;
 }
 
-std::optional<std::string> GNameTable::ReadNameString(const MemoryManager& pm, uintptr_t entryAddress) const {
-    if (entryAddress == 0) return std::nullopt;
-    
-    // Read the index from the entry first using the offset defined in FNameEntry
-    auto entryIndexOpt = pm.Read<int32_t>(entryAddress + SDK::FNameEntry::Offset_IndexInEntry);
-    if (!entryIndexOpt) return std::nullopt;
-    
-    // Get string address at the expected offset using info from FNameEntry
-    uintptr_t stringAddress = entryAddress + SDK::FNameEntry::Offset_StringData;
-
-    // Read the string data based on whether it's wide or ansi
-    if constexpr (SDK::FNameEntry::IsWideChar) {
-        std::vector<wchar_t> buffer(SDK::FNameEntry::MaxNameLength, L'\0');
-        if (pm.ReadBytes(stringAddress, buffer.data(), (SDK::FNameEntry::MaxNameLength - 1) * sizeof(wchar_t))) {
-            buffer[SDK::FNameEntry::MaxNameLength - 1] = L'\0'; // Ensure null termination
-            std::wstring wide_str(buffer.data());
-            std::string narrow_str;
-            narrow_str.reserve(wide_str.length());
-            for (wchar_t wc : wide_str) { 
-                if (wc == 0) break; // Stop at null terminator
-                if (wc > 0 && wc < 128) narrow_str += static_cast<char>(wc); 
-                else narrow_str += '?'; 
-            }
-            // Return the string only if not empty
-            if (!narrow_str.empty()) return narrow_str;
-        }
+bool GNameTable::AppendName(int32_t index, const char16_t* chars, size_t length) {
+    if (length == 0) return false;
+    const size_t offset = arena_.size();
+    arena_.resize(offset + length * 3); // Worst case: every unit a 3-byte sequence
+    const size_t written = SDK::Utf16ToUtf8(chars, length, arena_.data() + offset, length * 3);
+    arena_.resize(offset + written);
+    if (written == 0) return false;
+    slots_[static_cast<size_t>(index)] = NameSlot{ static_cast<uint32_t>(offset), static_cast<uint32_t>(written) };
+    ++nameCount_;
+    return true;
+}
+
+int32_t GNameTable::ReadNameChars(const MemoryManager& pm, uintptr_t entryAddress, char16_t* out) const {
+    // The game stores UTF-16; char16_t keeps that true where wchar_t is 32 bits (headless builds).
+    constexpr size_t maxChars = SDK::FNameEntry::MaxNameLength - 1;
+    if (!pm.ReadBytes(entryAddress + SDK::FNameEntry::Offset_StringData, out, maxChars * sizeof(char16_t))) {
+        return -1;
     }
-    else {
-        std::vector<char> buffer(SDK::FNameEntry::MaxNameLength, '\0');
-        if (pm.ReadBytes(stringAddress, buffer.data(), SDK::FNameEntry::MaxNameLength - 1)) {
-            buffer[SDK::FNameEntry::MaxNameLength - 1] = '\0'; // Ensure null termination
-            std::string result(buffer.data());
-            // Return the string only if not empty
-            if (!result.empty()) return result;
-        }
+    int32_t length = 0;
+    while (static_cast<size_t>(length) < maxChars && out[length] != u'\0') ++length;
+    return length;
+}
+
+size_t GNameTable::HashName(std::string_view name) {
+    uint64_t hash = 0xCBF29CE484222325ull; // FNV-1a
+    for (char c : name) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3ull;
     }
-    
-    return std::nullopt;
+    return static_cast<size_t>(hash ^ (hash >> 32));
+}
+
+std::string_view GNameTable::GetNameView(int32_t index) const {
+    if (!initialized_ || index < 0 || static_cast<size_t>(index) >= slots_.size()) return {};
+    return NameAt(static_cast<size_t>(index));
 }
 
 std::string GNameTable::GetName(int32_t index) const {
     if (!initialized_) return "[Name Not Found]";
     if (index < 0) return "[Invalid Index]";
     
-    // Look up the name in our map
-    auto it = names_.find(index);
-    if (it != names_.end()) {
-        return it->second;
+    // Look up the name in the arena
+    std::string_view name = GetNameView(index);
+    if (!name.empty()) {
+        return std::string(name);
     }
     
     return "[Name Not Found]";
 }
 
+int32_t GNameTable::FindNameId(std::string_view name) const {
+    if (!initialized_ || name.empty() || idBuckets_.empty()) return InvalidNameId;
+    const size_t mask = idBuckets_.size() - 1;
+    for (size_t bucket = HashName(name) & mask;; bucket = (bucket + 1) & mask) {
+        const int32_t id = idBuckets_[bucket];
+        if (id == InvalidNameId || NameAt(static_cast<size_t>(id)) == name) return id;
+    }
+}
+
 bool GNameTable::IsInitialized() const { return initialized_; }
-size_t GNameTable::GetNameCount() const { return names_.size(); }
\ No newline at end of file
+size_t GNameTable::GetNameCount() const { return nameCount_; }
\ No newline at end of file
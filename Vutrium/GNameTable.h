@@ -4,8 +4,8 @@
 #include "MemoryManager.h"
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <unordered_map>
 #include <optional>
 
 // Forward declare TArrayHeader if Objects.hpp is too heavy or causes circular dependencies
@@ -16,6 +16,12 @@ public:
     GNameTable();
     bool Initialize(const MemoryManager& pm, uintptr_t moduleBase, uintptr_t gnamesOffset);
     std::string GetName(int32_t index) const;
+    // Same name without the copy; empty if the slot wasn't loaded. Valid as long as the table.
+    std::string_view GetNameView(int32_t index) const;
+    // Reverse lookup: the FName id for an exact name, or InvalidNameId. Names that appear more
+    // than once resolve to the lowest id.
+    static constexpr int32_t InvalidNameId = -1;
+    int32_t FindNameId(std::string_view name) const;
     bool IsInitialized() const; // Declaration ONLY
     size_t GetNameCount() const; // Declaration ONLY
 
@@ -27,11 +33,29 @@ private:
         static constexpr size_t    MaxNameLength = 1024;
     };
 
+    static constexpr int32_t ReadChunkSize = 4096;   // Entry pointers per bulk read in Initialize()
+    static constexpr size_t  WindowChars = 64;       // Characters read along with each entry's header
+
+    struct NameSlot {
+        uint32_t Offset = 0;  // Into arena_
+        uint32_t Length = 0;  // UTF-8 bytes; 0 when the slot has no name
+    };
+
+    // Converts 'length' UTF-16 units straight into the arena and points slot 'index' at them.
+    bool AppendName(int32_t index, const char16_t* chars, size_t length);
+    std::string_view NameAt(size_t index) const { return std::string_view(arena_.data() + slots_[index].Offset, slots_[index].Length); }
+    static size_t HashName(std::string_view name);
+
     uintptr_t gnamesArrayAddress_ = 0;
-    std::unordered_map<int32_t, std::string> names_;
+    std::vector<char> arena_;                               // Every name as UTF-8, back to back, unterminated
+    std::vector<NameSlot> slots_;                           // Indexed by FName id
+    size_t nameCount_ = 0;
+    std::vector<int32_t> idBuckets_;                        // FindNameId() hash table: open addressing over ids, power-of-two size
     bool initialized_ = false;
 
-    std::optional<std::string> ReadNameString(const MemoryManager& pm, uintptr_t entryAddress) const; // Declaration ONLY
+    // Reads the full name (up to MaxNameLength - 1 characters) for entries whose name didn't fit
+    // in the window read. Returns the length, or -1 if the read failed.
+    int32_t ReadNameChars(const MemoryManager& pm, uintptr_t entryAddress, char16_t* out) const;
 };
 
 #endif
\ No newline at end of file
@@ -1,19 +1,61 @@
 #include "GObjectsTable.h"
 #include "Logger.h"      // Include Logger
+#include "ReadStats.h"
 #include <iostream>
-#include <string_view>   // For efficient string checking
+#include <string_view>
 #include <exception>     // For std::exception
+#include <algorithm>
+#include <cstring>
+#include <emmintrin.h>
+
+namespace {
+    // memcmp for pointer runs; SSE2 compares 64 bytes per iteration and bails on the first
+    // differing block. Unchanged runs are the overwhelmingly common case in Refresh().
+    bool PointerRunsEqual(const uintptr_t* a, const uintptr_t* b, size_t count) {
+        const uint8_t* pa = reinterpret_cast<const uint8_t*>(a);
+        const uint8_t* pb = reinterpret_cast<const uint8_t*>(b);
+        const size_t bytes = count * sizeof(uintptr_t);
+        size_t offset = 0;
+        for (; offset + 64 <= bytes; offset += 64) {
+            const __m128i eq0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + offset)),
+                                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + offset)));
+            const __m128i eq1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + offset + 16)),
+                                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + offset + 16)));
+            const __m128i eq2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + offset + 32)),
+                                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + offset + 32)));
+            const __m128i eq3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pa + offset + 48)),
+                                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(pb + offset + 48)));
+            const __m128i all = _mm_and_si128(_mm_and_si128(eq0, eq1), _mm_and_si128(eq2, eq3));
+            if (_mm_movemask_epi8(all) != 0xFFFF) {
+                return false;
+            }
+        }
+        return std::memcmp(pa + offset, pb + offset, bytes - offset) == 0;
+    }
+}
 
 GObjectsTable::GObjectsTable() : gobjectsArrayAddress_(0), initialized_(false) {}
 
 bool GObjectsTable::Initialize(const MemoryManager& pm, const GNameTable& gnames, uintptr_t moduleBase, uintptr_t gobjectsOffset) {
+    ReadScope readScope(ReadCategory::GObjects);
     initialized_ = false; // Reset status
     staticClasses_.clear();
     staticFunctions_.clear();
+    {
+        std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+        std::lock_guard<std::mutex> trackingLock(trackingMutex_);
+        shadowObjects_.clear();
+        shadowClassIds_.clear();
+        slotPositions_.clear();
+        classIds_.clear();
+        classInstances_.clear();
+        trackedCount_ = 0;
+        tracking_ = false;
+    }
 
     // Crucially check if GNameTable is initialized *before* proceeding
     if (!pm.IsAttached() || !gnames.IsInitialized() || moduleBase == 0 || gobjectsOffset == 0) {
-        Logger::Error("GObjectsTable Error: Invalid parameters or GNameTable not initialized.");
+        VUTRIUM_LOG_ERROR("GObjectsTable Error: Invalid parameters or GNameTable not initialized.");
         return false;
     }
 
@@ -23,7 +65,7 @@ bool GObjectsTable::Initialize(const MemoryManager& pm, const GNameTable& gnames
     // Read the TArray layout for GObjects
     auto layoutOpt = pm.Read<SDK::TArrayLayout>(gobjectsArrayAddress_);
     if (!layoutOpt) {
-        Logger::Error("GObjectsTable Error: Failed to read TArray layout at " + Logger::to_hex(gobjectsArrayAddress_));
+        VUTRIUM_LOG_ERROR("GObjectsTable Error: Failed to read TArray layout at " + Logger::to_hex(gobjectsArrayAddress_));
         gobjectsArrayAddress_ = 0;
         return false;
     }
@@ -34,304 +76,195 @@ bool GObjectsTable::Initialize(const MemoryManager& pm, const GNameTable& gnames
     // Basic sanity checks for the TArray
     const int32_t maxReasonableObjectCount = 10'000'000; // Adjust if necessary
     if (layout.ArrayData == 0 || layout.ArrayCount <= 0 || layout.ArrayCount > maxReasonableObjectCount) {
-        Logger::Error("GObjectsTable Error: Invalid TArray layout data (Count=" + std::to_string(layout.ArrayCount) + ", Data=" + Logger::to_hex(layout.ArrayData) + ")");
+        VUTRIUM_LOG_ERROR("GObjectsTable Error: Invalid TArray layout data (Count=" + std::to_string(layout.ArrayCount) + ", Data=" + Logger::to_hex(layout.ArrayData) + ")");
         gobjectsArrayAddress_ = 0;
         return false;
     }
 
-    constexpr size_t pointerSize = sizeof(uintptr_t);
-    int mappedClasses = 0;
-    int mappedFunctions = 0;
-    int skippedObjects = 0;
-    int errorCount = 0;
-    const int logModulo = 10000; // Log progress less frequently
-
-    Logger::Info("GObjectsTable: Starting object mapping loop (" + std::to_string(layout.ArrayCount) + " objects)...");
-
     // --- Map Static Objects ---
-    // This loop assumes GObjects TArray contains POINTERS to UObject instances.
-    for (int32_t i = 0; i < layout.ArrayCount; ++i) {
-        /* // REMOVED Progress Logging
-        if (i > 0 && i % logModulo == 0) { // Log progress periodically
-            Logger::Info("GObjectsTable: Processing index " + std::to_string(i) + "...");
-        }
-        */
-
-        uintptr_t objPtrAddress = layout.ArrayData + i * pointerSize;
-        auto objPtrOpt = pm.Read<uintptr_t>(objPtrAddress);
-
-        // Skip null pointers in the array
-        if (!objPtrOpt || *objPtrOpt == 0) {
-            skippedObjects++;
-            continue;
-        }
-
-        uintptr_t objAddress = *objPtrOpt;
-        SDK::UObject currentObject(objAddress); // Create wrapper
-
-        // Skip potential self-references or very early objects that might be invalid
-        if (objAddress < 0x1000 ||
-            currentObject.Address == currentObject.GetOuterAddress(pm) ||
-            currentObject.Address == currentObject.GetClassAddress(pm)) {
-            skippedObjects++;
-            continue;
-        }
+    // One pass, entirely in FName ids: an object is mapped when its class is named "Class" or
+    // "Function", keyed by its own name id and those of its outers. Nothing is turned into a
+    // string, and class names and outers are read once each since thousands of objects share them.
+    const int32_t classNameId = gnames.FindNameId("Class");
+    const int32_t functionNameId = gnames.FindNameId("Function");
+    if (classNameId == GNameTable::InvalidNameId || functionNameId == GNameTable::InvalidNameId) {
+        VUTRIUM_LOG_ERROR("GObjectsTable Error: 'Class' or 'Function' is missing from GNames.");
+        gobjectsArrayAddress_ = 0;
+        return false;
+    }
+    gnames_ = &gnames;
 
+    // Outer and Name are adjacent in UObject, so one read gets both.
+    struct OuterAndName {
+        uintptr_t Outer;
+        int32_t NameId;
+        int32_t InstanceNumber;
+    };
+    static_assert(SDK::UObject::Offset_Name == SDK::UObject::Offset_Outer + sizeof(uintptr_t), "Outer must precede Name");
+    struct Candidate {
+        OuterAndName Read;
+        uintptr_t Address;
+        int32_t ClassNameId;
+    };
 
-        // Add try-catch specifically around GetFullName
-        std::string fullName;
-        try {
-            // Pass const reference to GetFullName
-            fullName = currentObject.GetFullName(pm, gnames);
+    std::unordered_map<uintptr_t, int32_t> classNameIds; // Class address -> the class's own name id
+    std::unordered_map<uintptr_t, OuterAndName> outers;  // Outer address -> its name and its outer
+    std::vector<uintptr_t> objects(ScanChunkSize), classes(ScanChunkSize);
+    std::vector<MemoryManager::ScatterRead> reads;
+    std::vector<Candidate> candidates;
+    candidates.reserve(ScanChunkSize); // Scatter buffers point into it, so it must never reallocate
+    int skippedObjects = 0;
+    int errorCount = 0;
 
-            // Optional detailed logging (can spam the log quickly)
-            // if (i < 100 || (i % (logModulo * 10) == 0)) {
-            //      Logger::Info("GObjectsTable [" + std::to_string(i) + " Addr: " + Logger::to_hex(objAddress) + "] FullName: '" + fullName + "'");
-            // }
+    VUTRIUM_LOG_INFO("GObjectsTable: Starting object mapping loop (" + std::to_string(layout.ArrayCount) + " objects)...");
+
+    for (int32_t begin = 0; begin < layout.ArrayCount; begin += ScanChunkSize) {
+        const int32_t count = (std::min)(ScanChunkSize, layout.ArrayCount - begin);
+        ReadObjectChunk(pm, layout.ArrayData, begin, count, objects.data(), classes.data(), reads);
+
+        // Pick out the classes and functions, then read their names and outers in one scatter read.
+        reads.clear();
+        candidates.clear();
+        for (int32_t i = 0; i < count; ++i) {
+            const uintptr_t objAddress = objects[i];
+            const uintptr_t classAddress = classes[i];
+            // Skip null slots and self-referencing objects (Core.Class is its own class)
+            if (objAddress == 0 || classAddress == 0 || classAddress == objAddress) {
+                skippedObjects++;
+                continue;
+            }
 
-        }
-        catch (const std::exception& e) {
-            errorCount++;
-            if (errorCount < 20) { // Limit error logging spam
-                Logger::Error("GObjectsTable Error getting name for index " + std::to_string(i) + " Addr: " + Logger::to_hex(objAddress) + ": " + e.what());
+            auto classIt = classNameIds.find(classAddress);
+            if (classIt == classNameIds.end()) {
+                auto nameIdOpt = pm.Read<int32_t>(classAddress + SDK::UObject::Offset_Name);
+                if (!nameIdOpt) {
+                    errorCount++;
+                    VUTRIUM_LOG_LIMITED(5.0, 20, LogFormat::GObjectsClassNameReadFailed, Logger::Hex(classAddress + SDK::UObject::Offset_Name));
+                }
+                classIt = classNameIds.emplace(classAddress, nameIdOpt.value_or(GNameTable::InvalidNameId)).first;
             }
-            continue; // Skip this object if GetFullName failed
-        }
-        catch (...) {
-            errorCount++;
-            if (errorCount < 20) {
-                Logger::Error("GObjectsTable Unknown Error getting name for index " + std::to_string(i) + " Addr: " + Logger::to_hex(objAddress));
+            if (classIt->second != classNameId && classIt->second != functionNameId) {
+                continue; // Some other type of UObject, we don't map it
             }
-            continue;
-        }
-
-
-        // Check if a valid name was returned before trying to find substrings
-        if (fullName.empty() || fullName == "None" || fullName.find("Error") != std::string::npos || fullName.find("Invalid") != std::string::npos) {
-            skippedObjects++;
-            continue; // Skip objects with invalid names
-        }
-
-
-        if (fullName.find("Class ") != std::string::npos) {
-            staticClasses_[fullName] = SDK::UClass(objAddress); // Store UClass wrapper
-            mappedClasses++;
-            // Optional: Log first few finds
-            // if (mappedClasses < 10) Logger::Info("Mapped Class [" + std::to_string(mappedClasses) + "]: " + fullName);
-        }
-        else if (fullName.find("Function ") != std::string::npos) {
-            staticFunctions_[fullName] = SDK::UFunction(objAddress); // Store UFunction wrapper
-            mappedFunctions++;
-            // Optional: Log first few finds
-            // if (mappedFunctions < 10) Logger::Info("Mapped Function [" + std::to_string(mappedFunctions) + "]: " + fullName);
-        }
-        // else: It's some other type of UObject, we don't map it by default.
-
-    } // End object loop
-
-    Logger::Info("GObjectsTable: Mapping loop finished.");
-    Logger::Info("GObjectsTable: Mapped " + std::to_string(mappedClasses) + " classes, "
-        + std::to_string(mappedFunctions) + " functions. Skipped/Other: "
-        + std::to_string(skippedObjects) + ". Errors: " + std::to_string(errorCount));
 
-    // Instead of class traversal, do a second direct pass through the GObjects array to find functions
-    // This is more similar to how RocketDumper.cs works
-    Logger::Info("GObjectsTable: Starting direct function scan...");
-    int directMappedFunctions = 0;
-    int directErrors = 0;
-
-    // Define a simplified UObject struct that matches the new SDK::UObject layout
-    // We can directly use SDK::UObject now if needed, but the direct read approach might still be beneficial.
-    // Let's adapt the DirectUObject struct to match SDK::UObject for clarity
-    struct DirectUObjectLayout { // Renamed to avoid conflict if SDK::UObject is included directly later
-        // Based on SDK::UObject in Objects.hpp (Updated Layout)
-        uintptr_t VfTable;                             // 0x0000
-        uintptr_t HashNext;                            // 0x0008
-        uint64_t ObjectFlags;                          // 0x0010
-        uintptr_t HashOuterNext;                       // 0x0018
-        uintptr_t StateFrame;                          // 0x0020
-        uintptr_t Linker;                              // 0x0028
-        int32_t LinkerIndex;                           // 0x0030
-        int32_t ObjectInternalInteger;                 // 0x0034
-        int32_t NetIndex;                              // 0x0038
-        uintptr_t Outer;                               // 0x0040 (UObject*)
-        int32_t FNameEntryId;                          // 0x0048 (FNameEntryId)
-        int32_t InstanceNumber;                        // 0x004C
-        uintptr_t Class;                               // 0x0050 (UClass*)
-        uintptr_t ObjectArchetype;                     // 0x0058 (UObject*)
-        // Ensure this struct's size matches or is less than the actual UObject size
-    };
-
-    // Reset to beginning of GObjects array for a second pass looking specifically for functions
-    for (int32_t i = 0; i < layout.ArrayCount; ++i) {
-        /* // REMOVED Progress Logging
-        if (i > 0 && i % logModulo == 0) { // Log progress periodically
-            Logger::Info("GObjectsTable: Function scan index " + std::to_string(i) + "...");
-        }
-        */
-
-        uintptr_t objPtrAddress = layout.ArrayData + i * pointerSize;
-        auto objPtrOpt = pm.Read<uintptr_t>(objPtrAddress);
-
-        // Skip null pointers in the array
-        if (!objPtrOpt || *objPtrOpt == 0) {
-            continue;
-        }
-
-        uintptr_t objAddress = *objPtrOpt;
-        
-        // Skip very low addresses that are likely invalid
-        if (objAddress < 0x1000) {
-            continue;
-        }
-
-        // Read the object directly using our simplified struct
-        auto directObjOpt = pm.Read<DirectUObjectLayout>(objAddress);
-        if (!directObjOpt) {
-            directErrors++;
-            if (directErrors < 20) Logger::Warning("GObjectsTable: Failed to read DirectUObjectLayout at " + Logger::to_hex(objAddress));
-            continue;
-        }
-        
-        DirectUObjectLayout uObject = *directObjOpt;
-        
-        // Skip objects that reference themselves (can cause infinite loops)
-        if (uObject.Outer == objAddress || uObject.Class == objAddress) {
-            continue;
+            candidates.push_back(Candidate{ OuterAndName{}, objAddress, classIt->second });
+            MemoryManager::ScatterRead read;
+            read.Address = objAddress + SDK::UObject::Offset_Outer;
+            read.Buffer = &candidates.back().Read;
+            read.Size = sizeof(OuterAndName);
+            reads.push_back(read);
         }
+        pm.ReadScatter(reads.data(), reads.size());
+
+        for (size_t c = 0; c < candidates.size(); ++c) {
+            const Candidate& candidate = candidates[c];
+            if (!reads[c].Success) {
+                errorCount++;
+                VUTRIUM_LOG_LIMITED(5.0, 20, LogFormat::GObjectsOuterReadFailed, Logger::Hex(candidate.Address));
+                continue;
+            }
 
-        // Get the object's own base name using the FName struct read directly
-        // Use the FNameEntryId directly from the read struct
-        std::string baseName = gnames.GetName(uObject.FNameEntryId);
-        if (baseName.empty() || baseName == "None" || baseName[0] == '[') {
-            // Skip if base name is invalid or error
-            continue;
-        }
-        
-        // Get the inner name (class name) (RocketDumper.cs::GetObjectName - innerName)
-        std::string innerName = "";
-        if (uObject.Class != 0) {
-            // Read the FName struct from the class object
-            // Read the FNameEntryId directly from the class object
-            auto innerClassNameIdOpt = pm.Read<int32_t>(uObject.Class + SDK::UObject::Offset_Name);
-            if (innerClassNameIdOpt) {
-                innerName = gnames.GetName(*innerClassNameIdOpt);
-                if (innerName.empty() || innerName == "None" || innerName[0] == '[') {
-                    innerName = "UnknownClass"; // Fallback if name lookup fails
+            ObjectKey key;
+            key.ClassNameId = candidate.ClassNameId;
+            key.NameIds[key.Depth++] = candidate.Read.NameId;
+
+            // Walk the outer chain (RocketDumper.cs::GetObjectName - outerName logic)
+            bool complete = true;
+            uintptr_t currentOuterAddr = candidate.Read.Outer;
+            while (currentOuterAddr != 0) {
+                if (key.Depth == SDK::ObjectPath::MaxDepth) {
+                    VUTRIUM_LOG_LIMITED(5.0, 20, LogFormat::GObjectsOuterMaxDepth, Logger::Hex(candidate.Address));
+                    complete = false;
+                    break;
+                }
+                auto outerIt = outers.find(currentOuterAddr);
+                if (outerIt == outers.end()) {
+                    auto outerOpt = pm.Read<OuterAndName>(currentOuterAddr + SDK::UObject::Offset_Outer);
+                    if (!outerOpt) {
+                        VUTRIUM_LOG_LIMITED(5.0, 20, LogFormat::GObjectsOuterReadFailed, Logger::Hex(currentOuterAddr));
+                        complete = false;
+                        break;
+                    }
+                    outerIt = outers.emplace(currentOuterAddr, *outerOpt).first;
+                }
+                // Prevent self-referential loops in the Outer chain
+                if (outerIt->second.Outer == currentOuterAddr || currentOuterAddr == candidate.Address) {
+                    VUTRIUM_LOG_LIMITED(5.0, 20, LogFormat::GObjectsOuterSelfLoop, Logger::Hex(currentOuterAddr));
+                    complete = false;
+                    break;
                 }
+                key.NameIds[key.Depth++] = outerIt->second.NameId;
+                currentOuterAddr = outerIt->second.Outer;
             }
-            else {
-                innerName = "UnknownClass"; // Failed to read class object FName
-                 directErrors++;
-                 if (directErrors < 20) Logger::Warning("GObjectsTable: Failed to read Inner Class FName at " + Logger::to_hex(uObject.Class + SDK::UObject::Offset_Name));
+            if (!complete) {
+                errorCount++;
+                continue;
             }
-        }
-        else {
-             innerName = "UnknownClass"; // Class pointer is null
-        }
-
-        // Only process objects whose class name is exactly "Function"
-        if (innerName != "Function") {
-            continue;
-        }
-        
-        // Build the outer name path (RocketDumper.cs::GetObjectName - outerName logic)
-        std::string outerNamePath = "";
-        uintptr_t currentOuterAddr = uObject.Outer;
-        int outerDepth = 0;
-        const int maxOuterDepth = 16; // Safety limit for nested outers
-
-        while (currentOuterAddr != 0 && outerDepth < maxOuterDepth) {
-             // Read the FName struct from the outer object
-             // Read the FNameEntryId directly from the outer object
-             auto outerNameIdOpt = pm.Read<int32_t>(currentOuterAddr + SDK::UObject::Offset_Name);
-             // Read the next outer pointer
-             auto nextOuterOpt = pm.Read<uintptr_t>(currentOuterAddr + SDK::UObject::Offset_Outer);
-
-             if (!outerNameIdOpt || !nextOuterOpt) {
-                 directErrors++;
-                 if (directErrors < 20) Logger::Warning("GObjectsTable: Failed to read Outer FName/Ptr at " + Logger::to_hex(currentOuterAddr));
-                 outerNamePath = "[OuterReadError]." + outerNamePath;
-                 break;
-             }
-             uintptr_t nextOuterAddr = *nextOuterOpt;
-
-             // Prevent self-referential loops in the Outer chain
-             if (nextOuterAddr == currentOuterAddr) { // Check if Outer points back to the address we just read
-                Logger::Warning("GObjectsTable: Detected self-loop in Outer chain at " + Logger::to_hex(currentOuterAddr));
-                outerNamePath = "[SelfLoop]." + outerNamePath;
-                break;
-             }
-
-             std::string currentOuterName = gnames.GetName(*outerNameIdOpt);
-             if (currentOuterName.empty() || currentOuterName == "None" || currentOuterName[0] == '[') {
-                 outerNamePath = "[OuterNameError]." + outerNamePath;
-                 break; // Stop if outer name is invalid
-             }
-
-             outerNamePath = currentOuterName + "." + outerNamePath;
-             currentOuterAddr = nextOuterAddr; // Move to the next outer
-             outerDepth++;
-        }
-        if (outerDepth >= maxOuterDepth) {
-            Logger::Warning("GObjectsTable: Outer chain depth exceeded max limit for object " + Logger::to_hex(objAddress));
-            outerNamePath = "[MaxDepth]." + outerNamePath;
-        }
 
-        // Format exactly like RocketDumper: "{innerName} {outerNamePath}{baseName}"
-        // Note: outerNamePath already includes the trailing dot if it's not empty
-        std::string functionFullName = innerName + " " + outerNamePath + baseName;
-        
-        // Final validation and storage
-        if (!functionFullName.empty() && 
-            functionFullName.find("None") == std::string::npos &&
-            functionFullName.find("[") == std::string::npos && // Check for error markers
-            staticFunctions_.find(functionFullName) == staticFunctions_.end()) { // Avoid duplicates
-            
-            // Store in our map using the UFunction wrapper
-            staticFunctions_[functionFullName] = SDK::UFunction(objAddress);
-            directMappedFunctions++;
-            
-            // Log first 20 functions or every 1000th - COMMENTED OUT
-            /*
-            if (directMappedFunctions < 20 || directMappedFunctions % 1000 == 0) {
-                Logger::Info("Found Function [" + std::to_string(directMappedFunctions) + "]: " + functionFullName);
+            if (candidate.ClassNameId == functionNameId) {
+                staticFunctions_[key] = SDK::UFunction(candidate.Address);
+            }
+            else {
+                staticClasses_[key] = SDK::UClass(candidate.Address);
             }
-            */
         }
-        // else: skip invalid names, errors, or duplicates
     }
 
-    Logger::Info("GObjectsTable: Direct function scan complete. Found " + std::to_string(directMappedFunctions) + 
-                " functions. Errors during scan: " + std::to_string(directErrors));
-    
-    // Update total count (mappedFunctions was from the first pass, which might be zero or very few)
-    // It might be clearer to just use the count from the second pass if that's the primary method now.
-    // Keep the count from the first loop, as the second loop failed to find functions.
-    // If the second loop were successful, you might use: mappedFunctions += directMappedFunctions;
-    Logger::Info("GObjectsTable: Final mapped - " + std::to_string(mappedClasses) + " classes, " + 
-                std::to_string(mappedFunctions) + " functions.");
+    VUTRIUM_LOG_INFO("GObjectsTable: Mapped " + std::to_string(staticClasses_.size()) + " classes, "
+        + std::to_string(staticFunctions_.size()) + " functions (" + std::to_string(classNameIds.size())
+        + " distinct classes, " + std::to_string(outers.size()) + " outers). Skipped: "
+        + std::to_string(skippedObjects) + ". Errors: " + std::to_string(errorCount));
 
     initialized_ = true; // Mark initialized even if nothing was mapped, as process completed
     return true;
 }
 
-SDK::UClass GObjectsTable::FindStaticClass(const std::string& fullName) const {
-    if (!initialized_) {
+size_t GObjectsTable::ObjectKeyHash::operator()(const ObjectKey& key) const {
+    uint64_t hash = static_cast<uint32_t>(key.ClassNameId) * 0x9E3779B97F4A7C15ull ^ key.Depth;
+    for (uint32_t i = 0; i < key.Depth; ++i) {
+        hash = (hash ^ static_cast<uint32_t>(key.NameIds[i])) * 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+    return static_cast<size_t>(hash);
+}
+
+bool GObjectsTable::MakeKey(const SDK::ObjectPath& path, ObjectKey& key) const {
+    if (!path.Valid || !gnames_) {
+        return false;
+    }
+    // A name that isn't in GNames can't be part of any mapped object.
+    key.ClassNameId = gnames_->FindNameId(path.ClassName);
+    if (key.ClassNameId == GNameTable::InvalidNameId) {
+        return false;
+    }
+    key.Depth = static_cast<uint32_t>(path.Depth);
+    for (size_t i = 0; i < path.Depth; ++i) {
+        key.NameIds[i] = gnames_->FindNameId(path.Names[i]);
+        if (key.NameIds[i] == GNameTable::InvalidNameId) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SDK::UClass GObjectsTable::FindStaticClass(const SDK::ObjectPath& path) const {
+    ObjectKey key;
+    if (!initialized_ || !MakeKey(path, key)) {
         return SDK::UClass(0); // Return invalid UClass
     }
-    auto it = staticClasses_.find(fullName);
+    auto it = staticClasses_.find(key);
     if (it != staticClasses_.end()) {
         return it->second; // Return the stored UClass wrapper
     }
     return SDK::UClass(0); // Not found, return invalid UClass
 }
 
-SDK::UFunction GObjectsTable::FindStaticFunction(const std::string& fullName) const {
-    if (!initialized_) {
+SDK::UFunction GObjectsTable::FindStaticFunction(const SDK::ObjectPath& path) const {
+    ObjectKey key;
+    if (!initialized_ || !MakeKey(path, key)) {
         return SDK::UFunction(0); // Return invalid UFunction
     }
-    auto it = staticFunctions_.find(fullName);
+    auto it = staticFunctions_.find(key);
     if (it != staticFunctions_.end()) {
         return it->second; // Return the stored UFunction wrapper
     }
@@ -339,6 +272,7 @@ SDK::UFunction GObjectsTable::FindStaticFunction(const std::string& fullName) co
 }
 
 SDK::UObject GObjectsTable::GetObjectByIndex(const MemoryManager& pm, int32_t index) const {
+    ReadScope readScope(ReadCategory::GObjects);
     if (!initialized_ || gobjectsArrayAddress_ == 0) {
         return SDK::UObject(0);
     }
@@ -364,6 +298,7 @@ SDK::UObject GObjectsTable::GetObjectByIndex(const MemoryManager& pm, int32_t in
 }
 
 int32_t GObjectsTable::GetObjectCount(const MemoryManager& pm) const {
+    ReadScope readScope(ReadCategory::GObjects);
     if (!initialized_ || gobjectsArrayAddress_ == 0) {
         return 0;
     }
@@ -374,6 +309,295 @@ int32_t GObjectsTable::GetObjectCount(const MemoryManager& pm) const {
 }
 
 
+void GObjectsTable::ReadObjectChunk(const MemoryManager& pm, uintptr_t arrayData, int32_t begin, int32_t count,
+                                    uintptr_t* objects, uintptr_t* classes,
+                                    std::vector<MemoryManager::ScatterRead>& reads) {
+    if (!pm.ReadBytes(arrayData + static_cast<uintptr_t>(begin) * sizeof(uintptr_t),
+                      objects, static_cast<SIZE_T>(count) * sizeof(uintptr_t))) {
+        std::fill(objects, objects + count, uintptr_t(0));
+        std::fill(classes, classes + count, uintptr_t(0));
+        return;
+    }
+
+    reads.clear();
+    for (int32_t i = 0; i < count; ++i) {
+        if (objects[i] < 0x1000) {
+            objects[i] = 0;
+            classes[i] = 0;
+            continue;
+        }
+        MemoryManager::ScatterRead read;
+        read.Address = objects[i] + SDK::UObject::Offset_Class;
+        read.Buffer = &classes[i];
+        read.Size = sizeof(uintptr_t);
+        reads.push_back(read);
+    }
+    pm.ReadScatter(reads.data(), reads.size());
+    for (const auto& read : reads) {
+        if (!read.Success) *static_cast<uintptr_t*>(read.Buffer) = 0;
+    }
+}
+
+size_t GObjectsTable::ForEachInstanceFromTail(const MemoryManager& pm, uintptr_t classAddress,
+                                              const std::function<bool(const SDK::UObject&)>& visitor) const {
+    ReadScope readScope(ReadCategory::GObjects);
+    if (!initialized_ || gobjectsArrayAddress_ == 0 || classAddress == 0) {
+        return 0;
+    }
+
+    if (IsTracking()) {
+        // The index can be up to one Refresh() behind, so recheck every Class in one scatter
+        // read, the same check the walk below does.
+        const std::vector<TrackedObject> instances = GetInstances(classAddress);
+        std::vector<uintptr_t> classes(instances.size(), 0);
+        std::vector<MemoryManager::ScatterRead> reads(instances.size());
+        for (size_t i = 0; i < instances.size(); ++i) {
+            reads[i].Address = instances[i].Address + SDK::UObject::Offset_Class;
+            reads[i].Buffer = &classes[i];
+            reads[i].Size = sizeof(uintptr_t);
+        }
+        pm.ReadScatter(reads.data(), reads.size());
+
+        size_t visited = 0;
+        for (size_t i = 0; i < instances.size(); ++i) {
+            if (!reads[i].Success || classes[i] != classAddress) continue;
+            ++visited;
+            if (!visitor(SDK::UObject(instances[i].Address))) break;
+        }
+        return visited;
+    }
+
+    auto layoutOpt = pm.Read<SDK::TArrayLayout>(gobjectsArrayAddress_);
+    if (!layoutOpt || layoutOpt->ArrayData == 0 || layoutOpt->ArrayCount <= 0) {
+        return 0;
+    }
+    const SDK::TArrayLayout layout = *layoutOpt;
+
+    // Pointers are pulled in chunks, then every object's Class field in one scatter read.
+    std::vector<uintptr_t> objects(ScanChunkSize);
+    std::vector<uintptr_t> classes(ScanChunkSize);
+    std::vector<MemoryManager::ScatterRead> reads;
+    reads.reserve(ScanChunkSize);
+
+    size_t visited = 0;
+    for (int32_t end = layout.ArrayCount; end > 0; end -= ScanChunkSize) {
+        const int32_t begin = (std::max)(0, end - ScanChunkSize);
+        const int32_t count = end - begin;
+        ReadObjectChunk(pm, layout.ArrayData, begin, count, objects.data(), classes.data(), reads);
+
+        for (int32_t i = count - 1; i >= 0; --i) {
+            if (objects[i] == 0 || classes[i] != classAddress) continue;
+            ++visited;
+            if (!visitor(SDK::UObject(objects[i]))) {
+                return visited;
+            }
+        }
+    }
+    return visited;
+}
+
+bool GObjectsTable::Refresh(const MemoryManager& pm, ObjectDelta* delta) {
+    std::lock_guard<std::mutex> refreshLock(refreshMutex_);
+    if (delta) {
+        *delta = ObjectDelta{};
+    }
+    if (!initialized_ || gobjectsArrayAddress_ == 0) {
+        return false;
+    }
+
+    auto layoutOpt = pm.Read<SDK::TArrayLayout>(gobjectsArrayAddress_);
+    if (!layoutOpt || layoutOpt->ArrayData == 0 || layoutOpt->ArrayCount < 0 || layoutOpt->ArrayCount > MaxObjectCount) {
+        return false;
+    }
+    const SDK::TArrayLayout layout = *layoutOpt;
+    const int32_t count = layout.ArrayCount;
+    const int32_t previousCount = static_cast<int32_t>(shadowObjects_.size());
+
+    // 1. Bulk-read the pointer array. A segment that can't be read keeps its previous
+    //    contents, so it diffs as unchanged instead of as thousands of removals.
+    liveObjects_.resize(count);
+    for (int32_t begin = 0; begin < count; begin += ReadSegmentSize) {
+        const int32_t segment = (std::min)(ReadSegmentSize, count - begin);
+        if (!pm.ReadBytes(layout.ArrayData + static_cast<uintptr_t>(begin) * sizeof(uintptr_t),
+                          liveObjects_.data() + begin, static_cast<SIZE_T>(segment) * sizeof(uintptr_t))) {
+            for (int32_t i = begin; i < begin + segment; ++i) {
+                liveObjects_[i] = i < previousCount ? shadowObjects_[i] : 0;
+            }
+        }
+    }
+
+    // 2. Compare against the shadow copy in fixed blocks; only blocks that differ are walked.
+    changedSlots_.clear();
+    size_t chunksCompared = 0;
+    size_t chunksChanged = 0;
+    for (int32_t begin = 0; begin < count; begin += CompareChunkSize) {
+        const int32_t chunk = (std::min)(CompareChunkSize, count - begin);
+        ++chunksCompared;
+        if (begin + chunk <= previousCount
+            && PointerRunsEqual(liveObjects_.data() + begin, shadowObjects_.data() + begin, static_cast<size_t>(chunk))) {
+            continue;
+        }
+        ++chunksChanged;
+        for (int32_t i = begin; i < begin + chunk; ++i) {
+            const uintptr_t previous = i < previousCount ? shadowObjects_[i] : 0;
+            if (liveObjects_[i] != previous) {
+                changedSlots_.push_back(i);
+            }
+        }
+    }
+
+    // 3. Resolve the Class of every new pointer in one scatter read.
+    changedClasses_.assign(changedSlots_.size(), 0);
+    classReads_.clear();
+    for (size_t k = 0; k < changedSlots_.size(); ++k) {
+        const uintptr_t object = liveObjects_[changedSlots_[k]];
+        if (object < 0x1000) continue;
+        MemoryManager::ScatterRead read;
+        read.Address = object + SDK::UObject::Offset_Class;
+        read.Buffer = &changedClasses_[k];
+        read.Size = sizeof(uintptr_t);
+        classReads_.push_back(read);
+    }
+    pm.ReadScatter(classReads_.data(), classReads_.size());
+    for (const auto& read : classReads_) {
+        if (!read.Success) *static_cast<uintptr_t*>(read.Buffer) = 0;
+    }
+
+    // 4. Apply. Lookups only wait for this part.
+    std::lock_guard<std::mutex> trackingLock(trackingMutex_);
+    if (count > previousCount) {
+        shadowObjects_.resize(count, 0);
+        shadowClassIds_.resize(count, InvalidClassId);
+        slotPositions_.resize(count, 0);
+    }
+    for (size_t k = 0; k < changedSlots_.size(); ++k) {
+        const int32_t slot = changedSlots_[k];
+        if (shadowClassIds_[slot] != InvalidClassId) {
+            if (delta) delta->Removed.push_back({ slot, shadowObjects_[slot], classInstances_[shadowClassIds_[slot]].Class });
+            UntrackSlot(slot);
+        }
+
+        const uintptr_t object = liveObjects_[slot];
+        const uintptr_t objectClass = changedClasses_[k];
+        if (object >= 0x1000 && objectClass == 0) {
+            // Class unreadable (object still being constructed?); leave the slot empty so the
+            // next pass sees it as changed and tries again.
+            shadowObjects_[slot] = 0;
+            continue;
+        }
+        shadowObjects_[slot] = object;
+        if (objectClass != 0) {
+            TrackSlot(slot, objectClass);
+            if (delta) delta->Added.push_back({ slot, object, objectClass });
+        }
+    }
+    for (int32_t slot = count; slot < previousCount; ++slot) {
+        if (shadowClassIds_[slot] != InvalidClassId) {
+            if (delta) delta->Removed.push_back({ slot, shadowObjects_[slot], classInstances_[shadowClassIds_[slot]].Class });
+            UntrackSlot(slot);
+        }
+    }
+    if (count < previousCount) {
+        shadowObjects_.resize(count);
+        shadowClassIds_.resize(count);
+        slotPositions_.resize(count);
+    }
+    tracking_ = true;
+
+    if (delta) {
+        delta->ObjectCount = count;
+        delta->ChunksCompared = chunksCompared;
+        delta->ChunksChanged = chunksChanged;
+    }
+    return true;
+}
+
+void GObjectsTable::TrackSlot(int32_t slot, uintptr_t classAddress) {
+    auto [it, inserted] = classIds_.try_emplace(classAddress, static_cast<ClassId>(classInstances_.size()));
+    if (inserted) {
+        classInstances_.emplace_back().Class = classAddress;
+    }
+    ClassInstances& instances = classInstances_[it->second];
+    shadowClassIds_[slot] = it->second;
+    slotPositions_[slot] = static_cast<int32_t>(instances.Slots.size());
+    instances.Addresses.push_back(shadowObjects_[slot]);
+    instances.Slots.push_back(slot);
+    ++trackedCount_;
+}
+
+void GObjectsTable::UntrackSlot(int32_t slot) {
+    // Swap-remove: the last entry of the class takes this one's position.
+    ClassInstances& instances = classInstances_[shadowClassIds_[slot]];
+    const int32_t position = slotPositions_[slot];
+    const int32_t lastSlot = instances.Slots.back();
+    instances.Addresses[position] = instances.Addresses.back();
+    instances.Slots[position] = lastSlot;
+    slotPositions_[lastSlot] = position;
+    instances.Addresses.pop_back();
+    instances.Slots.pop_back();
+    shadowClassIds_[slot] = InvalidClassId;
+    --trackedCount_;
+}
+
+bool GObjectsTable::IsTracking() const {
+    std::lock_guard<std::mutex> lock(trackingMutex_);
+    return tracking_;
+}
+
+GObjectsTable::ClassId GObjectsTable::FindClassId(uintptr_t classAddress) const {
+    std::lock_guard<std::mutex> lock(trackingMutex_);
+    auto it = classIds_.find(classAddress);
+    return it != classIds_.end() ? it->second : InvalidClassId;
+}
+
+size_t GObjectsTable::GetInstanceCount(ClassId classId) const {
+    std::lock_guard<std::mutex> lock(trackingMutex_);
+    if (classId < 0 || classId >= static_cast<ClassId>(classInstances_.size())) return 0;
+    return classInstances_[classId].Addresses.size();
+}
+
+size_t GObjectsTable::CopyInstances(ClassId classId, std::vector<uintptr_t>& out) const {
+    out.clear();
+    std::lock_guard<std::mutex> lock(trackingMutex_);
+    if (classId < 0 || classId >= static_cast<ClassId>(classInstances_.size())) return 0;
+    const std::vector<uintptr_t>& addresses = classInstances_[classId].Addresses;
+    out.assign(addresses.begin(), addresses.end());
+    return out.size();
+}
+
+std::vector<GObjectsTable::TrackedObject> GObjectsTable::GetInstances(uintptr_t classAddress) const {
+    std::vector<TrackedObject> result;
+    std::lock_guard<std::mutex> lock(trackingMutex_);
+    auto it = classIds_.find(classAddress);
+    if (it == classIds_.end()) {
+        return result;
+    }
+    const ClassInstances& instances = classInstances_[it->second];
+    result.reserve(instances.Addresses.size());
+    for (size_t i = 0; i < instances.Addresses.size(); ++i) {
+        result.push_back({ instances.Slots[i], instances.Addresses[i], classAddress });
+    }
+    std::sort(result.begin(), result.end(),
+              [](const TrackedObject& a, const TrackedObject& b) { return a.Index > b.Index; });
+    return result;
+}
+
+std::vector<uintptr_t> GObjectsTable::GetTrackedClasses() const {
+    std::vector<uintptr_t> classes;
+    std::lock_guard<std::mutex> lock(trackingMutex_);
+    for (const ClassInstances& instances : classInstances_) {
+        if (!instances.Addresses.empty()) {
+            classes.push_back(instances.Class);
+        }
+    }
+    return classes;
+}
+
+size_t GObjectsTable::GetTrackedObjectCount() const {
+    std::lock_guard<std::mutex> lock(trackingMutex_);
+    return trackedCount_;
+}
+
 bool GObjectsTable::IsInitialized() const {
     return initialized_;
 }
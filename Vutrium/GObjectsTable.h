@@ -4,29 +4,131 @@
 #include "MemoryManager.h"
 #include "Objects.hpp"
 #include "GNameTable.h"
+#include "ObjectPath.h"
+#include <array>
 #include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <optional>
+#include <functional>
+#include <mutex>
 
 class GObjectsTable {
 public:
     GObjectsTable();
     bool Initialize(const MemoryManager& pm, const GNameTable& gnames, uintptr_t moduleBase, uintptr_t gobjectsOffset);
-    SDK::UClass FindStaticClass(const std::string& fullName) const;
-    SDK::UFunction FindStaticFunction(const std::string& fullName) const;
+    // Lookups by full name ("Class Core.Object"). The path is resolved to FName ids and matched
+    // as integers; pass a constexpr ObjectPath to skip the split as well.
+    SDK::UClass FindStaticClass(const SDK::ObjectPath& path) const;
+    SDK::UFunction FindStaticFunction(const SDK::ObjectPath& path) const;
     SDK::UObject GetObjectByIndex(const MemoryManager& pm, int32_t index) const;
     int32_t GetObjectCount(const MemoryManager& pm) const;
+    struct TrackedObject {
+        int32_t Index = 0;      // Slot in the GObjects array
+        uintptr_t Address = 0;
+        uintptr_t Class = 0;
+    };
+    struct ObjectDelta {
+        std::vector<TrackedObject> Added;
+        std::vector<TrackedObject> Removed;
+        int32_t ObjectCount = 0;
+        size_t ChunksCompared = 0;
+        size_t ChunksChanged = 0;
+    };
+    // Diffs the live GObjects pointer array against the shadow copy kept from the previous call
+    // and re-resolves only the slots whose pointer changed, keeping the instance index below
+    // current. The first call sees every object as added. 'delta' (optional) receives what
+    // changed. Reads are counted under the caller's ReadScope. One caller at a time; lookups
+    // from other threads are fine while it runs.
+    bool Refresh(const MemoryManager& pm, ObjectDelta* delta = nullptr);
+    bool IsTracking() const; // Refresh() has succeeded at least once
+
+    // --- Instance index: objects grouped by their exact Class, as of the last Refresh() ---
+    // Includes class default objects and archetypes; see UObject::IsLiveInstance.
+    using ClassId = int32_t;
+    static constexpr ClassId InvalidClassId = -1;
+    // Dense id for a class that has had at least one tracked instance. Ids stay valid until the
+    // next Initialize(); InvalidClassId if no instance of the class has been seen yet.
+    ClassId FindClassId(uintptr_t classAddress) const;
+    // O(1) after FindClassId.
+    size_t GetInstanceCount(ClassId classId) const;
+    // Copies the instance addresses into 'out' (cleared first), in no particular order. Reusing
+    // 'out' across calls avoids allocating. Returns the count.
+    size_t CopyInstances(ClassId classId, std::vector<uintptr_t>& out) const;
+    // The instances with their slots, newest (highest index) first.
+    std::vector<TrackedObject> GetInstances(uintptr_t classAddress) const;
+    // Every class with at least one tracked instance.
+    std::vector<uintptr_t> GetTrackedClasses() const;
+    size_t GetTrackedObjectCount() const;
+
+    // Visits objects whose Class is exactly 'classAddress', newest (highest index) first, until
+    // the visitor returns false. Actors spawned for the current match sit near the tail. Served
+    // from the instance index once Refresh() has run, otherwise by walking GObjects backwards.
+    size_t ForEachInstanceFromTail(const MemoryManager& pm, uintptr_t classAddress,
+                                   const std::function<bool(const SDK::UObject&)>& visitor) const;
     bool IsInitialized() const;
     size_t GetMappedClassCount() const;
     size_t GetMappedFunctionCount() const;
 
 private:
+    static constexpr int32_t ScanChunkSize = 1024;
+    static constexpr int32_t CompareChunkSize = 64;      // Pointers per memcmp block in Refresh()
+    static constexpr int32_t ReadSegmentSize = 65536;    // Pointers per bulk read in Refresh()
+    static constexpr int32_t MaxObjectCount = 10'000'000;
+
+    // Bulk-reads 'count' object pointers starting at 'begin', then every object's Class in one
+    // scatter read. Null or unreadable entries come back as 0 in both arrays.
+    static void ReadObjectChunk(const MemoryManager& pm, uintptr_t arrayData, int32_t begin, int32_t count,
+                                uintptr_t* objects, uintptr_t* classes,
+                                std::vector<MemoryManager::ScatterRead>& reads);
+
+    // A full object name as FName ids: the class name, then the object's own name and its
+    // outers, innermost first (the same order as ObjectPath::Names).
+    struct ObjectKey {
+        int32_t ClassNameId = GNameTable::InvalidNameId;
+        uint32_t Depth = 0;
+        std::array<int32_t, SDK::ObjectPath::MaxDepth> NameIds{};
+
+        bool operator==(const ObjectKey& other) const {
+            return ClassNameId == other.ClassNameId && Depth == other.Depth && NameIds == other.NameIds;
+        }
+    };
+    struct ObjectKeyHash {
+        size_t operator()(const ObjectKey& key) const;
+    };
+    bool MakeKey(const SDK::ObjectPath& path, ObjectKey& key) const;
+
     uintptr_t gobjectsArrayAddress_ = 0;
-    std::unordered_map<std::string, SDK::UClass> staticClasses_;
-    std::unordered_map<std::string, SDK::UFunction> staticFunctions_;
+    const GNameTable* gnames_ = nullptr;
+    std::unordered_map<ObjectKey, SDK::UClass, ObjectKeyHash> staticClasses_;
+    std::unordered_map<ObjectKey, SDK::UFunction, ObjectKeyHash> staticFunctions_;
     bool initialized_ = false;
+
+    struct ClassInstances {
+        uintptr_t Class = 0;
+        std::vector<uintptr_t> Addresses;    // Contiguous, unordered
+        std::vector<int32_t> Slots;          // Slots[i] is the GObjects index of Addresses[i]
+    };
+
+    void TrackSlot(int32_t slot, uintptr_t classAddress);
+    void UntrackSlot(int32_t slot);
+
+    // Refresh() state. The staging buffers are only touched under refreshMutex_; the shadow
+    // arrays and the index also under trackingMutex_, which lookups take.
+    std::mutex refreshMutex_;
+    mutable std::mutex trackingMutex_;
+    std::vector<uintptr_t> liveObjects_;                 // Staging: this pass's pointer array
+    std::vector<int32_t> changedSlots_;                  // Staging: slots whose pointer differs
+    std::vector<uintptr_t> changedClasses_;              // Staging: Class of each changed slot
+    std::vector<MemoryManager::ScatterRead> classReads_; // Staging
+    std::vector<uintptr_t> shadowObjects_;               // Pointer array as of the last Refresh()
+    std::vector<ClassId> shadowClassIds_;                // Class per slot; InvalidClassId when not tracked
+    std::vector<int32_t> slotPositions_;                 // Slot -> position in its ClassInstances
+    std::unordered_map<uintptr_t, ClassId> classIds_;
+    std::vector<ClassInstances> classInstances_;         // Indexed by ClassId
+    size_t trackedCount_ = 0;
+    bool tracking_ = false;
 };
 
 #endif
\ No newline at end of file
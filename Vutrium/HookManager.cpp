@@ -1,6 +1,7 @@
 #include "HookManager.h"
 #include "EventData.h"
 #include "Logger.h"
+#include "ReadStats.h"
 #include <iostream>
 #include <stdexcept>   // Included for std::invalid_argument
 #include "kiero/minhook/include/MinHook.h"
@@ -72,10 +73,10 @@ MemoryManager& HookManager::GetMemoryManager() const {
 // Restore original Initialize
 bool HookManager::Initialize() {
     if (isMinHookInitialized_) {
-        Logger::Info("HookManager::Initialize(): Already marked as initialized.");
+        VUTRIUM_LOG_INFO("HookManager::Initialize(): Already marked as initialized.");
         return true;
     }
-    Logger::Info("HookManager: Assuming MinHook initialized by Kiero. Marking HookManager as ready.");
+    VUTRIUM_LOG_INFO("HookManager: Assuming MinHook initialized by Kiero. Marking HookManager as ready.");
     isMinHookInitialized_ = true;
     return true;
 }
@@ -83,7 +84,7 @@ bool HookManager::Initialize() {
 // Restore original Shutdown
 void HookManager::Shutdown() {
     if (!isMinHookInitialized_) return;
-    Logger::Info("HookManager: Disabling hooks...");
+    VUTRIUM_LOG_INFO("HookManager: Disabling hooks...");
     for (auto const& [name, info] : activeHooks_) {
         if (info.IsEnabled && info.TargetAddress != 0) {
             MH_STATUS disableStatus = MH_DisableHook(reinterpret_cast<LPVOID>(info.TargetAddress));
@@ -95,21 +96,21 @@ void HookManager::Shutdown() {
     // Call Uninitialize - Kiero does NOT call this.
     MH_STATUS status = MH_Uninitialize();
     if (status != MH_OK) Logger::MinHookError("Failed to uninitialize MinHook", status);
-    else Logger::Info("HookManager: MinHook uninitialized.");
+    else VUTRIUM_LOG_INFO("HookManager: MinHook uninitialized.");
     isMinHookInitialized_ = false;
 }
 
 // Restore Overload 1 using MinHook logic implicitly via Overload 2
 bool HookManager::CreateAndEnableHook(const std::string& functionName, LPVOID pDetour) {
-    if (!isMinHookInitialized_) { Logger::Error("HookManager: MinHook not initialized."); return false; }
-    if (!gobjectsTable_ || !gobjectsTable_->IsInitialized()) { Logger::Error("Cannot create hook '" + functionName + "'. GObjectsTable missing or not initialized."); return false; }
+    if (!isMinHookInitialized_) { VUTRIUM_LOG_ERROR("HookManager: MinHook not initialized."); return false; }
+    if (!gobjectsTable_ || !gobjectsTable_->IsInitialized()) { VUTRIUM_LOG_ERROR("Cannot create hook '" + functionName + "'. GObjectsTable missing or not initialized."); return false; }
 
     SDK::UFunction targetFunc = gobjectsTable_->FindStaticFunction(functionName);
-    if (!targetFunc.IsValid()) { Logger::Error("Could not find target function object '" + functionName + "'."); return false; }
+    if (!targetFunc.IsValid()) { VUTRIUM_LOG_ERROR("Could not find target function object '" + functionName + "'."); return false; }
 
     uintptr_t executableAddress = targetFunc.GetFuncAddress(GetMemoryManager());
     if (executableAddress == 0) {
-        Logger::Error("Failed to read executable function pointer for '" + functionName + "'.");
+        VUTRIUM_LOG_ERROR("Failed to read executable function pointer for '" + functionName + "'.");
         return false;
     }
     return CreateAndEnableHook(functionName, pDetour, executableAddress);
@@ -117,15 +118,15 @@ bool HookManager::CreateAndEnableHook(const std::string& functionName, LPVOID pD
 
 // Restore Overload 2 using MinHook logic
 bool HookManager::CreateAndEnableHook(const std::string& hookName, LPVOID pDetour, uintptr_t targetAddress) {
-    if (!isMinHookInitialized_) { Logger::Error("HookManager: MinHook not initialized."); return false; }
-    if (targetAddress == 0 || !pDetour) { Logger::Error("HookManager: Invalid target or detour for '" + hookName + "'."); return false; }
+    if (!isMinHookInitialized_) { VUTRIUM_LOG_ERROR("HookManager: MinHook not initialized."); return false; }
+    if (targetAddress == 0 || !pDetour) { VUTRIUM_LOG_ERROR("HookManager: Invalid target or detour for '" + hookName + "'."); return false; }
 
     if (activeHooks_.count(hookName)) {
-        Logger::Warning("Hook for '" + hookName + "' already exists, attempting to enable...");
+        VUTRIUM_LOG_WARNING("Hook for '" + hookName + "' already exists, attempting to enable...");
         return EnableHook(hookName);
     }
 
-    Logger::Info("Attempting to hook '" + hookName + "' at explicit address: " + Logger::to_hex(targetAddress));
+    VUTRIUM_LOG(LogFormat::HookAttempt, hookName, Logger::Hex(targetAddress));
     LPVOID pOriginal = nullptr;
     MH_STATUS status = MH_CreateHook(reinterpret_cast<LPVOID>(targetAddress), pDetour, &pOriginal);
     if (status != MH_OK) {
@@ -133,7 +134,7 @@ bool HookManager::CreateAndEnableHook(const std::string& hookName, LPVOID pDetou
         return false;
     }
     if (pOriginal == nullptr) {
-        Logger::Error("Trampoline is NULL after MH_CreateHook succeeded for '" + hookName + "'!");
+        VUTRIUM_LOG_ERROR("Trampoline is NULL after MH_CreateHook succeeded for '" + hookName + "'!");
         MH_RemoveHook(reinterpret_cast<LPVOID>(targetAddress));
         return false;
     }
@@ -152,17 +153,17 @@ bool HookManager::CreateAndEnableHook(const std::string& hookName, LPVOID pDetou
         return false;
     }
     newHook.IsEnabled = true;
-    Logger::Info("Successfully created and enabled hook for '" + hookName + "'.");
+    VUTRIUM_LOG_INFO("Successfully created and enabled hook for '" + hookName + "'.");
     return true;
 }
 
 // Restore DisableHook using MinHook
 bool HookManager::DisableHook(const std::string& functionName) {
-    if (!isMinHookInitialized_) { Logger::Error("HookManager: MinHook not initialized."); return false; }
+    if (!isMinHookInitialized_) { VUTRIUM_LOG_ERROR("HookManager: MinHook not initialized."); return false; }
     HookInfo* pHook = FindHookByName(functionName);
-    if (!pHook) { Logger::Warning("Cannot disable hook '" + functionName + "', not found."); return false; }
+    if (!pHook) { VUTRIUM_LOG_WARNING("Cannot disable hook '" + functionName + "', not found."); return false; }
     if (!pHook->IsEnabled) return true;
-    if (pHook->TargetAddress == 0) { Logger::Error("Cannot disable hook '" + functionName + "', target address is zero."); return false; }
+    if (pHook->TargetAddress == 0) { VUTRIUM_LOG_ERROR("Cannot disable hook '" + functionName + "', target address is zero."); return false; }
 
     MH_STATUS status = MH_DisableHook(reinterpret_cast<LPVOID>(pHook->TargetAddress));
     if (status != MH_OK) {
@@ -170,17 +171,17 @@ bool HookManager::DisableHook(const std::string& functionName) {
         return false;
     }
     pHook->IsEnabled = false;
-    Logger::Info("Disabled hook for '" + functionName + "'.");
+    VUTRIUM_LOG_INFO("Disabled hook for '" + functionName + "'.");
     return true;
 }
 
 // Restore EnableHook using MinHook
 bool HookManager::EnableHook(const std::string& functionName) {
-     if (!isMinHookInitialized_) { Logger::Error("HookManager: MinHook not initialized."); return false; }
+     if (!isMinHookInitialized_) { VUTRIUM_LOG_ERROR("HookManager: MinHook not initialized."); return false; }
     HookInfo* pHook = FindHookByName(functionName);
-    if (!pHook) { Logger::Warning("Cannot enable hook '" + functionName + "', not found."); return false; }
+    if (!pHook) { VUTRIUM_LOG_WARNING("Cannot enable hook '" + functionName + "', not found."); return false; }
     if (pHook->IsEnabled) return true;
-    if (pHook->TargetAddress == 0) { Logger::Error("Cannot enable hook '" + functionName + "', target address is zero."); return false; }
+    if (pHook->TargetAddress == 0) { VUTRIUM_LOG_ERROR("Cannot enable hook '" + functionName + "', target address is zero."); return false; }
 
     MH_STATUS status = MH_EnableHook(reinterpret_cast<LPVOID>(pHook->TargetAddress));
     if (status != MH_OK) {
@@ -188,7 +189,7 @@ bool HookManager::EnableHook(const std::string& functionName) {
         return false;
     }
     pHook->IsEnabled = true;
-    Logger::Info("Enabled hook for '" + functionName + "'.");
+    VUTRIUM_LOG_INFO("Enabled hook for '" + functionName + "'.");
     return true;
 }
 
@@ -215,28 +216,22 @@ T GetOriginal(const std::string& funcName) {
     if (g_HookManagerInstance) {
         return g_HookManagerInstance->GetTrampoline<T>(funcName);
     }
-    Logger::Error("GetOriginal called but g_HookManagerInstance is null!");
+    VUTRIUM_LOG_ERROR("GetOriginal called but g_HookManagerInstance is null!");
     return nullptr;
 }
 
 // ProcessEvent Hook Implementation
 void __fastcall Hook_ProcessEvent(SDK::UObject* pThis, SDK::UFunction* pFunction, void* pParms) {
-    static uint32_t callCounter = 0;
-    static uint32_t lastLoggedCounter = 0;
+    ReadScope readScope(ReadCategory::Hooks);
 
     auto pOriginal = GetOriginal<tProcessEvent>(ClassName::ProcessEvent);
     if (!pOriginal) {
-        static bool trampolineErrorLogged = false;
-        if (!trampolineErrorLogged) { Logger::Error("Trampoline not found for ProcessEvent (MinHook)!"); trampolineErrorLogged = true; }
+        VUTRIUM_LOG_LIMITED(0.1, 1, LogFormat::HookTrampolineMissing);
         return;
     }
 
-    bool shouldLog = (callCounter % 10000 == 0) || (callCounter - lastLoggedCounter > 100000); // Log samples less frequently
-    callCounter++;
-    
     if (!pThis || !pFunction || !g_GNameTableInstance || !g_EventManagerInstance || !g_HookManagerInstance) {
-        static bool pointerErrorLogged = false;
-        if (!pointerErrorLogged) { Logger::Error("Hook_ProcessEvent called with NULL pThis, pFunction, or global managers!"); pointerErrorLogged = true; }
+        VUTRIUM_LOG_LIMITED(0.1, 1, LogFormat::HookNullArguments);
         pOriginal(pThis, pFunction, pParms);
         return;
     }
@@ -249,13 +244,6 @@ void __fastcall Hook_ProcessEvent(SDK::UObject* pThis, SDK::UFunction* pFunction
          MemoryManager& pm = g_HookManagerInstance->GetMemoryManager();
          functionFullName = pFunction->GetFullName(pm, *g_GNameTableInstance);
          
-         // Sample logging (Still commented out, but less frequent check)
-         if (shouldLog) {
-             // Logger::Info("ProcessEvent Sample [" + std::to_string(callCounter) +
-             //             "]: " + functionFullName + " (Obj: " + Logger::to_hex(thisAddr) + ")"); 
-             lastLoggedCounter = callCounter;
-         }
-
         // REMOVED GameEvent Begin/Destroy Matching Logic
 
         // +++ ADDED: Simple IsA Check for GameEvent +++
@@ -263,8 +251,7 @@ void __fastcall Hook_ProcessEvent(SDK::UObject* pThis, SDK::UFunction* pFunction
             // Check if the object executing the function IsA GameEvent_Soccar_TA
             if (pThis->IsA(pm, *g_GNameTableInstance, "GameEvent_Soccar_TA")) {
                 // If it IS a GameEvent, fire the event with its address
-                 Logger::Info("**** HOOK: IsA(GameEvent_Soccar_TA) PASSED for Obj: " + Logger::to_hex(thisAddr) + 
-                            " | Func: " + functionFullName + " ****");
+                 VUTRIUM_LOG_LIMITED(1.0, 5, LogFormat::HookGameEventPassed, Logger::Hex(thisAddr), functionFullName);
                  EventProbableGameEventFoundData geFoundData(thisAddr);
                  if (g_EventManagerInstance) {
                      g_EventManagerInstance->Fire(EventType::OnProbableGameEventFound, geFoundData);
@@ -274,13 +261,11 @@ void __fastcall Hook_ProcessEvent(SDK::UObject* pThis, SDK::UFunction* pFunction
 
     }
     catch (const std::exception& e) { // <-- Catch block START
-         Logger::Error("Hook_ProcessEvent: Exception processing function: " + std::string(e.what()) +
-                     " on UFunc@" + Logger::to_hex(funcAddr) + " UObject@" + Logger::to_hex(thisAddr));
+         VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::HookProcessEventException, e.what(), Logger::Hex(funcAddr), Logger::Hex(thisAddr));
          // Do not call original here, call it outside the try-catch
     } // <-- Catch block END
     catch (...) { // <-- Catch (...) block START
-         Logger::Error("Hook_ProcessEvent: Unknown exception processing function for UFunc@" +
-                     Logger::to_hex(funcAddr) + " UObject@" + Logger::to_hex(thisAddr));
+         VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::HookProcessEventUnknown, Logger::Hex(funcAddr), Logger::Hex(thisAddr));
          // Do not call original here, call it outside the try-catch
     } // <-- Catch (...) block END
     
@@ -0,0 +1,90 @@
+#ifndef LOG_FORMATS_H
+#define LOG_FORMATS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Every structured log message, by id. Logger::Log(LogFormat::X, args...) queues the id and the
+// raw argument bytes; the text is only produced on the logger's writer thread, or offline by
+// tools/LogDecodeMain.cpp from a binary log. Each "{}" takes the next argument in order.
+//
+// Ids are positional and the binary log stores its own copy of this table, so entries can be
+// added anywhere, but old logs are always decoded with the table they were written with.
+#define VUTRIUM_LOG_FORMATS(X) \
+    X(Text,                       Info,    "{}") \
+    X(LogSuppressed,              Warning, "Suppressed {} similar message(s) from {}:{}") \
+    X(SdkAttached,                Info,    "RLSDK: Attached - PID: {}, Base: {}, Scan Size: {}") \
+    X(SdkViewportClientFound,     Info,    "RLSDK: Found main GameViewportClient instance at: {}") \
+    X(SdkFoundGNames,             Info,    "Found GNames via Method {} at: {}") \
+    X(SdkFoundGObjects,           Info,    "Found GObjects via Method {} at: {}") \
+    X(SdkResolvedAbsolute,        Info,    "RLSDK Resolve: Found absolute addresses: GNames={}, GObjects={}") \
+    X(SdkOffsetDifference,        Warning, "RLSDK Resolve: Offset difference is {}, expected {}. Adjusting GNames based on GObjects.") \
+    X(SdkAdjustedGNames,          Info,    "RLSDK Resolve: Adjusted GNames absolute address: {}") \
+    X(SdkGObjectsTooLow,          Error,   "RLSDK Resolve Error: Cannot adjust GNames, GObjects address too low ({}).") \
+    X(SdkResolvedOffsets,         Info,    "RLSDK Resolve: Successfully resolved relative offsets: GNames={}, GObjects={}") \
+    X(SdkViewportTickFound,       Info,    "Found potential GameViewportClient::Tick address via VTable: {}") \
+    X(GameEventStartedReceived,   Info,    "RLSDK: OnGameEventStarted received. Updating pointer. Prev: {}, New: {}") \
+    X(GameEventDestroyedReceived, Info,    "RLSDK: OnGameEventDestroyed received. Clearing pointer for: {}") \
+    X(GameEventTickChanged,       Info,    "RLSDK: Detected GameEvent change via Viewport Tick. Prev: {}, CurrFromTick: {}") \
+    X(GameEventCandidateRejected, Info,    "RLSDK: Heuristic found candidate {} but IsA(GameEvent_Soccar_TA) failed verification.") \
+    X(GameEventVerifiedChange,    Info,    "RLSDK: Verified GameEvent address changed. Prev: {}, New: {}") \
+    X(GameEventFiredDestroyed,    Info,    "RLSDK: Fired OnGameEventDestroyed for {}") \
+    X(GameEventFiredStarted,      Info,    "RLSDK: Fired OnGameEventStarted for {}") \
+    X(GameEventUpdateCalled,      Info,    "**** RLSDK::UpdateCurrentGameEvent called with address: {} ****") \
+    X(GameEventUpdated,           Info,    "RLSDK: Current GameEvent pointer updated to {}") \
+    X(GameEventDestroyCalled,     Info,    "**** RLSDK::NotifyGameEventDestroyed called for address: {} ****") \
+    X(GameEventCleared,           Info,    "RLSDK: Current GameEvent pointer cleared (Destroyed: {})") \
+    X(DiscoveryGameEventFound,    Info,    "ObjectDiscovery: GameEvent candidate {} at GObjects index {}") \
+    X(DiscoveryGameEventLost,     Info,    "ObjectDiscovery: GameEvent {} is gone (destroyed or reclassed)") \
+    X(DiscoveryPassException,     Error,   "ObjectDiscovery: Pass exception: {}") \
+    X(DiscoveryViewportFound,     Info,    "ObjectDiscovery: Found GameViewportClient instance at {}") \
+    X(HookAttempt,                Info,    "Attempting to hook '{}' at explicit address: {}") \
+    X(HookTrampolineMissing,      Error,   "Trampoline not found for ProcessEvent (MinHook)!") \
+    X(HookNullArguments,          Error,   "Hook_ProcessEvent called with NULL pThis, pFunction, or global managers!") \
+    X(HookGameEventPassed,        Info,    "**** HOOK: IsA(GameEvent_Soccar_TA) PASSED for Obj: {} | Func: {} ****") \
+    X(HookProcessEventException,  Error,   "Hook_ProcessEvent: Exception processing function: {} on UFunc@{} UObject@{}") \
+    X(HookProcessEventUnknown,    Error,   "Hook_ProcessEvent: Unknown exception processing function for UFunc@{} UObject@{}") \
+    X(FullNameSelfLoop,           Warning, "GetFullName detected self-referential Outer loop for {}") \
+    X(FullNameMaxDepth,           Warning, "GetFullName Outer loop reached max depth for {}") \
+    X(FullNameOuterException,     Error,   "GetFullName Exc in Outer loop for {}: {}") \
+    X(FullNameOuterUnknown,       Error,   "GetFullName Unk Exc in Outer loop for {}") \
+    X(FullNameClassException,     Error,   "GetFullName Exc getting Class name for {}: {}") \
+    X(FullNameClassUnknown,       Error,   "GetFullName Unk Exc getting Class name for {}") \
+    X(IsAException,               Error,   "IsA Exc traversing hierarchy for {}: {}") \
+    X(IsAUnknown,                 Error,   "IsA Unk Exc traversing hierarchy for {}") \
+    X(GObjectsClassNameReadFailed, Warning, "GObjectsTable: Failed to read Inner Class FName at {}") \
+    X(GObjectsOuterReadFailed,    Warning, "GObjectsTable: Failed to read Outer FName/Ptr at {}") \
+    X(GObjectsOuterSelfLoop,      Warning, "GObjectsTable: Detected self-loop in Outer chain at {}") \
+    X(GObjectsOuterMaxDepth,      Warning, "GObjectsTable: Outer chain depth exceeded max limit for object {}") \
+    X(FieldOffsetClassMissing,    Warning, "FieldOffsets: {} not found; keeping the default offsets of {}") \
+    X(FieldOffsetMissing,         Warning, "FieldOffsets: {}::{} (property '{}') not found; keeping {}") \
+    X(FieldOffsetRejected,        Warning, "FieldOffsets: {}::{} (property '{}') is at {} with element size {}, which doesn't fit a {}-byte read; keeping {}") \
+    X(FieldOffsetMoved,           Warning, "FieldOffsets: {}::{} (property '{}') is at {} in the game, manifest has {}") \
+    X(FieldOffsetLayoutRejected,  Error,   "FieldOffsets: {}::{} (property '{}') at {}: {}; the UProperty layout looks wrong, keeping every default") \
+    X(FieldOffsetsChecked,        Info,    "FieldOffsets: Checked {} fields in {} ms: {} verified, {} moved, {} rejected, {} missing ({} structs, {} members walked)")
+
+enum class LogLevel : uint8_t { Info, Warning, Error };
+
+enum class LogFormat : uint16_t {
+#define VUTRIUM_LOG_FORMAT_ID(name, level, format) name,
+    VUTRIUM_LOG_FORMATS(VUTRIUM_LOG_FORMAT_ID)
+#undef VUTRIUM_LOG_FORMAT_ID
+    Count
+};
+
+struct LogFormatInfo {
+    LogLevel Level;
+    const char* Format;
+};
+
+inline constexpr LogFormatInfo LogFormats[static_cast<size_t>(LogFormat::Count)] = {
+#define VUTRIUM_LOG_FORMAT_INFO(name, level, format) { LogLevel::level, format },
+    VUTRIUM_LOG_FORMATS(VUTRIUM_LOG_FORMAT_INFO)
+#undef VUTRIUM_LOG_FORMAT_INFO
+};
+
+constexpr const LogFormatInfo& GetLogFormat(LogFormat format) {
+    return LogFormats[static_cast<size_t>(format)];
+}
+
+#endif // LOG_FORMATS_H
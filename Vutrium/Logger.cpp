@@ -1,30 +1,200 @@
 #include "Logger.h"
-#include <windows.h>
-#include <ShlObj.h>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <iomanip>
 #include <sstream>
 #include <iostream>
+#include <thread>
 #include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#include <ShlObj.h>
 #include "kiero/minhook/include/MinHook.h"
 
 
 #pragma comment(lib, "Shell32.lib")
 #pragma comment(lib, "User32.lib")
+#endif
 
 namespace {
     FILE* g_conOutFile = nullptr;
-    std::mutex g_logMutex;
-    bool g_consoleAllocated = false;
-    bool DebugBuild = true;
+    std::mutex g_logMutex; // Guards g_conOutFile; taken by the writer thread, not by callers
+    std::atomic<bool> g_consoleAllocated{ false };
+
+    // One queue slot. Payloads longer than one slot's Data continue in the following slots;
+    // every slot but the last has Continued set. 128 bytes keeps a typical line in one slot.
+    // The payload is the message for LogFormat::Text, otherwise Logger::Log's encoded arguments.
+    struct Record {
+        int64_t SteadyNs;
+        uint16_t Length;
+        uint16_t FormatId;
+        LogLevel RecordLevel;
+        bool Continued;
+        char Data[114];
+    };
+    static_assert(sizeof(Record) == 128, "Record should fill two cache lines exactly");
+
+    // Single-producer (the owning thread) / single-consumer (the writer) ring. A full queue
+    // drops the message and counts it rather than blocking the game or render thread.
+    struct ThreadQueue {
+        static constexpr uint32_t Capacity = 1024; // 128 KB per logging thread
+
+        alignas(64) std::atomic<uint32_t> Head{ 0 };   // Next slot the producer writes
+        alignas(64) std::atomic<uint32_t> Tail{ 0 };   // Next slot the writer reads
+        std::atomic<uint64_t> Dropped{ 0 };
+        std::atomic<bool> Retired{ false };            // Owner thread exited; free once drained
+        Record Slots[Capacity];
+
+        bool Push(LogLevel level, uint16_t formatId, int64_t steadyNs, const char* data, size_t length) {
+            uint32_t needed = static_cast<uint32_t>(std::max<size_t>(1, (length + sizeof(Record::Data) - 1) / sizeof(Record::Data)));
+            uint32_t head = Head.load(std::memory_order_relaxed);
+            uint32_t tail = Tail.load(std::memory_order_acquire);
+            if (needed > Capacity - (head - tail)) {
+                Dropped.store(Dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                return false;
+            }
+            for (uint32_t i = 0; i < needed; ++i) {
+                Record& slot = Slots[(head + i) % Capacity];
+                size_t chunk = std::min(length, sizeof(slot.Data));
+                slot.SteadyNs = steadyNs;
+                slot.Length = static_cast<uint16_t>(chunk);
+                slot.FormatId = formatId;
+                slot.RecordLevel = level;
+                slot.Continued = i + 1 < needed;
+                std::memcpy(slot.Data, data, chunk);
+                data += chunk;
+                length -= chunk;
+            }
+            Head.store(head + needed, std::memory_order_release);
+            return true;
+        }
+
+        bool IsFillingUp() const {
+            return Head.load(std::memory_order_relaxed) - Tail.load(std::memory_order_relaxed) >= Capacity / 2;
+        }
+    };
 
+    std::atomic<Logger::RateLimiter*> g_limiters{ nullptr };
 
-    std::string GetTimestampSafe() {
+    int64_t SteadyNowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    std::mutex g_queuesMutex; // Guards g_queues (registration, retirement); never held while writing
+    std::vector<ThreadQueue*> g_queues;
+    std::atomic<bool> g_writerRunning{ false };
+    std::thread g_writerThread;
+    std::mutex g_shutdownMutex; // Serializes Shutdown(): the eject path and MainThread can both call it
+    std::mutex g_wakeMutex;
+    std::condition_variable g_wakeWriter;
+    std::atomic<uint64_t> g_droppedRetired{ 0 }; // Drops counted by queues that have since been freed
+    uint64_t g_droppedReported = 0; // Writer thread only
+
+    // Steady-clock stamps are converted to wall time by the writer with this offset.
+    std::chrono::system_clock::time_point g_wallAtStart;
+    std::chrono::steady_clock::time_point g_steadyAtStart;
+
+    // Optional .vlog ring file (layout in BinaryLog.h), appended to by the writer thread.
+    struct BinarySink {
+        FILE* File = nullptr;
+        uint32_t HeaderSize = 0;
+        uint32_t BlockCount = 0;
+        uint32_t BlockIndex = 0;
+        uint64_t Sequence = 0;
+        bool Dirty = false;
+        std::vector<uint8_t> Block;
+    };
+    std::mutex g_binaryMutex; // Guards g_binary; held by the writer only while appending a batch
+    BinarySink g_binary;
+
+    BinaryLog::BlockHeader& CurrentBlockHeader() {
+        return *reinterpret_cast<BinaryLog::BlockHeader*>(g_binary.Block.data());
+    }
+
+    void WriteCurrentBlock() {
+        if (!g_binary.Dirty) return;
+        long offset = static_cast<long>(g_binary.HeaderSize + static_cast<uint64_t>(g_binary.BlockIndex) * BinaryLog::BlockSize);
+        if (fseek(g_binary.File, offset, SEEK_SET) == 0) {
+            fwrite(g_binary.Block.data(), 1, g_binary.Block.size(), g_binary.File);
+        }
+        g_binary.Dirty = false;
+    }
+
+    void StartBlock(uint32_t index) {
+        g_binary.BlockIndex = index;
+        std::fill(g_binary.Block.begin(), g_binary.Block.end(), 0);
+        CurrentBlockHeader().Sequence = ++g_binary.Sequence;
+        CurrentBlockHeader().UsedBytes = sizeof(BinaryLog::BlockHeader);
+        g_binary.Dirty = true;
+    }
+
+    // Caller holds g_binaryMutex and has checked g_binary.File.
+    void AppendBinaryRecord(int64_t steadyNs, uint16_t formatId, LogLevel level, const char* payload, size_t size) {
+        size = std::min(size, BinaryLog::MaxPayload);
+        if (CurrentBlockHeader().UsedBytes + sizeof(BinaryLog::RecordHeader) + size > BinaryLog::BlockSize) {
+            WriteCurrentBlock();
+            StartBlock((g_binary.BlockIndex + 1) % g_binary.BlockCount); // Overwrites the oldest block
+        }
+        BinaryLog::BlockHeader& block = CurrentBlockHeader();
+        BinaryLog::RecordHeader record = {};
+        record.SteadyNanoseconds = steadyNs;
+        record.FormatId = formatId;
+        record.PayloadSize = static_cast<uint16_t>(size);
+        record.Level = static_cast<uint8_t>(level);
+        std::memcpy(g_binary.Block.data() + block.UsedBytes, &record, sizeof(record));
+        std::memcpy(g_binary.Block.data() + block.UsedBytes + sizeof(record), payload, size);
+        block.UsedBytes += static_cast<uint32_t>(sizeof(record) + size);
+        block.RecordCount++;
+        g_binary.Dirty = true;
+    }
+
+    void CloseBinaryLocked() {
+        if (!g_binary.File) return;
+        WriteCurrentBlock();
+        fclose(g_binary.File);
+        g_binary = BinarySink();
+    }
+
+    struct QueueOwner {
+        ThreadQueue* Queue = nullptr;
+        ~QueueOwner() {
+            if (Queue) Queue->Retired.store(true, std::memory_order_release);
+        }
+    };
+
+    thread_local ThreadQueue* t_queue = nullptr;
+    thread_local bool t_queueExited = false;
+
+    ThreadQueue* GetThreadQueue() {
+        if (t_queue != nullptr) return t_queue;
+        if (t_queueExited) return nullptr; // Logging from a thread_local destructor after ours ran
+
+        struct Owner : QueueOwner {
+            ~Owner() { t_queue = nullptr; t_queueExited = true; }
+        };
+        thread_local Owner owner;
+        owner.Queue = new (std::nothrow) ThreadQueue();
+        if (owner.Queue == nullptr) return nullptr;
+        {
+            std::lock_guard<std::mutex> lock(g_queuesMutex);
+            g_queues.push_back(owner.Queue);
+        }
+        t_queue = owner.Queue;
+        return t_queue;
+    }
+
+    std::string GetTimestampSafe(std::chrono::system_clock::time_point now) {
         try {
-            auto now = std::chrono::system_clock::now();
             auto now_c = std::chrono::system_clock::to_time_t(now);
             std::stringstream ss;
+#ifdef _MSC_VER
 #pragma warning(suppress : 4996)
+#endif
             std::tm timeinfo = *std::localtime(&now_c);
             ss << std::setfill('0') << std::setw(4) << (timeinfo.tm_year + 1900) << '-' << std::setw(2) << (timeinfo.tm_mon + 1) << '-' << std::setw(2) << timeinfo.tm_mday << ' ' << std::setw(2) << timeinfo.tm_hour << ':' << std::setw(2) << timeinfo.tm_min << ':' << std::setw(2) << timeinfo.tm_sec;
             auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
@@ -34,24 +204,184 @@ namespace {
         catch (...) { return "TIMESTAMP_ERROR"; }
     }
 
-    void LogInternal(const std::string& level, const std::string& message) {
-        if (!DebugBuild) return;
-        if (!g_consoleAllocated) { OutputDebugStringA(("[LogInternal] Console not alloc. Msg: [" + level + "] " + message + "\n").c_str()); return; }
-        std::string logEntry = "[" + GetTimestampSafe() + "] [" + level + "] " + message + "\n";
+    void WriteToConsole(const std::string& text) {
         std::lock_guard<std::mutex> lock(g_logMutex);
-        if (g_conOutFile) { fprintf(g_conOutFile, "%s", logEntry.c_str()); fflush(g_conOutFile); }
+        if (g_conOutFile) { fwrite(text.data(), 1, text.size(), g_conOutFile); fflush(g_conOutFile); }
+    }
+
+    std::string RenderPayload(uint16_t formatId, const char* payload, size_t size) {
+        const char* format = formatId < static_cast<uint16_t>(LogFormat::Count) ? LogFormats[formatId].Format : "";
+        return BinaryLog::RenderRecord(formatId, format, reinterpret_cast<const uint8_t*>(payload), size);
+    }
+
+    // Used before Initialize, after Shutdown, and when a thread has no queue: formats and writes
+    // on the calling thread like the logger always did.
+    void LogSynchronous(LogLevel level, const std::string& message) {
+#ifdef _WIN32
+        if (!g_consoleAllocated) { OutputDebugStringA(("[LogInternal] Console not alloc. Msg: [" + std::string(BinaryLog::LevelName(level)) + "] " + message + "\n").c_str()); return; }
+#else
+        if (!g_consoleAllocated) { fprintf(stderr, "[%s] %s\n", BinaryLog::LevelName(level), message.c_str()); return; }
+#endif
+        WriteToConsole("[" + GetTimestampSafe(std::chrono::system_clock::now()) + "] [" + BinaryLog::LevelName(level) + "] " + message + "\n");
+    }
+
+    void LogInternal(LogLevel level, uint16_t formatId, const char* payload, size_t size) {
+        if (!Logger::IsEnabled(level)) return; // Below VUTRIUM_LOG_LEVEL, for callers not using the macros
+        ThreadQueue* queue = g_writerRunning.load(std::memory_order_acquire) ? GetThreadQueue() : nullptr;
+        if (queue == nullptr) {
+            LogSynchronous(level, RenderPayload(formatId, payload, size));
+            return;
+        }
+        int64_t steadyNs = SteadyNowNs();
+        // Errors go out promptly in case a crash follows; bursts (SDK init) wake the writer early.
+        if (queue->Push(level, formatId, steadyNs, payload, size) && (level == LogLevel::Error || queue->IsFillingUp())) {
+            g_wakeWriter.notify_one();
+        }
+    }
+
+    void LogText(LogLevel level, const std::string& message) {
+        LogInternal(level, static_cast<uint16_t>(LogFormat::Text), message.data(), message.size());
+    }
+
+    struct PendingLine {
+        int64_t SteadyNs;
+        uint16_t FormatId;
+        LogLevel LineLevel;
+        std::string Payload;
+    };
+
+    // Moves everything queued so far to the console, oldest first across all threads.
+    void DrainQueues() {
+        std::vector<ThreadQueue*> queues;
+        {
+            std::lock_guard<std::mutex> lock(g_queuesMutex);
+            queues = g_queues;
+        }
+
+        std::vector<PendingLine> lines;
+        uint64_t dropped = 0;
+        for (ThreadQueue* queue : queues) {
+            uint32_t tail = queue->Tail.load(std::memory_order_relaxed);
+            uint32_t head = queue->Head.load(std::memory_order_acquire);
+            while (tail != head) {
+                const Record& first = queue->Slots[tail % ThreadQueue::Capacity];
+                PendingLine line{ first.SteadyNs, first.FormatId, first.RecordLevel, std::string() };
+                for (;;) {
+                    const Record& slot = queue->Slots[tail % ThreadQueue::Capacity];
+                    line.Payload.append(slot.Data, slot.Length);
+                    ++tail;
+                    if (!slot.Continued) break;
+                }
+                lines.push_back(std::move(line));
+            }
+            queue->Tail.store(tail, std::memory_order_release);
+            dropped += queue->Dropped.load(std::memory_order_relaxed);
+        }
+
+        if (!lines.empty()) {
+            std::stable_sort(lines.begin(), lines.end(), [](const PendingLine& a, const PendingLine& b) {
+                return a.SteadyNs < b.SteadyNs;
+            });
+
+            {
+                std::lock_guard<std::mutex> lock(g_binaryMutex);
+                if (g_binary.File) {
+                    for (const PendingLine& line : lines) {
+                        AppendBinaryRecord(line.SteadyNs, line.FormatId, line.LineLevel, line.Payload.data(), line.Payload.size());
+                    }
+                    WriteCurrentBlock();
+                    fflush(g_binary.File);
+                }
+            }
+
+            std::string output;
+            std::string timestamp;
+            int64_t timestampSecond = -1;
+            for (const PendingLine& line : lines) {
+                auto wall = g_wallAtStart + std::chrono::duration_cast<std::chrono::system_clock::duration>(
+                    std::chrono::nanoseconds(line.SteadyNs) - g_steadyAtStart.time_since_epoch());
+                int64_t wallMs = std::chrono::duration_cast<std::chrono::milliseconds>(wall.time_since_epoch()).count();
+                if (wallMs / 1000 != timestampSecond) {
+                    // localtime is the expensive part; lines within the same second share it.
+                    timestampSecond = wallMs / 1000;
+                    timestamp = GetTimestampSafe(wall);
+                }
+                else {
+                    char millis[8];
+                    snprintf(millis, sizeof(millis), "%03d", static_cast<int>(wallMs % 1000));
+                    timestamp.replace(timestamp.size() - 3, 3, millis);
+                }
+                output += "[";
+                output += timestamp;
+                output += "] [";
+                output += BinaryLog::LevelName(line.LineLevel);
+                output += "] ";
+                output += RenderPayload(line.FormatId, line.Payload.data(), line.Payload.size());
+                output += "\n";
+            }
+            WriteToConsole(output);
+        }
+
+        dropped += g_droppedRetired.load(std::memory_order_relaxed);
+        if (dropped > g_droppedReported) {
+            WriteToConsole("[" + GetTimestampSafe(std::chrono::system_clock::now()) + "] [WARN] Logger: dropped "
+                + std::to_string(dropped - g_droppedReported) + " message(s), queue full.\n");
+            g_droppedReported = dropped;
+        }
+
+        // Queues of exited threads are freed once empty; their drops move to g_droppedRetired.
+        std::lock_guard<std::mutex> lock(g_queuesMutex);
+        for (size_t i = 0; i < g_queues.size();) {
+            ThreadQueue* queue = g_queues[i];
+            if (queue->Retired.load(std::memory_order_acquire) &&
+                queue->Tail.load(std::memory_order_relaxed) == queue->Head.load(std::memory_order_acquire)) {
+                g_droppedRetired.fetch_add(queue->Dropped.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                g_queues[i] = g_queues.back();
+                g_queues.pop_back();
+                delete queue;
+            }
+            else {
+                ++i;
+            }
+        }
+    }
+
+    void WriterLoop() {
+        auto lastSuppressedReport = std::chrono::steady_clock::now();
+        while (g_writerRunning.load(std::memory_order_acquire)) {
+            auto now = std::chrono::steady_clock::now();
+            if (now - lastSuppressedReport >= std::chrono::seconds(1)) {
+                Logger::RateLimiter::ReportSuppressed(); // Queued like any other message, drained below
+                lastSuppressedReport = now;
+            }
+            DrainQueues();
+            std::unique_lock<std::mutex> lock(g_wakeMutex);
+            g_wakeWriter.wait_for(lock, std::chrono::milliseconds(20));
+        }
+        DrainQueues();
+    }
+
+    void StartWriter() {
+        g_wallAtStart = std::chrono::system_clock::now();
+        g_steadyAtStart = std::chrono::steady_clock::now();
+        g_writerRunning.store(true, std::memory_order_release);
+        g_writerThread = std::thread(WriterLoop);
     }
 } // anon namespace
 
 namespace Logger {
     bool Initialize() {
-        if (!DebugBuild) return true;
+        if (!IsEnabled(LogLevel::Error)) return true; // VUTRIUM_LOG_LEVEL 3: logging compiled out, no console
         std::lock_guard<std::mutex> lock(g_logMutex);
         if (g_consoleAllocated) return true;
+#ifndef _WIN32
+        // Headless tools (replay, benchmarks) have no console to allocate; log to stderr.
+        g_conOutFile = stderr; g_consoleAllocated = true; StartWriter(); return true;
+#else
         if (AllocConsole()) {
             if (freopen_s(&g_conOutFile, "CONOUT$", "w", stdout) == 0) {
                 SetConsoleTitleW(L"Vutrium SDK Log"); g_consoleAllocated = true;
-                printf("[INFO] Logger Console Initialized.\n"); fflush(stdout); return true;
+                printf("[INFO] Logger Console Initialized.\n"); fflush(stdout); StartWriter(); return true;
             }
             else { perror("freopen_s failed"); FreeConsole(); return false; }
         }
@@ -59,23 +389,136 @@ namespace Logger {
             if (GetStdHandle(STD_OUTPUT_HANDLE) != INVALID_HANDLE_VALUE) {
                 if (freopen_s(&g_conOutFile, "CONOUT$", "w", stdout) == 0) {
                     OutputDebugStringA("Logger::Initialize(): Console already existed, redirected stdout.\n");
-                    g_consoleAllocated = true; printf("[INFO] Logger Console Attached (already existed).\n"); fflush(stdout); return true;
+                    g_consoleAllocated = true; printf("[INFO] Logger Console Attached (already existed).\n"); fflush(stdout); StartWriter(); return true;
                 }
                 else { OutputDebugStringA("Logger::Initialize(): Console existed, but freopen_s failed.\n"); perror("freopen_s failed"); return false; }
             }
             else { OutputDebugStringA("Logger::Initialize(): AllocConsole failed and GetStdHandle failed.\n"); return false; }
         }
+#endif
     }
     void Shutdown() {
-        std::lock_guard<std::mutex> lock(g_logMutex);
+        std::lock_guard<std::mutex> shutdownLock(g_shutdownMutex);
+        if (!g_writerRunning.load(std::memory_order_acquire) && !g_consoleAllocated) return; // Already shut down
+        // Stop the writer first so everything queued reaches the console before it closes.
+        if (g_writerRunning.exchange(false, std::memory_order_acq_rel)) {
+            g_wakeWriter.notify_one();
+            if (g_writerThread.joinable()) g_writerThread.join();
+        }
+        CloseBinaryLog();
         if (g_consoleAllocated) {
-            LogInternal("INFO", "Logger Shutting Down Console.");
+            LogSynchronous(LogLevel::Info, "Logger Shutting Down Console.");
+            std::lock_guard<std::mutex> lock(g_logMutex);
+#ifdef _WIN32
             if (g_conOutFile) { fclose(g_conOutFile); g_conOutFile = nullptr; }
-            FreeConsole(); g_consoleAllocated = false;
+            FreeConsole();
+#else
+            g_conOutFile = nullptr;
+#endif
+            g_consoleAllocated = false;
+        }
+    }
+    uint64_t GetDroppedCount() {
+        std::lock_guard<std::mutex> lock(g_queuesMutex);
+        uint64_t dropped = g_droppedRetired.load(std::memory_order_relaxed);
+        for (const ThreadQueue* queue : g_queues) dropped += queue->Dropped.load(std::memory_order_relaxed);
+        return dropped;
+    }
+    bool OpenBinaryLog(const std::string& path, size_t fileSize) {
+        if (!g_writerRunning.load(std::memory_order_acquire)) return false; // Stamps are relative to the writer's start
+
+        std::lock_guard<std::mutex> lock(g_binaryMutex);
+        CloseBinaryLocked();
+
+        // Header and format table, padded to a whole block.
+        std::vector<uint8_t> header(sizeof(BinaryLog::FileHeader));
+        for (const LogFormatInfo& info : LogFormats) {
+            BinaryLog::FormatEntry entry = {};
+            entry.Level = static_cast<uint8_t>(info.Level);
+            entry.FormatLength = static_cast<uint16_t>(std::strlen(info.Format));
+            const uint8_t* entryBytes = reinterpret_cast<const uint8_t*>(&entry);
+            header.insert(header.end(), entryBytes, entryBytes + sizeof(entry));
+            header.insert(header.end(), info.Format, info.Format + entry.FormatLength);
         }
+        header.resize((header.size() + BinaryLog::BlockSize - 1) / BinaryLog::BlockSize * BinaryLog::BlockSize, 0);
+
+        BinaryLog::FileHeader fileHeader = {};
+        std::memcpy(fileHeader.Magic, BinaryLog::Magic, sizeof(fileHeader.Magic));
+        fileHeader.SchemaVersion = BinaryLog::SchemaVersion;
+        fileHeader.HeaderSize = static_cast<uint32_t>(header.size());
+        fileHeader.BlockSize = BinaryLog::BlockSize;
+        fileHeader.BlockCount = static_cast<uint32_t>(std::max<size_t>(2, fileSize / BinaryLog::BlockSize));
+        fileHeader.FormatCount = static_cast<uint32_t>(LogFormat::Count);
+        fileHeader.StartUnixMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(g_wallAtStart.time_since_epoch()).count();
+        fileHeader.StartSteadyNanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(g_steadyAtStart.time_since_epoch()).count();
+        std::memcpy(header.data(), &fileHeader, sizeof(fileHeader));
+
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+        FILE* file = fopen(path.c_str(), "wb+");
+        if (!file) return false;
+        if (fwrite(header.data(), 1, header.size(), file) != header.size()) {
+            fclose(file);
+            return false;
+        }
+
+        g_binary.File = file;
+        g_binary.HeaderSize = fileHeader.HeaderSize;
+        g_binary.BlockCount = fileHeader.BlockCount;
+        g_binary.Block.assign(BinaryLog::BlockSize, 0);
+        StartBlock(0);
+        return true;
+    }
+    void CloseBinaryLog() {
+        std::lock_guard<std::mutex> lock(g_binaryMutex);
+        CloseBinaryLocked();
     }
-    void Info(const std::string& message) { LogInternal("INFO", message); }
-    void Warning(const std::string& message) { LogInternal("WARN", message); }
-    void Error(const std::string& message) { LogInternal("ERROR", message); }
+    void LogRecord(LogFormat format, const void* payload, size_t size) {
+        LogInternal(GetLogFormat(format).Level, static_cast<uint16_t>(format), static_cast<const char*>(payload), size);
+    }
+    RateLimiter::RateLimiter(double perSecond, uint32_t burst, const char* file, int line)
+        : intervalNs_(static_cast<int64_t>(1e9 / (perSecond > 0.0 ? perSecond : 1e-9))),
+          toleranceNs_(intervalNs_ * static_cast<int64_t>(burst > 0 ? burst - 1 : 0)),
+          line_(line) {
+        file_ = file; // Just the file name; MSVC's __FILE__ is the full path
+        for (const char* c = file; *c; ++c) {
+            if (*c == '/' || *c == '\\') file_ = c + 1;
+        }
+
+        next_ = g_limiters.load(std::memory_order_relaxed);
+        while (!g_limiters.compare_exchange_weak(next_, this, std::memory_order_release, std::memory_order_relaxed)) {}
+    }
+
+    bool RateLimiter::Allow() {
+        // GCRA form of the token bucket: one atomic instead of a token count and a refill time.
+        int64_t now = SteadyNowNs();
+        int64_t next = nextAllowedNs_.load(std::memory_order_relaxed);
+        for (;;) {
+            if (next - toleranceNs_ > now) {
+                suppressed_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            if (nextAllowedNs_.compare_exchange_weak(next, std::max(next, now) + intervalNs_, std::memory_order_relaxed)) break;
+        }
+        uint64_t suppressed = suppressed_.exchange(0, std::memory_order_relaxed);
+        if (suppressed != 0) Log(LogFormat::LogSuppressed, suppressed, file_, line_);
+        return true;
+    }
+
+    void RateLimiter::ReportSuppressed() {
+        for (RateLimiter* limiter = g_limiters.load(std::memory_order_acquire); limiter; limiter = limiter->next_) {
+            uint64_t suppressed = limiter->suppressed_.exchange(0, std::memory_order_relaxed);
+            if (suppressed != 0) Log(LogFormat::LogSuppressed, suppressed, limiter->file_, limiter->line_);
+        }
+    }
+
+    void Info(const std::string& message) { LogText(LogLevel::Info, message); }
+    void Warning(const std::string& message) { LogText(LogLevel::Warning, message); }
+    void Error(const std::string& message) { LogText(LogLevel::Error, message); }
+#ifdef _WIN32
     void MinHookError(const std::string& prefix, int mhStatus) { Error(prefix + ": " + MH_StatusToString(static_cast<MH_STATUS>(mhStatus)) + " (Code: " + std::to_string(mhStatus) + ")"); }
-}
\ No newline at end of file
+#else
+    void MinHookError(const std::string& prefix, int mhStatus) { Error(prefix + ": MinHook status " + std::to_string(mhStatus)); }
+#endif
+}
@@ -4,10 +4,24 @@
 #include <string>
 #include <mutex>
 #include <sstream> // Needed for to_hex
-#include "includes.h"
+#include <cstdint>
+#include <atomic>
 #include <iomanip> // Needed for to_hex
+#include "BinaryLog.h"
+
+// Lowest level that is compiled in: 0 = Info, 1 = Warning, 2 = Error, 3 = nothing (no console
+// either). The VUTRIUM_LOG_* macros below compile to nothing under it, arguments included.
+#ifndef VUTRIUM_LOG_LEVEL
+#ifdef _DEBUG
+#define VUTRIUM_LOG_LEVEL 0
+#else
+#define VUTRIUM_LOG_LEVEL 1
+#endif
+#endif
 
 namespace Logger {
+    constexpr bool IsEnabled(LogLevel level) { return static_cast<int>(level) >= VUTRIUM_LOG_LEVEL; }
+
     bool Initialize();
     void Shutdown();
     void Info(const std::string& message);
@@ -15,6 +29,53 @@ namespace Logger {
     void Error(const std::string& message);
     void MinHookError(const std::string& prefix, int mhStatus);
 
+    // Messages are queued per thread and written by a background thread started in Initialize().
+    // A full queue drops the message instead of blocking the caller; this is the running total.
+    uint64_t GetDroppedCount();
+
+    // Structured messages: the format string stays in the LogFormats table and only the id and
+    // raw argument bytes are queued, so the caller never formats. Pass addresses as Hex(address).
+    using Hex = BinaryLog::Hex;
+    void LogRecord(LogFormat format, const void* payload, size_t size);
+
+    template<typename... Args>
+    void Log(LogFormat format, const Args&... args) {
+        uint8_t payload[BinaryLog::MaxPayload];
+        BinaryLog::ArgWriter writer(payload, sizeof(payload));
+        (writer.Put(args), ...);
+        LogRecord(format, payload, writer.Size());
+    }
+
+    // Token bucket for one call site: up to 'burst' messages at once, refilled at 'perSecond'.
+    // Use it through VUTRIUM_LOG_LIMITED rather than directly. Safe to share between threads.
+    class RateLimiter {
+    public:
+        RateLimiter(double perSecond, uint32_t burst, const char* file, int line);
+        RateLimiter(const RateLimiter&) = delete;
+        RateLimiter& operator=(const RateLimiter&) = delete;
+
+        // True if a message may go out now. If messages were held back since the last one, a
+        // summary is logged first (the writer thread also reports them once a second).
+        bool Allow();
+
+        // Writer thread: logs and clears the suppressed counts of every limiter.
+        static void ReportSuppressed();
+
+    private:
+        int64_t intervalNs_;
+        int64_t toleranceNs_;
+        std::atomic<int64_t> nextAllowedNs_{ 0 };  // GCRA theoretical arrival time
+        std::atomic<uint64_t> suppressed_{ 0 };
+        const char* file_;
+        int line_;
+        RateLimiter* next_ = nullptr;              // All limiters, for ReportSuppressed
+    };
+
+    // Also appends every message (text or structured) to a .vlog ring file of about 'fileSize'
+    // bytes; decode it with tools/LogDecodeMain.cpp. Needs Initialize() first.
+    bool OpenBinaryLog(const std::string& path, size_t fileSize = BinaryLog::DefaultFileSize);
+    void CloseBinaryLog();
+
     inline std::string to_hex(uintptr_t p) {
         std::stringstream ss;
         ss << "0x" << std::hex << p;
@@ -22,4 +83,29 @@ namespace Logger {
     }
 } // namespace Logger
 
+// Prefer these to calling Logger directly: below VUTRIUM_LOG_LEVEL the whole statement is
+// discarded at compile time, so the message (concatenations, to_string, to_hex) is never built.
+#define VUTRIUM_LOG_INFO(message) \
+    do { if constexpr (Logger::IsEnabled(LogLevel::Info)) Logger::Info(message); } while (0)
+#define VUTRIUM_LOG_WARNING(message) \
+    do { if constexpr (Logger::IsEnabled(LogLevel::Warning)) Logger::Warning(message); } while (0)
+#define VUTRIUM_LOG_ERROR(message) \
+    do { if constexpr (Logger::IsEnabled(LogLevel::Error)) Logger::Error(message); } while (0)
+
+// Structured message; the level comes from the LogFormats table.
+//   VUTRIUM_LOG(LogFormat::SdkAdjustedGNames, Logger::Hex(gnamesAddr));
+#define VUTRIUM_LOG(format, ...) \
+    do { if constexpr (Logger::IsEnabled(GetLogFormat(format).Level)) Logger::Log(format, ##__VA_ARGS__); } while (0)
+
+// VUTRIUM_LOG unless this call site has exceeded its rate. Skipped calls are not evaluated and
+// only counted; the count is logged before the site's next message, or within a second.
+//   VUTRIUM_LOG_LIMITED(1.0, 5, LogFormat::HookGameEventPassed, Logger::Hex(addr), name);
+#define VUTRIUM_LOG_LIMITED(perSecond, burst, format, ...) \
+    do { \
+        if constexpr (Logger::IsEnabled(GetLogFormat(format).Level)) { \
+            static Logger::RateLimiter vutriumLogLimiter(perSecond, burst, __FILE__, __LINE__); \
+            if (vutriumLogLimiter.Allow()) Logger::Log(format, ##__VA_ARGS__); \
+        } \
+    } while (0)
+
 #endif
\ No newline at end of file
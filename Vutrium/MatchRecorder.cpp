@@ -0,0 +1,225 @@
+#include "MatchRecorder.h"
+#include "FrameModel.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+    bool SetFileSize(HANDLE file, uint64_t size) {
+        LARGE_INTEGER position;
+        position.QuadPart = static_cast<LONGLONG>(size);
+        return SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+    }
+
+    // Maps [offset, offset + size) of a file that is at least 'fileSize' bytes long.
+    // The mapping handle is released right away; the view keeps the section alive.
+    void* MapRange(HANDLE file, uint64_t fileSize, uint64_t offset, size_t size) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+                                           static_cast<DWORD>(fileSize >> 32), static_cast<DWORD>(fileSize), nullptr);
+        if (!mapping) return nullptr;
+        void* view = MapViewOfFile(mapping, FILE_MAP_WRITE,
+                                   static_cast<DWORD>(offset >> 32), static_cast<DWORD>(offset), size);
+        CloseHandle(mapping);
+        return view;
+    }
+
+    void CopyName(char* destination, size_t capacity, const char* source) {
+        std::strncpy(destination, source, capacity - 1);
+        destination[capacity - 1] = '\0';
+    }
+}
+
+MatchRecorder::~MatchRecorder() {
+    Close();
+}
+
+bool MatchRecorder::Open(const std::string& path, double tickRate, uint32_t chunkTicks) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CloseLocked();
+
+    lastError_.clear();
+    path_ = path;
+    layout_ = Recording::ComputeLayout(std::clamp<uint32_t>(chunkTicks, 1, 4096));
+
+    file_ = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                        CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        return Fail("Could not create '" + path + "' (error " + std::to_string(::GetLastError()) + ")");
+    }
+    if (!SetFileSize(file_, Recording::HeaderRegionSize)) {
+        return Fail("Could not size header region (error " + std::to_string(::GetLastError()) + ")");
+    }
+    header_ = static_cast<Recording::FileHeader*>(MapRange(file_, Recording::HeaderRegionSize, 0, Recording::HeaderRegionSize));
+    if (!header_) {
+        return Fail("Could not map header (error " + std::to_string(::GetLastError()) + ")");
+    }
+
+    // A freshly extended file reads back as zeros, so only the populated fields are written.
+    std::memcpy(header_->Magic, Recording::Magic, sizeof(header_->Magic));
+    header_->SchemaVersion = Recording::SchemaVersion;
+    header_->HeaderSize = Recording::HeaderRegionSize;
+    header_->ChunkTicks = layout_.ChunkTicks;
+    header_->ChunkStride = layout_.ChunkStride;
+    header_->ColumnCount = Recording::Column_Count;
+    header_->MaxCars = Recording::MaxCars;
+    header_->TickRate = tickRate;
+    header_->StartUnixMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    for (uint32_t c = 0; c < Recording::Column_Count; ++c) {
+        const Recording::ColumnInfo& info = Recording::Columns[c];
+        Recording::ColumnDesc& desc = header_->Columns[c];
+        CopyName(desc.Name, sizeof(desc.Name), info.Name);
+        CopyName(desc.DType, sizeof(desc.DType), info.DType);
+        desc.Offset = layout_.Offsets[c];
+        desc.TickBytes = Recording::TickBytes(info);
+        desc.Shape[0] = info.Shape[0];
+        desc.Shape[1] = info.Shape[1];
+    }
+
+    chunkIndex_ = 0;
+    chunkTick_ = 0;
+    tickCount_ = 0;
+    bytesWritten_ = Recording::HeaderRegionSize;
+    startTime_ = std::chrono::steady_clock::now();
+    recording_ = true;
+
+    Logger::Info("MatchRecorder: Recording to '" + path + "' (" + std::to_string(layout_.ChunkTicks) +
+                 " ticks / " + std::to_string(layout_.ChunkStride / 1024) + " KB per chunk).");
+    return true;
+}
+
+void MatchRecorder::Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    CloseLocked();
+}
+
+void MatchRecorder::CloseLocked() {
+    bool wasRecording = recording_.exchange(false);
+
+    SealChunk();
+    if (header_) {
+        FlushViewOfFile(header_, 0);
+        UnmapViewOfFile(header_);
+        header_ = nullptr;
+    }
+    if (file_ != INVALID_HANDLE_VALUE) {
+        CloseHandle(file_);
+        file_ = INVALID_HANDLE_VALUE;
+    }
+
+    if (wasRecording) {
+        Logger::Info("MatchRecorder: Closed '" + path_ + "' after " + std::to_string(tickCount_.load()) + " ticks.");
+    }
+}
+
+bool MatchRecorder::Fail(const std::string& message) {
+    lastError_ = message;
+    Logger::Error("MatchRecorder: " + message);
+    CloseLocked();
+    return false;
+}
+
+std::string MatchRecorder::GetPath() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return path_;
+}
+
+std::string MatchRecorder::GetError() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lastError_;
+}
+
+bool MatchRecorder::BeginChunk() {
+    SealChunk();
+
+    const uint64_t offset = Recording::HeaderRegionSize + chunkIndex_ * layout_.ChunkStride;
+    const uint64_t fileSize = offset + layout_.ChunkStride;
+    if (!SetFileSize(file_, fileSize)) {
+        return Fail("Could not grow file to " + std::to_string(fileSize) + " bytes (error " + std::to_string(::GetLastError()) + ")");
+    }
+    chunkView_ = static_cast<uint8_t*>(MapRange(file_, fileSize, offset, layout_.ChunkStride));
+    if (!chunkView_) {
+        return Fail("Could not map chunk " + std::to_string(chunkIndex_) + " (error " + std::to_string(::GetLastError()) + ")");
+    }
+
+    auto* chunk = reinterpret_cast<Recording::ChunkHeader*>(chunkView_);
+    chunk->ChunkIndex = static_cast<uint32_t>(chunkIndex_);
+    chunkTick_ = 0;
+
+    header_->ChunkCount = chunkIndex_ + 1;
+    bytesWritten_ = fileSize;
+    return true;
+}
+
+void MatchRecorder::SealChunk() {
+    if (!chunkView_) return;
+    // Dirty pages are written back by the OS; unmapping just drops our view of them.
+    UnmapViewOfFile(chunkView_);
+    chunkView_ = nullptr;
+    ++chunkIndex_;
+}
+
+void MatchRecorder::Append(const FrameModel& frame) {
+    if (!recording_.load(std::memory_order_relaxed) || !frame.InMatch()) return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!recording_.load(std::memory_order_relaxed)) return;
+    if (!chunkView_ || chunkTick_ >= layout_.ChunkTicks) {
+        if (!BeginChunk()) return;
+    }
+
+    using namespace Recording;
+    const uint32_t t = chunkTick_;
+
+    *ColumnAt<uint64_t>(Column_Sequence, t) = frame.Sequence;
+    *ColumnAt<int64_t>(Column_CaptureMicroseconds, t) =
+        std::chrono::duration_cast<std::chrono::microseconds>(frame.CapturedAt - startTime_).count();
+    *ColumnAt<float>(Column_GameTime, t) = frame.GameTime;
+    *ColumnAt<uint8_t>(Column_Flags, t) = static_cast<uint8_t>((frame.HasBall ? TickFlag_HasBall : 0) |
+                                                                (frame.HasCamera ? TickFlag_HasCamera : 0));
+
+    std::memcpy(ColumnAt<float>(Column_BallLocation, t), &frame.Ball.Location, sizeof(float) * 3);
+    std::memcpy(ColumnAt<float>(Column_BallVelocity, t), &frame.Ball.Velocity, sizeof(float) * 3);
+    std::memcpy(ColumnAt<float>(Column_BallAngularVelocity, t), &frame.Ball.AngularVelocity, sizeof(float) * 3);
+
+    std::memcpy(ColumnAt<float>(Column_CameraLocation, t), &frame.CameraLocation, sizeof(float) * 3);
+    std::memcpy(ColumnAt<int32_t>(Column_CameraRotation, t), &frame.CameraRotation, sizeof(int32_t) * 3);
+    *ColumnAt<float>(Column_CameraFOV, t) = frame.CameraFOV;
+
+    const size_t carCount = (std::min)(frame.Cars.size(), static_cast<size_t>(MaxCars));
+    *ColumnAt<uint8_t>(Column_CarCount, t) = static_cast<uint8_t>(carCount);
+    *ColumnAt<int8_t>(Column_LocalCarIndex, t) = static_cast<int8_t>(frame.LocalCarIndex < static_cast<int>(MaxCars) ? frame.LocalCarIndex : -1);
+
+    float* carLocation = ColumnAt<float>(Column_CarLocation, t);
+    float* carVelocity = ColumnAt<float>(Column_CarVelocity, t);
+    int32_t* carRotation = ColumnAt<int32_t>(Column_CarRotation, t);
+    float* carBoost = ColumnAt<float>(Column_CarBoost, t);
+    int8_t* carTeam = ColumnAt<int8_t>(Column_CarTeam, t);
+    for (size_t i = 0; i < MaxCars; ++i) {
+        if (i < carCount) {
+            const FrameModel::CarInfo& car = frame.Cars[i];
+            std::memcpy(carLocation + i * 3, &car.Location, sizeof(float) * 3);
+            std::memcpy(carVelocity + i * 3, &car.Velocity, sizeof(float) * 3);
+            std::memcpy(carRotation + i * 3, &car.Rotation, sizeof(int32_t) * 3);
+            carBoost[i] = car.HasBoost ? car.BoostAmount : -1.0f;
+            carTeam[i] = static_cast<int8_t>(car.TeamIndex);
+        }
+        else {
+            std::memset(carLocation + i * 3, 0, sizeof(float) * 3);
+            std::memset(carVelocity + i * 3, 0, sizeof(float) * 3);
+            std::memset(carRotation + i * 3, 0, sizeof(int32_t) * 3);
+            carBoost[i] = -1.0f;
+            carTeam[i] = -1;
+        }
+    }
+
+    *ColumnAt<uint64_t>(Column_PadActiveMask, t) = frame.PadActiveMask;
+
+    auto* chunk = reinterpret_cast<ChunkHeader*>(chunkView_);
+    if (t == 0) {
+        chunk->FirstSequence = frame.Sequence;
+    }
+    chunk->TickCount = t + 1;
+    ++chunkTick_;
+    header_->TickCount = tickCount_.fetch_add(1, std::memory_order_relaxed) + 1;
+}
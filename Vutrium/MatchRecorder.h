@@ -0,0 +1,64 @@
+#ifndef MATCH_RECORDER_H
+#define MATCH_RECORDER_H
+
+#include <windows.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include "MatchRecording.h"
+
+struct FrameModel;
+
+// Appends sampled FrameModels to a memory-mapped, columnar .vrec file (layout in MatchRecording.h).
+// The file grows one chunk at a time; only the current chunk and the header are mapped, so
+// Append() is a handful of stores into mapped memory and never allocates.
+// Append() is called from the FrameWorker thread, Open()/Close() from the UI.
+class MatchRecorder {
+public:
+    MatchRecorder() = default;
+    ~MatchRecorder();
+    MatchRecorder(const MatchRecorder&) = delete; MatchRecorder& operator=(const MatchRecorder&) = delete;
+
+    bool Open(const std::string& path, double tickRate, uint32_t chunkTicks = Recording::DefaultChunkTicks);
+    void Close();
+    bool IsRecording() const { return recording_.load(std::memory_order_relaxed); }
+
+    // Frames outside a match are skipped.
+    void Append(const FrameModel& frame);
+
+    uint64_t GetTickCount() const { return tickCount_.load(std::memory_order_relaxed); }
+    uint64_t GetBytesWritten() const { return bytesWritten_.load(std::memory_order_relaxed); }
+    std::string GetPath() const;
+    std::string GetError() const;
+
+private:
+    bool BeginChunk();
+    void SealChunk();
+    void CloseLocked();
+    bool Fail(const std::string& message);
+
+    template<typename T>
+    T* ColumnAt(Recording::Column column, uint32_t tick) const {
+        return reinterpret_cast<T*>(chunkView_ + layout_.Offsets[column] + tick * Recording::TickBytes(Recording::Columns[column]));
+    }
+
+    mutable std::mutex mutex_;
+    std::atomic<bool> recording_ = false;
+    std::atomic<uint64_t> tickCount_ = 0;
+    std::atomic<uint64_t> bytesWritten_ = 0;
+
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    Recording::FileHeader* header_ = nullptr;  // Mapped view of the header region
+    uint8_t* chunkView_ = nullptr;             // Mapped view of the chunk being filled
+    Recording::ChunkLayout layout_;
+    uint64_t chunkIndex_ = 0;
+    uint32_t chunkTick_ = 0;
+    std::chrono::steady_clock::time_point startTime_;
+
+    std::string path_;
+    std::string lastError_;
+};
+
+#endif // MATCH_RECORDER_H
@@ -0,0 +1,149 @@
+#ifndef MATCH_RECORDING_H
+#define MATCH_RECORDING_H
+
+#include <cstddef>
+#include <cstdint>
+
+// On-disk layout of a match recording (.vrec), shared by the recorder and anything reading it back.
+//
+// The file is a HeaderRegionSize header followed by fixed-size chunks of ChunkTicks ticks each.
+// Inside a chunk every field is its own column: ChunkTicks consecutive values of one dtype,
+// starting ColumnAlignment-aligned at the offset recorded in the header. The last chunk may be
+// partially filled (ChunkHeader::TickCount), but it is always full size, so the whole body is a
+// plain array of ChunkStride-byte records that numpy can memmap with a structured dtype built
+// from the header (see tools/load_recording.py).
+//
+// All values are little endian; dtypes are numpy type strings.
+namespace Recording {
+    inline constexpr char Magic[8] = { 'V', 'R', 'E', 'C', 'O', 'R', 'D', '\0' };
+    constexpr uint32_t SchemaVersion = 1;
+
+    constexpr uint32_t HeaderRegionSize = 0x10000;  // One allocation granule, so chunks can be mapped on their own
+    constexpr uint32_t ChunkAlignment = 0x10000;
+    constexpr uint32_t ColumnAlignment = 64;
+    constexpr uint32_t DefaultChunkTicks = 256;     // ~2 s at 120 Hz
+    constexpr uint32_t MaxCars = 8;
+    constexpr uint32_t MaxColumns = 32;
+
+    enum TickFlags : uint8_t {
+        TickFlag_HasBall = 1 << 0,
+        TickFlag_HasCamera = 1 << 1
+    };
+
+    enum Column : uint32_t {
+        Column_Sequence,
+        Column_CaptureMicroseconds,  // Since the recording was opened
+        Column_GameTime,
+        Column_Flags,
+        Column_BallLocation,
+        Column_BallVelocity,
+        Column_BallAngularVelocity,
+        Column_CameraLocation,
+        Column_CameraRotation,
+        Column_CameraFOV,
+        Column_CarCount,
+        Column_LocalCarIndex,
+        Column_CarLocation,
+        Column_CarVelocity,
+        Column_CarRotation,
+        Column_CarBoost,             // -1 when the car has no boost component
+        Column_CarTeam,              // -1 when unknown
+        Column_PadActiveMask,        // Bit i = FieldState::BoostPads[i].IsActive
+        Column_Count
+    };
+
+    struct ColumnInfo {
+        const char* Name;
+        const char* DType;
+        uint32_t ValueSize;
+        uint32_t Shape[2];           // Per-tick shape, 0 = unused dimension
+    };
+
+    inline constexpr ColumnInfo Columns[Column_Count] = {
+        { "sequence",              "<u8", 8, { 0, 0 } },
+        { "capture_us",            "<i8", 8, { 0, 0 } },
+        { "game_time",             "<f4", 4, { 0, 0 } },
+        { "flags",                 "|u1", 1, { 0, 0 } },
+        { "ball_location",         "<f4", 4, { 3, 0 } },
+        { "ball_velocity",         "<f4", 4, { 3, 0 } },
+        { "ball_angular_velocity", "<f4", 4, { 3, 0 } },
+        { "camera_location",       "<f4", 4, { 3, 0 } },
+        { "camera_rotation",       "<i4", 4, { 3, 0 } },
+        { "camera_fov",            "<f4", 4, { 0, 0 } },
+        { "car_count",             "|u1", 1, { 0, 0 } },
+        { "local_car_index",       "|i1", 1, { 0, 0 } },
+        { "car_location",          "<f4", 4, { MaxCars, 3 } },
+        { "car_velocity",          "<f4", 4, { MaxCars, 3 } },
+        { "car_rotation",          "<i4", 4, { MaxCars, 3 } },
+        { "car_boost",             "<f4", 4, { MaxCars, 0 } },
+        { "car_team",              "|i1", 1, { MaxCars, 0 } },
+        { "pad_active_mask",       "<u8", 8, { 0, 0 } },
+    };
+    static_assert(Column_Count <= MaxColumns, "Recording header has room for MaxColumns columns");
+
+    // Bytes one tick of 'info' takes up.
+    constexpr uint32_t TickBytes(const ColumnInfo& info) {
+        return info.ValueSize * (info.Shape[0] ? info.Shape[0] : 1) * (info.Shape[1] ? info.Shape[1] : 1);
+    }
+
+    constexpr uint32_t AlignUp(uint32_t value, uint32_t alignment) {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+#pragma pack(push, 1)
+    struct ColumnDesc {
+        char Name[32];
+        char DType[8];
+        uint32_t Offset;             // From the start of the chunk
+        uint32_t TickBytes;          // Stride between consecutive ticks
+        uint32_t Shape[2];
+    }; // Size: 0x38
+
+    struct FileHeader {
+        char Magic[8];
+        uint32_t SchemaVersion;
+        uint32_t HeaderSize;         // Offset of the first chunk
+        uint32_t ChunkTicks;
+        uint32_t ChunkStride;        // Bytes per chunk, including ChunkHeader
+        uint32_t ColumnCount;
+        uint32_t MaxCars;
+        uint64_t ChunkCount;         // Chunks written so far (the last may be partial)
+        uint64_t TickCount;          // Ticks written so far
+        double TickRate;             // Nominal sampling rate in Hz
+        int64_t StartUnixMicroseconds;
+        uint8_t Reserved[64];
+        ColumnDesc Columns[MaxColumns];
+    };
+
+    struct ChunkHeader {
+        uint32_t ChunkIndex;
+        uint32_t TickCount;          // Valid ticks in this chunk
+        uint64_t FirstSequence;
+        uint8_t Reserved[48];
+    }; // Size: 0x40
+#pragma pack(pop)
+
+    static_assert(sizeof(ChunkHeader) == ColumnAlignment, "Columns start right after the chunk header");
+    static_assert(sizeof(FileHeader) <= HeaderRegionSize, "Header must fit its region");
+
+    // Column offsets and chunk size for a given chunk length.
+    struct ChunkLayout {
+        uint32_t ChunkTicks = 0;
+        uint32_t ChunkStride = 0;
+        uint32_t Offsets[Column_Count] = {};
+    };
+
+    inline ChunkLayout ComputeLayout(uint32_t chunkTicks) {
+        ChunkLayout layout;
+        layout.ChunkTicks = chunkTicks;
+        uint32_t offset = sizeof(ChunkHeader);
+        for (uint32_t c = 0; c < Column_Count; ++c) {
+            layout.Offsets[c] = offset;
+            offset = AlignUp(offset + TickBytes(Columns[c]) * chunkTicks, ColumnAlignment);
+        }
+        layout.ChunkStride = AlignUp(offset, ChunkAlignment);
+        return layout;
+    }
+}
+
+#endif // MATCH_RECORDING_H
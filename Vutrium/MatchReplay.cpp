@@ -0,0 +1,220 @@
+#include "MatchReplay.h"
+#include "BallPredictor.h"
+#include "BridgeProtocol.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <thread>
+
+namespace {
+    constexpr uint64_t FNV_OFFSET = 1469598103934665603ull;
+    constexpr uint64_t FNV_PRIME = 1099511628211ull;
+
+    void HashBytes(uint64_t& hash, const void* data, size_t size) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * FNV_PRIME;
+        }
+    }
+
+    template<typename T>
+    void HashValue(uint64_t& hash, const T& value) {
+        HashBytes(hash, &value, sizeof(T));
+    }
+
+    // Columns hold plain float/int32 triples; the frame's vector types aren't trivially copyable.
+    template<typename Vector>
+    void LoadVector(Vector& out, const float* values) {
+        out.X = values[0];
+        out.Y = values[1];
+        out.Z = values[2];
+    }
+
+    void LoadRotator(SDK::FRotatorData& out, const int32_t* values) {
+        out.Pitch = values[0];
+        out.Yaw = values[1];
+        out.Roll = values[2];
+    }
+
+    double SecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+bool MatchReplayReader::Fail(const std::string& message) {
+    error_ = message;
+    data_.clear();
+    tickCount_ = 0;
+    return false;
+}
+
+bool MatchReplayReader::Open(const std::string& path) {
+    error_.clear();
+
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) return Fail("Could not open '" + path + "'");
+    const std::streamsize size = file.tellg();
+    if (size < static_cast<std::streamsize>(sizeof(Recording::FileHeader))) return Fail("File is too small to be a recording");
+
+    data_.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(data_.data()), size)) return Fail("Read failed");
+
+    std::memcpy(&header_, data_.data(), sizeof(header_));
+    if (std::memcmp(header_.Magic, Recording::Magic, sizeof(header_.Magic)) != 0) return Fail("Not a match recording");
+    if (header_.SchemaVersion != Recording::SchemaVersion) {
+        return Fail("Schema version " + std::to_string(header_.SchemaVersion) + ", expected " + std::to_string(Recording::SchemaVersion));
+    }
+    if (header_.ChunkTicks == 0 || header_.ColumnCount > Recording::MaxColumns || header_.MaxCars != Recording::MaxCars) {
+        return Fail("Corrupt header");
+    }
+
+    // Columns are looked up by name so readers don't depend on the writer's column order.
+    for (uint32_t c = 0; c < Recording::Column_Count; ++c) {
+        const Recording::ColumnInfo& info = Recording::Columns[c];
+        bool found = false;
+        for (uint32_t d = 0; d < header_.ColumnCount; ++d) {
+            const Recording::ColumnDesc& desc = header_.Columns[d];
+            if (std::strncmp(desc.Name, info.Name, sizeof(desc.Name)) != 0) continue;
+            if (std::strncmp(desc.DType, info.DType, sizeof(desc.DType)) != 0 || desc.TickBytes != Recording::TickBytes(info) ||
+                desc.Offset + static_cast<uint64_t>(desc.TickBytes) * header_.ChunkTicks > header_.ChunkStride) {
+                return Fail(std::string("Column '") + info.Name + "' has an unexpected layout");
+            }
+            offsets_[c] = desc.Offset;
+            found = true;
+            break;
+        }
+        if (!found) return Fail(std::string("Missing column '") + info.Name + "'");
+    }
+
+    // Count ticks from the chunks themselves; the header total can lag if recording was cut short.
+    const uint64_t available = (data_.size() - std::min<uint64_t>(data_.size(), header_.HeaderSize)) / header_.ChunkStride;
+    const uint64_t chunkCount = std::min<uint64_t>(header_.ChunkCount, available);
+    tickCount_ = 0;
+    for (uint64_t chunk = 0; chunk < chunkCount; ++chunk) {
+        const auto* chunkHeader = reinterpret_cast<const Recording::ChunkHeader*>(
+            data_.data() + header_.HeaderSize + chunk * header_.ChunkStride);
+        tickCount_ += std::min(chunkHeader->TickCount, header_.ChunkTicks);
+        if (chunkHeader->TickCount < header_.ChunkTicks) break;
+    }
+    return true;
+}
+
+int64_t MatchReplayReader::GetCaptureMicroseconds(uint64_t index) const {
+    return index < tickCount_ ? *ColumnAt<int64_t>(Recording::Column_CaptureMicroseconds, index) : 0;
+}
+
+bool MatchReplayReader::ReadTick(uint64_t index, FrameModel& frame) const {
+    if (index >= tickCount_) return false;
+    using namespace Recording;
+
+    frame.Sequence = *ColumnAt<uint64_t>(Column_Sequence, index);
+    frame.CapturedAt = std::chrono::steady_clock::time_point(std::chrono::microseconds(GetCaptureMicroseconds(index)));
+    frame.BuildMicroseconds = 0.0;
+    frame.GameEventAddress = 1; // Only in-match frames are recorded; the real address isn't
+    frame.Error.clear();
+
+    const uint8_t flags = *ColumnAt<uint8_t>(Column_Flags, index);
+    frame.HasBall = (flags & TickFlag_HasBall) != 0;
+    frame.HasCamera = (flags & TickFlag_HasCamera) != 0;
+
+    LoadVector(frame.Ball.Location, ColumnAt<float>(Column_BallLocation, index));
+    LoadVector(frame.Ball.Velocity, ColumnAt<float>(Column_BallVelocity, index));
+    LoadVector(frame.Ball.AngularVelocity, ColumnAt<float>(Column_BallAngularVelocity, index));
+    frame.Prediction.clear();
+
+    LoadVector(frame.CameraLocation, ColumnAt<float>(Column_CameraLocation, index));
+    LoadRotator(frame.CameraRotation, ColumnAt<int32_t>(Column_CameraRotation, index));
+    frame.CameraFOV = *ColumnAt<float>(Column_CameraFOV, index);
+
+    const size_t carCount = std::min<size_t>(*ColumnAt<uint8_t>(Column_CarCount, index), MaxCars);
+    const float* carLocation = ColumnAt<float>(Column_CarLocation, index);
+    const float* carVelocity = ColumnAt<float>(Column_CarVelocity, index);
+    const int32_t* carRotation = ColumnAt<int32_t>(Column_CarRotation, index);
+    const float* carBoost = ColumnAt<float>(Column_CarBoost, index);
+    const int8_t* carTeam = ColumnAt<int8_t>(Column_CarTeam, index);
+    frame.Cars.resize(carCount);
+    for (size_t i = 0; i < carCount; ++i) {
+        FrameModel::CarInfo& car = frame.Cars[i];
+        car.Address = 0;
+        LoadVector(car.Location, carLocation + i * 3);
+        LoadVector(car.Velocity, carVelocity + i * 3);
+        LoadRotator(car.Rotation, carRotation + i * 3);
+        car.HasBoost = carBoost[i] >= 0.0f;
+        car.BoostAmount = car.HasBoost ? carBoost[i] : 0.0f;
+        car.TeamIndex = carTeam[i];
+        car.TeamColor = SDK::FColorData();
+        car.Name.clear();
+    }
+    const int8_t localCar = *ColumnAt<int8_t>(Column_LocalCarIndex, index);
+    frame.LocalCarIndex = localCar >= 0 && static_cast<size_t>(localCar) < carCount ? localCar : -1;
+
+    frame.GameTime = *ColumnAt<float>(Column_GameTime, index);
+    frame.PadActiveMask = *ColumnAt<uint64_t>(Column_PadActiveMask, index);
+    frame.PadTimers.clear();
+    return true;
+}
+
+MatchReplay::Stats MatchReplay::Run(const MatchReplayReader& reader, const Options& options, const FrameCallback& onFrame) const {
+    Stats stats;
+    stats.Digest = FNV_OFFSET;
+
+    SDK::FieldState field;
+    Bridge::BallPredictionStream stream;
+    FrameModel frame;
+    std::string message;
+
+    const uint64_t tickCount = reader.GetTickCount();
+    const int64_t firstCapture = tickCount > 0 ? reader.GetCaptureMicroseconds(0) : 0;
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint64_t i = 0; i < tickCount; ++i) {
+        if (!reader.ReadTick(i, frame)) break;
+
+        if (options.RealTime) {
+            std::this_thread::sleep_until(start + std::chrono::microseconds(reader.GetCaptureMicroseconds(i) - firstCapture));
+        }
+
+        auto stageStart = std::chrono::steady_clock::now();
+        field.ApplyActiveMask(frame.PadActiveMask, frame.GameTime);
+        frame.CapturePads(field);
+        stats.PadSeconds += SecondsSince(stageStart);
+
+        if (options.Predict && frame.HasBall) {
+            stageStart = std::chrono::steady_clock::now();
+            predictor_.Predict(frame.Ball, frame.Prediction);
+            stats.PredictSeconds += SecondsSince(stageStart);
+        }
+
+        message.clear();
+        if (options.StreamBridge) {
+            stageStart = std::chrono::steady_clock::now();
+            if (!frame.HasBall) {
+                stream.Reset();
+            }
+            else if (stream.Update(frame.Ball, predictor_, message)) {
+                ++stats.BridgeMessages;
+                stats.BridgeBytes += message.size();
+            }
+            stats.BridgeSeconds += SecondsSince(stageStart);
+        }
+
+        HashValue(stats.Digest, frame.PadActiveMask);
+        for (const auto& timer : frame.PadTimers) {
+            HashValue(stats.Digest, timer.RemainingSeconds);
+        }
+        for (const auto& slice : frame.Prediction) {
+            HashValue(stats.Digest, slice.State.Location);
+            HashValue(stats.Digest, slice.State.Velocity);
+            HashValue(stats.Digest, slice.Contact);
+        }
+        HashBytes(stats.Digest, message.data(), message.size());
+
+        ++stats.Frames;
+        if (onFrame) onFrame(frame, message);
+    }
+
+    stats.WallSeconds = SecondsSince(start);
+    return stats;
+}
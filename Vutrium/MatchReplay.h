@@ -0,0 +1,81 @@
+#ifndef MATCH_REPLAY_H
+#define MATCH_REPLAY_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "MatchRecording.h"
+#include "FrameModel.h"
+
+class BallPredictor;
+
+// Reads a .vrec recording (MatchRecorder) back into FrameModels. The whole file is loaded
+// up front; a few minutes of recording is tens of MB.
+class MatchReplayReader {
+public:
+    bool Open(const std::string& path);
+    const std::string& GetError() const { return error_; }
+
+    uint64_t GetTickCount() const { return tickCount_; }
+    double GetTickRate() const { return header_.TickRate; }
+    int64_t GetCaptureMicroseconds(uint64_t index) const;
+
+    // Rebuilds what was recorded for tick 'index' (ball, camera, cars, pad mask, game time).
+    // Derived data (prediction, pad timers) is cleared for the consumers to recompute.
+    bool ReadTick(uint64_t index, FrameModel& frame) const;
+
+private:
+    template<typename T>
+    const T* ColumnAt(Recording::Column column, uint64_t index) const {
+        const uint64_t chunk = index / header_.ChunkTicks;
+        const uint64_t tick = index % header_.ChunkTicks;
+        return reinterpret_cast<const T*>(data_.data() + header_.HeaderSize + chunk * header_.ChunkStride +
+                                          offsets_[column] + tick * Recording::TickBytes(Recording::Columns[column]));
+    }
+
+    bool Fail(const std::string& message);
+
+    std::vector<uint8_t> data_;
+    Recording::FileHeader header_ = {};
+    uint32_t offsets_[Recording::Column_Count] = {};
+    uint64_t tickCount_ = 0;
+    std::string error_;
+};
+
+// Feeds recorded frames through the same consumers the DLL runs on live data:
+// FieldState (pad transitions and timers), FrameModel::CapturePads, BallPredictor::Predict
+// for the overlay, and Bridge::BallPredictionStream for the client. Runs at the recorded
+// pace or as fast as possible, and has no Windows dependencies so it can run headless
+// (see tools/ReplayMain.cpp).
+class MatchReplay {
+public:
+    struct Options {
+        bool RealTime = false;       // Sleep to the recorded capture times instead of running flat out
+        bool Predict = true;         // Per-frame prediction, as drawn by the overlay
+        bool StreamBridge = true;    // "ball_prediction" messages, as sent by the server thread
+    };
+
+    struct Stats {
+        uint64_t Frames = 0;
+        uint64_t BridgeMessages = 0;
+        uint64_t BridgeBytes = 0;
+        double WallSeconds = 0.0;
+        double PadSeconds = 0.0;
+        double PredictSeconds = 0.0;
+        double BridgeSeconds = 0.0;
+        uint64_t Digest = 0;         // FNV-1a over everything the consumers produced; compare across builds
+    };
+
+    // Called after every frame with the finished model and the bridge message it produced (empty if none).
+    using FrameCallback = std::function<void(const FrameModel&, const std::string&)>;
+
+    explicit MatchReplay(const BallPredictor& predictor) : predictor_(predictor) {}
+
+    Stats Run(const MatchReplayReader& reader, const Options& options, const FrameCallback& onFrame = nullptr) const;
+
+private:
+    const BallPredictor& predictor_;
+};
+
+#endif // MATCH_REPLAY_H
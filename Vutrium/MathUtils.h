@@ -0,0 +1,39 @@
+#ifndef MATH_UTILS_H
+#define MATH_UTILS_H
+
+#include <cmath>
+
+// Plain float vector used by the prediction code. Kept free of any Windows/SDK
+// headers so the physics side can be reused outside of the injected DLL.
+struct Vec3 {
+    float X = 0.0f;
+    float Y = 0.0f;
+    float Z = 0.0f;
+
+    constexpr Vec3() = default;
+    constexpr Vec3(float x, float y, float z) : X(x), Y(y), Z(z) {}
+
+    constexpr Vec3 operator+(const Vec3& o) const { return { X + o.X, Y + o.Y, Z + o.Z }; }
+    constexpr Vec3 operator-(const Vec3& o) const { return { X - o.X, Y - o.Y, Z - o.Z }; }
+    constexpr Vec3 operator*(float s) const { return { X * s, Y * s, Z * s }; }
+    Vec3& operator+=(const Vec3& o) { X += o.X; Y += o.Y; Z += o.Z; return *this; }
+    Vec3& operator-=(const Vec3& o) { X -= o.X; Y -= o.Y; Z -= o.Z; return *this; }
+    Vec3& operator*=(float s) { X *= s; Y *= s; Z *= s; return *this; }
+};
+
+namespace MathUtils {
+    inline float Dot(const Vec3& a, const Vec3& b) { return a.X * b.X + a.Y * b.Y + a.Z * b.Z; }
+    inline float LengthSquared(const Vec3& v) { return Dot(v, v); }
+    inline float Length(const Vec3& v) { return std::sqrt(Dot(v, v)); }
+
+    inline Vec3 Normalize(const Vec3& v, const Vec3& fallback = { 0.0f, 0.0f, 1.0f }) {
+        float len = Length(v);
+        if (len < 1e-6f) return fallback;
+        return v * (1.0f / len);
+    }
+
+    inline float Clamp(float v, float lo, float hi) { return v < lo ? lo : (v > hi ? hi : v); }
+    inline float Lerp(float a, float b, float t) { return a + (b - a) * t; }
+} // namespace MathUtils
+
+#endif // MATH_UTILS_H
@@ -1,6 +1,10 @@
 #include "MemoryManager.h"
+#include "ReadStats.h"
 #include <stdexcept>
 #include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 
 MemoryManager::MemoryManager() : processHandle(nullptr), processId(0) {}
 
@@ -12,6 +16,10 @@ MemoryManager::MemoryManager(DWORD pid) : processHandle(nullptr), processId(0) {
     Attach(pid);
 }
 
+MemoryManager::MemoryManager(MemoryBackend& backend) : processHandle(nullptr), processId(0) {
+    Attach(backend);
+}
+
 MemoryManager::~MemoryManager() {
     CloseProcessHandle();
 }
@@ -30,37 +38,125 @@ bool MemoryManager::Attach(DWORD pid) {
     return OpenProcessHandle(pid);
 }
 
+bool MemoryManager::Attach(MemoryBackend& backend) {
+    Detach();
+    this->backend = &backend;
+    return true;
+}
+
 void MemoryManager::Detach() {
     CloseProcessHandle();
     processId = 0;
+    backend = nullptr;
 }
 
 bool MemoryManager::IsAttached() const {
+    if (backend != nullptr) return true;
+#ifdef _WIN32
     return processHandle != nullptr && processHandle != INVALID_HANDLE_VALUE;
+#else
+    return false;
+#endif
 }
 
 // --- Memory Operations ---
 bool MemoryManager::ReadBytes(uintptr_t address, void* pBuffer, SIZE_T size) const {
     if (!IsAttached() || pBuffer == nullptr || size == 0) return false;
+    if constexpr (ReadStats::Enabled) {
+        auto start = std::chrono::steady_clock::now();
+        bool success = ReadBytesUncounted(address, pBuffer, size);
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        ReadStats::Record(ReadStats::CurrentCategory(), size, success, static_cast<uint64_t>(elapsed.count()));
+        return success;
+    }
+    else {
+        return ReadBytesUncounted(address, pBuffer, size);
+    }
+}
+
+bool MemoryManager::ReadBytesUncounted(uintptr_t address, void* pBuffer, SIZE_T size) const {
+    if (backend != nullptr) return backend->ReadBytes(address, pBuffer, size);
+#ifdef _WIN32
     SIZE_T bytesRead = 0;
     if (ReadProcessMemory(processHandle, reinterpret_cast<LPCVOID>(address), pBuffer, size, &bytesRead)) {
         return bytesRead == size;
     }
+#endif
     return false;
 }
 
+size_t MemoryManager::ReadScatter(ScatterRead* reads, size_t count) const {
+    if (reads == nullptr || count == 0) return 0;
+    for (size_t i = 0; i < count; ++i) reads[i].Success = false;
+    if (!IsAttached()) return 0;
+
+    // Visit entries in address order so neighbours can share a read. Callers reuse the same
+    // thread for every poll, so the scratch buffers stop growing after the first call.
+    thread_local std::vector<uint32_t> order;
+    thread_local std::vector<uint8_t> span;
+    order.resize(count);
+    for (size_t i = 0; i < count; ++i) order[i] = static_cast<uint32_t>(i);
+    std::sort(order.begin(), order.end(), [reads](uint32_t a, uint32_t b) {
+        return reads[a].Address < reads[b].Address;
+    });
+
+    size_t succeeded = 0;
+    size_t first = 0;
+    while (first < count) {
+        const ScatterRead& head = reads[order[first]];
+        uintptr_t spanStart = head.Address;
+        uintptr_t spanEnd = head.Address + head.Size;
+
+        size_t last = first + 1;
+        for (; last < count; ++last) {
+            const ScatterRead& next = reads[order[last]];
+            const uintptr_t nextEnd = (std::max)(spanEnd, next.Address + next.Size);
+            if (next.Address > spanEnd + ScatterMaxGap || nextEnd - spanStart > ScatterMaxSpan) break;
+            spanEnd = nextEnd;
+        }
+
+        const SIZE_T spanSize = static_cast<SIZE_T>(spanEnd - spanStart);
+        span.resize(spanSize);
+        if (last - first > 1 && spanSize > 0 && ReadBytes(spanStart, span.data(), spanSize)) {
+            for (size_t i = first; i < last; ++i) {
+                ScatterRead& entry = reads[order[i]];
+                if (entry.Buffer == nullptr || entry.Size == 0) continue;
+                std::memcpy(entry.Buffer, span.data() + (entry.Address - spanStart), entry.Size);
+                entry.Success = true;
+                ++succeeded;
+            }
+        }
+        else {
+            // Single entry, or the span crosses an unreadable page: fall back to one read each.
+            for (size_t i = first; i < last; ++i) {
+                ScatterRead& entry = reads[order[i]];
+                entry.Success = ReadBytes(entry.Address, entry.Buffer, entry.Size);
+                if (entry.Success) ++succeeded;
+            }
+        }
+        first = last;
+    }
+    return succeeded;
+}
+
 bool MemoryManager::WriteBytes(uintptr_t address, const void* pBuffer, SIZE_T size) {
     if (!IsAttached() || pBuffer == nullptr || size == 0) return false;
+    if (backend != nullptr) return backend->WriteBytes(address, pBuffer, size);
+#ifdef _WIN32
     SIZE_T bytesWritten = 0;
     if (WriteProcessMemory(processHandle, reinterpret_cast<LPVOID>(address), pBuffer, size, &bytesWritten)) {
         return bytesWritten == size;
     }
+#endif
     return false;
 }
 
 // --- Utility ---
 uintptr_t MemoryManager::GetModuleBaseAddress(const std::wstring& moduleName) const {
     if (!IsAttached() || moduleName.empty()) return 0;
+#ifndef _WIN32
+    return 0; // Backends have no module list; callers get the image base from the backend itself.
+#else
 
     HANDLE hSnap = CreateToolhelp32Snapshot(TH32CS_SNAPMODULE | TH32CS_SNAPMODULE32, processId);
     if (hSnap == INVALID_HANDLE_VALUE) return 0;
@@ -79,6 +175,7 @@ uintptr_t MemoryManager::GetModuleBaseAddress(const std::wstring& moduleName) co
     }
     CloseHandle(hSnap);
     return baseAddress;
+#endif
 }
 
 DWORD MemoryManager::GetProcessId() const {
@@ -91,6 +188,10 @@ HANDLE MemoryManager::GetProcessHandle() const {
 
 // --- Private Helpers ---
 DWORD MemoryManager::FindProcessIdByName(const std::wstring& processName) {
+#ifndef _WIN32
+    (void)processName;
+    return 0;
+#else
     HANDLE hSnap = CreateToolhelp32Snapshot(TH32CS_SNAPPROCESS, 0);
     if (hSnap == INVALID_HANDLE_VALUE) return 0;
 
@@ -108,9 +209,14 @@ DWORD MemoryManager::FindProcessIdByName(const std::wstring& processName) {
     }
     CloseHandle(hSnap);
     return pid;
+#endif
 }
 
 bool MemoryManager::OpenProcessHandle(DWORD pid) {
+#ifndef _WIN32
+    (void)pid;
+    return false;
+#else
     const DWORD desiredAccess = PROCESS_VM_READ | PROCESS_VM_WRITE | PROCESS_VM_OPERATION | PROCESS_QUERY_INFORMATION;
     processHandle = OpenProcess(desiredAccess, FALSE, pid);
     if (processHandle == nullptr) {
@@ -119,13 +225,16 @@ bool MemoryManager::OpenProcessHandle(DWORD pid) {
     }
     processId = pid;
     return true;
+#endif
 }
 
 void MemoryManager::CloseProcessHandle() {
+#ifdef _WIN32
     if (processHandle != nullptr && processHandle != INVALID_HANDLE_VALUE) {
         CloseHandle(processHandle);
-        processHandle = nullptr;
     }
+#endif
+    processHandle = nullptr;
 }
 
 // Implementation for FindPattern
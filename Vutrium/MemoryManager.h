@@ -1,19 +1,38 @@
 #ifndef MEMORY_MANAGER_H
 #define MEMORY_MANAGER_H
 
+#ifdef _WIN32
 #include <windows.h>
+#include <tlhelp32.h>
+#else
+// Headless builds (replay, benchmarks) have no process to attach to, only MemoryBackends.
+#include <cstddef>
+typedef void* HANDLE;
+typedef unsigned long DWORD;
+typedef size_t SIZE_T;
+#endif
 #include <string>
 #include <vector>
-#include <tlhelp32.h>
 #include <cstdint>
 #include <optional> // For std::optional
 
+// Stands in for a target process: a MemoryManager attached to a backend serves every read and
+// write from it instead of ReadProcessMemory. Used to run the reflection layer headless against
+// a fabricated heap (see SyntheticHeap.h).
+class MemoryBackend {
+public:
+    virtual ~MemoryBackend() = default;
+    virtual bool ReadBytes(uintptr_t address, void* pBuffer, size_t size) const = 0;
+    virtual bool WriteBytes(uintptr_t address, const void* pBuffer, size_t size) = 0;
+};
+
 class MemoryManager {
 public:
     // --- Constructors & Destructor ---
     MemoryManager();
     explicit MemoryManager(const std::wstring& processName);
     explicit MemoryManager(DWORD processId);
+    explicit MemoryManager(MemoryBackend& backend);
     ~MemoryManager();
 
     // Disable copy semantics
@@ -23,13 +42,30 @@ public:
     // --- Attachment ---
     bool Attach(const std::wstring& processName);
     bool Attach(DWORD processId);
+    bool Attach(MemoryBackend& backend);
     void Detach();
     bool IsAttached() const;
 
     // --- Memory Operations ---
+    // Reads are charged to the calling thread's ReadScope category when VUTRIUM_READ_STATS is on.
     bool ReadBytes(uintptr_t address, void* pBuffer, SIZE_T size) const;
     bool WriteBytes(uintptr_t address, const void* pBuffer, SIZE_T size);
 
+    // One destination for ReadScatter. Success is set per entry.
+    struct ScatterRead {
+        uintptr_t Address = 0;
+        void* Buffer = nullptr;
+        SIZE_T Size = 0;
+        bool Success = false;
+    };
+
+    // Reads many small, scattered regions in as few calls as possible: entries that lie within
+    // ScatterMaxGap of each other are served from a single read over their combined span.
+    // Returns the number of entries that were read successfully.
+    static constexpr SIZE_T ScatterMaxGap = 0x1000;
+    static constexpr SIZE_T ScatterMaxSpan = 0x10000;
+    size_t ReadScatter(ScatterRead* reads, size_t count) const;
+
     template<typename T>
     std::optional<T> Read(uintptr_t address) const {
         T value{};
@@ -54,11 +90,13 @@ private:
     // --- Private Members ---
     HANDLE processHandle = nullptr;
     DWORD  processId = 0;
+    MemoryBackend* backend = nullptr;
 
     // --- Private Helpers ---
     static DWORD FindProcessIdByName(const std::wstring& processName);
     bool OpenProcessHandle(DWORD pid);
     void CloseProcessHandle();
+    bool ReadBytesUncounted(uintptr_t address, void* pBuffer, SIZE_T size) const;
 };
 
 #endif // MEMORY_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include "ObjectDiscovery.h"
+#include "RLSDK.h"
+#include "EventData.h"
+#include "Logger.h"
+#include "ReadStats.h"
+#include <algorithm>
+
+extern uintptr_t g_GameViewportClientAddress;
+
+namespace {
+    constexpr int MaxClassDepth = 64;
+}
+
+ObjectDiscovery::~ObjectDiscovery() {
+    // Same as FrameWorker: never join from a global destructor that may run under the loader lock.
+    running_ = false;
+    if (thread_.joinable()) {
+        thread_.detach();
+    }
+}
+
+void ObjectDiscovery::Start(RLSDK* sdk) {
+    if (running_.load()) return;
+
+    sdk_ = sdk;
+    gameEventClass_ = viewportClass_ = 0;
+    classKinds_.clear();
+    candidate_ = Found{};
+    reportedCandidate_ = 0;
+    seeded_ = false;
+    objectCount_ = 0;
+    changedChunks_ = 0;
+
+    running_ = true;
+    thread_ = std::thread(&ObjectDiscovery::Run, this);
+    VUTRIUM_LOG_INFO("ObjectDiscovery: Started.");
+}
+
+void ObjectDiscovery::Stop() {
+    RequestStop();
+    if (thread_.joinable()) {
+        thread_.join();
+        VUTRIUM_LOG_INFO("ObjectDiscovery: Stopped.");
+    }
+}
+
+void ObjectDiscovery::RequestStop() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        running_ = false;
+    }
+    wake_.notify_all();
+}
+
+void ObjectDiscovery::Run() {
+    auto nextPass = std::chrono::steady_clock::now();
+    while (running_.load(std::memory_order_relaxed)) {
+        nextPass += DefaultPeriod;
+
+        auto passStart = std::chrono::steady_clock::now();
+        try {
+            Pass();
+        }
+        catch (const std::exception& e) {
+            VUTRIUM_LOG_LIMITED(0.1, 1, LogFormat::DiscoveryPassException, e.what());
+        }
+        std::chrono::duration<double, std::micro> passTime = std::chrono::steady_clock::now() - passStart;
+        lastPassMicroseconds_.store(passTime.count(), std::memory_order_relaxed);
+
+        auto now = std::chrono::steady_clock::now();
+        if (nextPass < now) {
+            nextPass = now;
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        wake_.wait_until(lock, nextPass, [this] { return !running_.load(std::memory_order_relaxed); });
+    }
+}
+
+bool ObjectDiscovery::ResolveClasses() {
+    if (gameEventClass_ != 0) return true;
+
+    // The class objects live for the whole session, so these only need resolving once.
+    gameEventClass_ = sdk_->FindStaticClass(GameEventClassName).Address;
+    viewportClass_ = sdk_->FindStaticClass(ViewportClassName).Address;
+    return gameEventClass_ != 0;
+}
+
+ObjectDiscovery::Kind ObjectDiscovery::Classify(const MemoryManager& mem, uintptr_t classAddress) {
+    auto it = classKinds_.find(classAddress);
+    if (it != classKinds_.end()) {
+        return it->second;
+    }
+
+    // First sighting of this class: walk its SuperField chain once and remember the answer.
+    Kind kind = Kind::Other;
+    SDK::UClass current(classAddress);
+    for (int depth = 0; current.IsValid() && depth < MaxClassDepth; ++depth) {
+        if (current.Address == gameEventClass_) { kind = Kind::GameEvent; break; }
+        if (current.Address == viewportClass_) { kind = Kind::Viewport; break; }
+        current = current.GetSuperClass(mem);
+    }
+    classKinds_.emplace(classAddress, kind);
+    return kind;
+}
+
+bool ObjectDiscovery::IsLiveGameEvent(const MemoryManager& mem, uintptr_t objectAddress) {
+    auto classAddress = mem.Read<uintptr_t>(objectAddress + SDK::UObject::Offset_Class);
+    if (!classAddress || *classAddress == 0 || Classify(mem, *classAddress) != Kind::GameEvent) {
+        return false;
+    }
+    return SDK::UObject(objectAddress).IsLiveInstance(mem);
+}
+
+void ObjectDiscovery::Pass() {
+    ReadScope readScope(ReadCategory::Discovery);
+    if (!sdk_ || !ResolveClasses()) {
+        return; // GObjectsTable not ready (or the class map is missing the GameEvent class)
+    }
+    const MemoryManager& mem = sdk_->GetMemoryManager();
+
+    const GObjectsTable& gobjects = sdk_->GetGObjectsTable();
+    GObjectsTable::ObjectDelta delta;
+    if (!sdk_->GetGObjectsTable().Refresh(mem, &delta)) {
+        return;
+    }
+    if (!seeded_) {
+        // Whoever called Refresh() first (the RLSDK constructor) may already have consumed the
+        // initial everything-is-new delta, so seed from the instance lists of the classes we
+        // care about instead. They already include this pass's additions.
+        seeded_ = true;
+        delta.Added.clear();
+        for (uintptr_t classAddress : gobjects.GetTrackedClasses()) {
+            if (Classify(mem, classAddress) == Kind::Other) continue;
+            std::vector<GObjectsTable::TrackedObject> instances = gobjects.GetInstances(classAddress);
+            delta.Added.insert(delta.Added.end(), instances.begin(), instances.end());
+        }
+    }
+    objectCount_.store(delta.ObjectCount, std::memory_order_relaxed);
+    changedChunks_.store(delta.ChunksChanged, std::memory_order_relaxed);
+
+    const uintptr_t current = sdk_->GetCurrentGameEvent().Address;
+    bool currentRemoved = false;
+    for (const GObjectsTable::TrackedObject& removed : delta.Removed) {
+        if (Classify(mem, removed.Class) != Kind::GameEvent) continue;
+        if (removed.Address == current) currentRemoved = true;
+        if (removed.Address == candidate_.Address) candidate_ = Found{};
+    }
+
+    bool viewportWanted = g_GameViewportClientAddress == 0 && viewportClass_ != 0;
+    for (const GObjectsTable::TrackedObject& added : delta.Added) {
+        Kind kind = Classify(mem, added.Class);
+        if (kind == Kind::Other) continue;
+        if (kind == Kind::Viewport && !viewportWanted) continue;
+        if (!SDK::UObject(added.Address).IsLiveInstance(mem)) continue;
+
+        switch (kind) {
+        case Kind::GameEvent:
+            if (candidate_.Address == 0 || added.Index >= candidate_.Index) {
+                candidate_ = Found{ added.Index, added.Address };
+            }
+            break;
+        case Kind::Viewport:
+            g_GameViewportClientAddress = added.Address;
+            viewportWanted = false;
+            VUTRIUM_LOG(LogFormat::DiscoveryViewportFound, Logger::Hex(added.Address));
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Drop the current GameEvent once it leaves GObjects or stops being a live instance
+    // (actors are flagged pending kill well before the GC frees them), even if no hook said so.
+    EventManager& events = sdk_->GetEventManager();
+    if (current != 0 && (currentRemoved || !IsLiveGameEvent(mem, current))) {
+        VUTRIUM_LOG(LogFormat::DiscoveryGameEventLost, Logger::Hex(current));
+        if (candidate_.Address == current) {
+            candidate_ = Found{};
+        }
+        reportedCandidate_ = 0;
+        EventProbableGameEventFoundData lost(0);
+        events.Fire(EventType::OnProbableGameEventFound, lost);
+    }
+
+    if (candidate_.Address != 0 && !IsLiveGameEvent(mem, candidate_.Address)) {
+        candidate_ = Found{};
+    }
+    if (candidate_.Address != 0 && candidate_.Address != sdk_->GetCurrentGameEvent().Address
+        && candidate_.Address != reportedCandidate_) {
+        reportedCandidate_ = candidate_.Address;
+        VUTRIUM_LOG(LogFormat::DiscoveryGameEventFound, Logger::Hex(candidate_.Address), candidate_.Index);
+        EventProbableGameEventFoundData found(candidate_.Address);
+        events.Fire(EventType::OnProbableGameEventFound, found);
+    }
+}
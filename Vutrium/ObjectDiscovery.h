@@ -0,0 +1,76 @@
+#ifndef OBJECT_DISCOVERY_H
+#define OBJECT_DISCOVERY_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "MemoryManager.h"
+#include "Objects.hpp"
+#include "ObjectPath.h"
+
+class RLSDK;
+
+// Finds the live GameEvent_Soccar_TA and GameViewportClient instances from a background thread,
+// so match detection keeps working when no hook fires. Each pass drives GObjectsTable::Refresh(),
+// which also keeps the table's per-class instance index current for everyone else (e.g. the
+// boost pickups), and only looks at the objects that appeared or disappeared since the previous
+// one. A discovered GameEvent goes through the same OnProbableGameEventFound path (and IsA
+// verification) as the hook heuristic.
+class ObjectDiscovery {
+public:
+    static constexpr std::chrono::milliseconds DefaultPeriod{ 250 };  // 4 Hz
+    static constexpr SDK::ObjectPath GameEventClassName{ "Class TAGame.GameEvent_Soccar_TA" };
+    static constexpr SDK::ObjectPath ViewportClassName{ "Class Engine.GameViewportClient" };
+
+    ObjectDiscovery() = default;
+    ~ObjectDiscovery();
+    ObjectDiscovery(const ObjectDiscovery&) = delete; ObjectDiscovery& operator=(const ObjectDiscovery&) = delete;
+
+    void Start(RLSDK* sdk);
+    void Stop();
+    void RequestStop(); // Signals the thread without joining it, for paths under the loader lock
+    bool IsRunning() const { return running_.load(std::memory_order_relaxed); }
+
+    int32_t GetObjectCount() const { return objectCount_.load(std::memory_order_relaxed); }
+    size_t GetChangedChunks() const { return changedChunks_.load(std::memory_order_relaxed); } // In the last pass
+    double GetLastPassMicroseconds() const { return lastPassMicroseconds_.load(std::memory_order_relaxed); }
+
+private:
+    enum class Kind : uint8_t { Other, GameEvent, Viewport };
+
+    struct Found {
+        int32_t Index = 0;
+        uintptr_t Address = 0;
+    };
+
+    void Run();
+    void Pass();
+    bool ResolveClasses();
+    Kind Classify(const MemoryManager& mem, uintptr_t classAddress);
+    bool IsLiveGameEvent(const MemoryManager& mem, uintptr_t objectAddress);
+
+    RLSDK* sdk_ = nullptr;
+    std::thread thread_;
+    std::atomic<bool> running_ = false;
+    std::mutex wakeMutex_;
+    std::condition_variable wake_;
+
+    // Touched only by the discovery thread.
+    uintptr_t gameEventClass_ = 0;
+    uintptr_t viewportClass_ = 0;
+    std::unordered_map<uintptr_t, Kind> classKinds_;   // Class address -> what it derives from
+    Found candidate_;                                  // Newest live GameEvent seen
+    uintptr_t reportedCandidate_ = 0;                  // Last candidate handed to RLSDK
+    bool seeded_ = false;
+
+    std::atomic<int32_t> objectCount_ = 0;
+    std::atomic<size_t> changedChunks_ = 0;
+    std::atomic<double> lastPassMicroseconds_ = 0.0;
+};
+
+#endif // OBJECT_DISCOVERY_H
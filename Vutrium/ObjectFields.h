@@ -0,0 +1,181 @@
+#ifndef OBJECT_FIELDS_H
+#define OBJECT_FIELDS_H
+
+// Every game object member the SDK reads, by owner class. Each entry becomes a typed
+// SDK::Field alias inside its owner (SDK::AGameEvent::Cars, SDK::AVehicle::PRI, ...) through
+// VUTRIUM_DECLARE_FIELDS in Objects.hpp, and a FieldId/FieldInfo entry in SDK::GetFieldInfo().
+//
+//   X(Owner, Name, Type, Offset, Property)
+//
+// Type is what the accessor returns: a value struct/scalar read as is, or an object wrapper
+// (ATeamInfo, APRI, ...) for a pointer member. TArrays and FStrings are listed by their layout
+// struct. Property is the member's name in the game's reflection data (for bitfields, the first
+// bool sharing the dword). Offsets are relative to the object address.
+//
+// Only the members of the game's own classes live here; the UObject/UField/UStruct header
+// layout that reflection itself is walked with stays in Objects.hpp.
+
+#define VUTRIUM_FIELDS_AActor(X) \
+    X(AActor, Location,        FVectorData,  0x0090, "Location") \
+    X(AActor, Rotation,        FRotatorData, 0x009C, "Rotation") \
+    X(AActor, Velocity,        FVectorData,  0x01A8, "Velocity") \
+    X(AActor, AngularVelocity, FVectorData,  0x01C0, "AngularVelocity")
+
+#define VUTRIUM_FIELDS_AGameEvent(X) \
+    X(AGameEvent, Goals,               TArrayLayout, 0x00D8, "Goals") \
+    X(AGameEvent, CountDownTime,       int32_t,      0x02A0, "CountdownTime") \
+    X(AGameEvent, Players,             TArrayLayout, 0x0330, "Players") \
+    X(AGameEvent, PRIs,                TArrayLayout, 0x0340, "PRIs") \
+    X(AGameEvent, Cars,                TArrayLayout, 0x0350, "Cars") \
+    X(AGameEvent, LocalPlayers,        TArrayLayout, 0x0360, "LocalPlayers") \
+    X(AGameEvent, GameOwner,           APRI,         0x0430, "GameOwner") \
+    X(AGameEvent, Flags,               uint32_t,     0x07F0, "bRoundActive") \
+    X(AGameEvent, GameTime,            int32_t,      0x0814, "GameTime") \
+    X(AGameEvent, WarmupTime,          int32_t,      0x0818, "WarmupTime") \
+    X(AGameEvent, MaxScore,            int32_t,      0x081C, "MaxScore") \
+    X(AGameEvent, TimeRemaining,       float,        0x084C, "TimeRemaining") \
+    X(AGameEvent, SecondsRemaining,    int32_t,      0x0850, "SecondsRemaining") \
+    X(AGameEvent, TotalGameTimePlayed, float,        0x0858, "TotalGameTimePlayed") \
+    X(AGameEvent, OvertimePlayed,      float,        0x085C, "OvertimeTimePlayed") \
+    X(AGameEvent, Balls,               TArrayLayout, 0x08C8, "GameBalls") \
+    X(AGameEvent, Teams,               TArrayLayout, 0x0910, "Teams") \
+    X(AGameEvent, MatchWinner,         ATeam,        0x0918, "MatchWinner") \
+    X(AGameEvent, MVP,                 APRI,         0x0928, "MVP") \
+    X(AGameEvent, FastestGoalPlayer,   APRI,         0x0930, "FastestGoalPlayer") \
+    X(AGameEvent, SlowestGoalPlayer,   APRI,         0x0938, "SlowestGoalPlayer") \
+    X(AGameEvent, FurthestGoalPlayer,  APRI,         0x0940, "FurthestGoalPlayer") \
+    X(AGameEvent, FastestGoalSpeed,    float,        0x0948, "FastestGoalSpeed") \
+    X(AGameEvent, SlowestGoalSpeed,    float,        0x094C, "SlowestGoalSpeed") \
+    X(AGameEvent, FurthestGoal,        float,        0x0950, "FurthestGoal") \
+    X(AGameEvent, ScoringPlayer,       APRI,         0x0958, "ScoringPlayer") \
+    X(AGameEvent, RoundNum,            int32_t,      0x0960, "RoundNum")
+
+#define VUTRIUM_FIELDS_APlayerReplicationInfo(X) \
+    X(APlayerReplicationInfo, Score,      int32_t,       0x0278, "Score") \
+    X(APlayerReplicationInfo, Deaths,     int32_t,       0x027C, "Deaths") \
+    X(APlayerReplicationInfo, Ping,       uint8_t,       0x0280, "Ping") \
+    X(APlayerReplicationInfo, PlayerName, FStringLayout, 0x0288, "PlayerName") \
+    X(APlayerReplicationInfo, PlayerID,   int32_t,       0x02A8, "PlayerID") \
+    X(APlayerReplicationInfo, TeamInfo,   ATeamInfo,     0x02B0, "Team") \
+    X(APlayerReplicationInfo, Flags,      uint32_t,      0x02B8, "bAdmin")
+
+#define VUTRIUM_FIELDS_APRI(X) \
+    X(APRI, GameEvent,           AGameEvent,           0x0480, "GameEvent") \
+    X(APRI, ReplicatedGameEvent, AGameEvent,           0x0488, "ReplicatedGameEvent") \
+    X(APRI, Car,                 ACar,                 0x0490, "Car") \
+    X(APRI, CameraSettings,      ACameraSettingsActor, 0x0608, "CameraSettings") \
+    X(APRI, BoostPickups,        int32_t,              0x0708, "BoostPickups") \
+    X(APRI, BallTouches,         int32_t,              0x070C, "BallTouches") \
+    X(APRI, CarTouches,          int32_t,              0x0710, "CarTouches")
+
+#define VUTRIUM_FIELDS_ACameraSettingsActor(X) \
+    X(ACameraSettingsActor, ProfileSettings, FProfileCameraSettings, 0x0278, "ProfileSettings")
+
+#define VUTRIUM_FIELDS_APawn(X) \
+    X(APawn, PlayerReplicationInfo, APlayerReplicationInfo, 0x0410, "PlayerReplicationInfo")
+
+#define VUTRIUM_FIELDS_UBoostComponent(X) \
+    X(UBoostComponent, ConsumptionRate, float, 0x0300, "BoostConsumptionRate") \
+    X(UBoostComponent, MaxAmount,       float, 0x0304, "MaxBoostAmount") \
+    X(UBoostComponent, StartAmount,     float, 0x0308, "StartBoostAmount") \
+    X(UBoostComponent, CurrentAmount,   float, 0x0330, "CurrentBoostAmount")
+
+#define VUTRIUM_FIELDS_UWheel(X) \
+    X(UWheel, WheelIndex,  int32_t,           0x0158, "WheelIndex") \
+    X(UWheel, ContactData, FWheelContactData, 0x0160, "Contact")
+
+#define VUTRIUM_FIELDS_UVehicleSim(X) \
+    X(UVehicleSim, Wheels,  TArrayLayout, 0x00A0, "Wheels") \
+    X(UVehicleSim, Vehicle, AVehicle,     0x0130, "Vehicle") \
+    X(UVehicleSim, Car,     ACar,         0x0138, "Car")
+
+#define VUTRIUM_FIELDS_AVehicle(X) \
+    X(AVehicle, PRI,              APRI,              0x0410, "PRI") \
+    X(AVehicle, VehicleSim,       UVehicleSim,       0x07B0, "VehicleSim") \
+    X(AVehicle, Flags,            uint32_t,          0x07C8, "bDriving") \
+    X(AVehicle, BoostComponent,   UBoostComponent,   0x0840, "BoostComponent") \
+    X(AVehicle, ReplicatedInputs, VehicleInputsData, 0x09A8, "Input")
+
+#define VUTRIUM_FIELDS_ACar(X) \
+    X(ACar, AttackerPRI, APRI, 0x09E0, "AttackerPRI")
+
+#define VUTRIUM_FIELDS_ATeamInfo(X) \
+    X(ATeamInfo, TeamName,  FStringLayout, 0x0268, "TeamName") \
+    X(ATeamInfo, Score,     int32_t,       0x027C, "Score") \
+    X(ATeamInfo, TeamIndex, int32_t,       0x0280, "TeamIndex") \
+    X(ATeamInfo, TeamColor, FColorData,    0x0284, "TeamColor")
+
+#define VUTRIUM_FIELDS_ATeam(X) \
+    X(ATeam, Members, TArrayLayout, 0x0318, "Members")
+
+#define VUTRIUM_FIELDS_APlayerController(X) \
+    X(APlayerController, PlayerCamera,          ACamera, 0x0480, "PlayerCamera") \
+    X(APlayerController, AcknowledgedPawn,      APawn,   0x0998, "AcknowledgedPawn") \
+    X(APlayerController, PlayerReplicationInfo, APRI,    0x09A0, "PlayerReplicationInfo")
+
+#define VUTRIUM_FIELDS_AVehiclePickup(X) \
+    X(AVehiclePickup, RespawnDelay, float,       0x0268, "RespawnDelay") \
+    X(AVehiclePickup, PickupData,   FPickupData, 0x02A8, "ReplicatedPickupData")
+
+#define VUTRIUM_FIELDS_AVehiclePickup_Boost(X) \
+    X(AVehiclePickup_Boost, BoostAmount, float,   0x02F0, "BoostAmount") \
+    X(AVehiclePickup_Boost, BoostType,   uint8_t, 0x0300, "BoostType")
+
+#define VUTRIUM_FIELDS_AGoal(X) \
+    X(AGoal, TeamNum,   uint8_t,      0x00DC, "TeamNum") \
+    X(AGoal, Location,  FVectorData,  0x0138, "Location") \
+    X(AGoal, Direction, FVectorData,  0x0144, "Direction") \
+    X(AGoal, Right,     FVectorData,  0x0150, "Right") \
+    X(AGoal, Up,        FVectorData,  0x015C, "Up") \
+    X(AGoal, Rotation,  FRotatorData, 0x0168, "Rotation") \
+    X(AGoal, WorldBox,  FBoxData,     0x01A4, "WorldBox")
+
+#define VUTRIUM_FIELDS_UGameViewportClient(X) \
+    X(UGameViewportClient, GameEvent, AGameEvent, 0x02E8, "GameEvent")
+
+#define VUTRIUM_OBJECT_FIELDS(X) \
+    VUTRIUM_FIELDS_AActor(X) \
+    VUTRIUM_FIELDS_AGameEvent(X) \
+    VUTRIUM_FIELDS_APlayerReplicationInfo(X) \
+    VUTRIUM_FIELDS_APRI(X) \
+    VUTRIUM_FIELDS_ACameraSettingsActor(X) \
+    VUTRIUM_FIELDS_APawn(X) \
+    VUTRIUM_FIELDS_UBoostComponent(X) \
+    VUTRIUM_FIELDS_UWheel(X) \
+    VUTRIUM_FIELDS_UVehicleSim(X) \
+    VUTRIUM_FIELDS_AVehicle(X) \
+    VUTRIUM_FIELDS_ACar(X) \
+    VUTRIUM_FIELDS_ATeamInfo(X) \
+    VUTRIUM_FIELDS_ATeam(X) \
+    VUTRIUM_FIELDS_APlayerController(X) \
+    VUTRIUM_FIELDS_AVehiclePickup(X) \
+    VUTRIUM_FIELDS_AVehiclePickup_Boost(X) \
+    VUTRIUM_FIELDS_AGoal(X) \
+    VUTRIUM_FIELDS_UGameViewportClient(X)
+
+// The game class each owner's fields are looked up in by ResolveFieldOffsets(): the class and
+// its supers (AGameEvent's Cars is declared in GameEvent_TA, above GameEvent_Soccar_TA).
+//
+//   X(Owner, Package, Class)
+
+#define VUTRIUM_FIELD_OWNERS(X) \
+    X(AActor,                 "Engine", "Actor") \
+    X(AGameEvent,             "TAGame", "GameEvent_Soccar_TA") \
+    X(APlayerReplicationInfo, "Engine", "PlayerReplicationInfo") \
+    X(APRI,                   "TAGame", "PRI_TA") \
+    X(ACameraSettingsActor,   "TAGame", "CameraSettingsActor_TA") \
+    X(APawn,                  "Engine", "Pawn") \
+    X(UBoostComponent,        "TAGame", "CarComponent_Boost_TA") \
+    X(UWheel,                 "TAGame", "Wheel_TA") \
+    X(UVehicleSim,            "TAGame", "VehicleSim_TA") \
+    X(AVehicle,               "TAGame", "Vehicle_TA") \
+    X(ACar,                   "TAGame", "Car_TA") \
+    X(ATeamInfo,              "Engine", "TeamInfo") \
+    X(ATeam,                  "TAGame", "Team_TA") \
+    X(APlayerController,      "Engine", "PlayerController") \
+    X(AVehiclePickup,         "TAGame", "VehiclePickup_TA") \
+    X(AVehiclePickup_Boost,   "TAGame", "VehiclePickup_Boost_TA") \
+    X(AGoal,                  "TAGame", "Goal_TA") \
+    X(UGameViewportClient,    "TAGame", "GameViewportClient_TA")
+
+#endif // OBJECT_FIELDS_H
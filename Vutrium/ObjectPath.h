@@ -0,0 +1,61 @@
+#ifndef OBJECT_PATH_H
+#define OBJECT_PATH_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace SDK {
+
+    // A full object name ("Function TAGame.GameEvent_TA.ResetPickups") split into the class name
+    // and the object/outer names, so GObjectsTable can look it up by FName ids instead of
+    // comparing rebuilt strings. Splitting is constexpr: the hook and class name constants are
+    // parsed at compile time and only the id lookups happen at runtime.
+    // The views point into the source string, which has to outlive the ObjectPath.
+    struct ObjectPath {
+        static constexpr size_t MaxDepth = 8; // Object plus up to 7 outers (Package.Class.State.Function is 4)
+
+        std::string_view FullName;
+        std::string_view ClassName;                    // "Function"
+        std::array<std::string_view, MaxDepth> Names{}; // Object first, then its outers: ResetPickups, GameEvent_TA, TAGame
+        size_t Depth = 0;
+        bool Valid = false;
+
+        constexpr ObjectPath() = default;
+
+        constexpr ObjectPath(std::string_view fullName) : FullName(fullName) {
+            const size_t space = fullName.find(' ');
+            if (space == std::string_view::npos || space == 0) return;
+            ClassName = fullName.substr(0, space);
+
+            std::string_view path = fullName.substr(space + 1);
+            while (!path.empty()) {
+                if (Depth == MaxDepth) return;
+                const size_t dot = path.rfind('.');
+                const std::string_view name = dot == std::string_view::npos ? path : path.substr(dot + 1);
+                if (name.empty()) return; // "A..B" or a trailing dot
+                Names[Depth++] = name;
+                if (dot == std::string_view::npos) break;
+                path = path.substr(0, dot);
+                if (path.empty()) return; // Leading dot
+            }
+            Valid = Depth > 0;
+        }
+
+        constexpr ObjectPath(const char* fullName) : ObjectPath(std::string_view(fullName)) {}
+        ObjectPath(const std::string& fullName) : ObjectPath(std::string_view(fullName)) {}
+    };
+
+    static_assert(ObjectPath("Class Core.Object").Valid
+                  && ObjectPath("Class Core.Object").Depth == 2
+                  && ObjectPath("Class Core.Object").ClassName == "Class"
+                  && ObjectPath("Class Core.Object").Names[1] == "Core", "ObjectPath split");
+    static_assert(ObjectPath("Function TAGame.VehiclePickup_Boost_TA.Idle.EndState").Names[0] == "EndState"
+                  && ObjectPath("Function TAGame.VehiclePickup_Boost_TA.Idle.EndState").Depth == 4, "ObjectPath split");
+    static_assert(!ObjectPath("Engine.Object.ProcessEvent").Valid && !ObjectPath("Class Core..Object").Valid,
+                  "ObjectPath rejects names without a class or with empty parts");
+
+} // namespace SDK
+
+#endif // OBJECT_PATH_H
@@ -9,7 +9,10 @@
 #include <string>
 #include <cmath>            // For FBox calculations, std::abs
 #include <algorithm>        // For std::max in BoostPadState
+#include <emmintrin.h>       // SSE2 for Utf16ToUtf8
+#ifdef _WIN32
 #include "windows.h"
+#endif
 
 
 namespace SDK {
@@ -87,6 +90,17 @@ namespace SDK {
         return UClass(GetClassAddress(pm));
     }
 
+    uint64_t UObject::GetObjectFlags(const MemoryManager& pm) const {
+        if (!IsValid()) return 0;
+        return pm.Read<uint64_t>(Address + Offset_ObjectFlags).value_or(0);
+    }
+
+    bool UObject::IsLiveInstance(const MemoryManager& pm) const {
+        if (!IsValid()) return false;
+        auto flags = pm.Read<uint64_t>(Address + Offset_ObjectFlags);
+        return flags && (*flags & (RF_ClassDefaultObject | RF_ArchetypeObject | RF_PendingKill)) == 0;
+    }
+
     // GetFullName: Rebuild based on GameDefines.cpp logic using new members/offsets
     std::string UObject::GetFullName(const MemoryManager& pm, const GNameTable& gnames) const {
         if (!IsValid()) return "None"; // Object pointer invalid
@@ -107,7 +121,7 @@ namespace SDK {
             while (currentOuter.IsValid() && depth < maxDepth) {
                 // Prevent potential infinite loops
                 if (currentOuter.Address == this->Address) {
-                    Logger::Warning("GetFullName detected self-referential Outer loop for " + Logger::to_hex(this->Address));
+                    VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::FullNameSelfLoop, Logger::Hex(this->Address));
                     outerPath = "[SelfLoop]." + outerPath;
                     break;
                 }
@@ -123,16 +137,16 @@ namespace SDK {
                 depth++;
             }
              if (depth >= maxDepth) {
-                 Logger::Warning("GetFullName Outer loop reached max depth for " + Logger::to_hex(this->Address));
+                 VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::FullNameMaxDepth, Logger::Hex(this->Address));
                  outerPath = "[MaxDepth]." + outerPath;
             }
         }
         catch (const std::exception& e) {
-            Logger::Error("GetFullName Exc in Outer loop for " + Logger::to_hex(this->Address) + ": " + e.what());
+            VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::FullNameOuterException, Logger::Hex(this->Address), e.what());
             outerPath = "[OuterPathError].";
         }
         catch (...) {
-            Logger::Error("GetFullName Unk Exc in Outer loop for " + Logger::to_hex(this->Address));
+            VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::FullNameOuterUnknown, Logger::Hex(this->Address));
             outerPath = "[OuterPathError].";
         }
 
@@ -148,11 +162,11 @@ namespace SDK {
             }
         }
         catch (const std::exception& e) {
-            Logger::Error("GetFullName Exc getting Class name for " + Logger::to_hex(this->Address) + ": " + e.what());
+            VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::FullNameClassException, Logger::Hex(this->Address), e.what());
             className = "[ClassNameError]";
         }
         catch (...) {
-            Logger::Error("GetFullName Unk Exc getting Class name for " + Logger::to_hex(this->Address));
+            VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::FullNameClassUnknown, Logger::Hex(this->Address));
             className = "[ClassNameError]";
         }
 
@@ -193,11 +207,11 @@ namespace SDK {
              }
         }
         catch (const std::exception& e) {
-            Logger::Error("IsA Exc traversing hierarchy for " + Logger::to_hex(this->Address) + ": " + e.what());
+            VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::IsAException, Logger::Hex(this->Address), e.what());
             return false;
         }
         catch (...) {
-            Logger::Error("IsA Unk Exc traversing hierarchy for " + Logger::to_hex(this->Address));
+            VUTRIUM_LOG_LIMITED(1.0, 10, LogFormat::IsAUnknown, Logger::Hex(this->Address));
             return false;
         }
 
@@ -252,197 +266,204 @@ namespace SDK {
     // and primarily read game-specific offsets relative to their own Address.
     // Double-check if any relied on specific old UObject internals.
 
-    std::vector<ABall> AGameEvent::GetBalls(const MemoryManager& pm) const {
+    TArrayView<ABall> AGameEvent::GetBalls(const MemoryManager& pm) const {
         if (!IsValid()) return {};
-        return GetTArrayItems<ABall>(pm, Address + Offset_Balls);
+        return TArrayView<ABall>(pm, Address + Balls::Offset());
     }
 
-    std::vector<ACar> AGameEvent::GetCars(const MemoryManager& pm) const {
+    TArrayView<ACar> AGameEvent::GetCars(const MemoryManager& pm) const {
         if (!IsValid()) return {};
-        return GetTArrayItems<ACar>(pm, Address + Offset_Cars);
+        return TArrayView<ACar>(pm, Address + Cars::Offset());
     }
 
-    std::vector<APRI> AGameEvent::GetPRIs(const MemoryManager& pm) const {
+    TArrayView<APRI> AGameEvent::GetPRIs(const MemoryManager& pm) const {
         if (!IsValid()) return {};
-        return GetTArrayItems<APRI>(pm, Address + Offset_PRIs);
+        return TArrayView<APRI>(pm, Address + PRIs::Offset());
     }
 
-    std::vector<ATeam> AGameEvent::GetTeams(const MemoryManager& pm) const {
+    TArrayView<ATeam> AGameEvent::GetTeams(const MemoryManager& pm) const {
         if (!IsValid()) return {};
-        return GetTArrayItems<ATeam>(pm, Address + Offset_Teams);
+        return TArrayView<ATeam>(pm, Address + Teams::Offset());
     }
 
-    std::vector<AController> AGameEvent::GetPlayers(const MemoryManager& pm) const {
+    TArrayView<AController> AGameEvent::GetPlayers(const MemoryManager& pm) const {
         if (!IsValid()) return {};
         // Note: This reads the general AController array. You might need GetPRIs for player stats.
-        return GetTArrayItems<AController>(pm, Address + Offset_Players);
+        return TArrayView<AController>(pm, Address + Players::Offset());
     }
 
-    // ... (Keep other AGameEvent methods as they were, reading specific offsets) ...
-    int32_t AGameEvent::GetGameTime(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_GameTime).value_or(0);
-    }
-
-    // ADD BACK MISSING AGAMEEVENT METHODS HERE
-    int32_t AGameEvent::GetWarmupTime(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_WarmupTime).value_or(0);
-    }
-
-    int32_t AGameEvent::GetMaxScore(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_MaxScore).value_or(0);
-    }
-
-    float AGameEvent::GetTimeRemaining(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_TimeRemaining).value_or(0.0f);
-    }
-
-    int32_t AGameEvent::GetSecondsRemaining(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_SecondsRemaining).value_or(0);
-    }
-
-    float AGameEvent::GetTotalGameTimePlayed(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_TotalGameTimePlayed).value_or(0.0f);
-    }
-
-    float AGameEvent::GetOvertimePlayed(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_OvertimePlayed).value_or(0.0f);
-    }
+    // Plain members: one read each through the manifest fields, 0 (or null) when unreadable.
+    int32_t AGameEvent::GetGameTime(const MemoryManager& pm) const { return GameTime::Get(pm, Address); }
+    int32_t AGameEvent::GetWarmupTime(const MemoryManager& pm) const { return WarmupTime::Get(pm, Address); }
+    int32_t AGameEvent::GetMaxScore(const MemoryManager& pm) const { return MaxScore::Get(pm, Address); }
+    float AGameEvent::GetTimeRemaining(const MemoryManager& pm) const { return TimeRemaining::Get(pm, Address); }
+    int32_t AGameEvent::GetSecondsRemaining(const MemoryManager& pm) const { return SecondsRemaining::Get(pm, Address); }
+    float AGameEvent::GetTotalGameTimePlayed(const MemoryManager& pm) const { return TotalGameTimePlayed::Get(pm, Address); }
+    float AGameEvent::GetOvertimePlayed(const MemoryManager& pm) const { return OvertimePlayed::Get(pm, Address); }
 
     // Internal helper macro for reading flags safely
-#define GET_GAMEEVENT_FLAG_IMPL(pm, addr, offset, bit) \
-    (addr != 0 ? ((pm.Read<uint32_t>(addr + offset).value_or(0) >> bit) & 1) : false)
+#define GET_GAMEEVENT_FLAG_IMPL(pm, addr, field, bit) \
+    (((field::Get(pm, addr) >> bit) & 1) != 0)
 
 // Bitfield flag implementations
-    bool AGameEvent::IsRoundActive(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 0); }
-    bool AGameEvent::IsPlayReplays(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 1); }
-    bool AGameEvent::IsBallHasBeenHit(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 2); }
-    bool AGameEvent::IsOvertime(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 3); }
-    bool AGameEvent::IsUnlimitedTime(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 4); }
-    bool AGameEvent::IsNoContest(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 5); }
-    bool AGameEvent::IsDisableGoalDelay(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 6); }
-    bool AGameEvent::IsShowNoScorerGoalMessage(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 7); }
-    bool AGameEvent::IsMatchEnded(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 8); }
-    bool AGameEvent::IsShowIntroScene(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 9); }
-    bool AGameEvent::IsClubMatch(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 10); }
-    bool AGameEvent::IsCanDropOnlineRewards(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 11); }
-    bool AGameEvent::IsAllowHonorDuels(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Offset_Flags, 12); }
+    bool AGameEvent::IsRoundActive(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 0); }
+    bool AGameEvent::IsPlayReplays(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 1); }
+    bool AGameEvent::IsBallHasBeenHit(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 2); }
+    bool AGameEvent::IsOvertime(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 3); }
+    bool AGameEvent::IsUnlimitedTime(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 4); }
+    bool AGameEvent::IsNoContest(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 5); }
+    bool AGameEvent::IsDisableGoalDelay(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 6); }
+    bool AGameEvent::IsShowNoScorerGoalMessage(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 7); }
+    bool AGameEvent::IsMatchEnded(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 8); }
+    bool AGameEvent::IsShowIntroScene(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 9); }
+    bool AGameEvent::IsClubMatch(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 10); }
+    bool AGameEvent::IsCanDropOnlineRewards(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 11); }
+    bool AGameEvent::IsAllowHonorDuels(const MemoryManager& pm) const { return GET_GAMEEVENT_FLAG_IMPL(pm, Address, Flags, 12); }
 
 #undef GET_GAMEEVENT_FLAG_IMPL // Undefine the helper macro
 
-    ATeam AGameEvent::GetMatchWinner(const MemoryManager& pm) const {
-        if (!IsValid()) return ATeam(0);
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_MatchWinner);
-        return ATeam(addrOpt.value_or(0));
-    }
-
-    ATeam AGameEvent::GetGameWinner(const MemoryManager& pm) const {
-        // Assuming same offset as MatchWinner based on prior comments
-        return GetMatchWinner(pm);
-    }
-
-    APRI AGameEvent::GetMVP(const MemoryManager& pm) const {
-        if (!IsValid()) return APRI(0);
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_MVP);
-        return APRI(addrOpt.value_or(0));
-    }
-
-    APRI AGameEvent::GetFastestGoalPlayer(const MemoryManager& pm) const {
-        if (!IsValid()) return APRI(0);
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_FastestGoalPlayer);
-        return APRI(addrOpt.value_or(0));
-    }
-
-    APRI AGameEvent::GetSlowestGoalPlayer(const MemoryManager& pm) const {
-        if (!IsValid()) return APRI(0);
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_SlowestGoalPlayer);
-        return APRI(addrOpt.value_or(0));
-    }
-
-    APRI AGameEvent::GetFurthestGoalPlayer(const MemoryManager& pm) const {
-        if (!IsValid()) return APRI(0);
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_FurthestGoalPlayer);
-        return APRI(addrOpt.value_or(0));
-    }
-
-    float AGameEvent::GetFastestGoalSpeed(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_FastestGoalSpeed).value_or(0.0f);
-    }
-
-    float AGameEvent::GetSlowestGoalSpeed(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_SlowestGoalSpeed).value_or(0.0f);
+    ATeam AGameEvent::GetMatchWinner(const MemoryManager& pm) const { return MatchWinner::Get(pm, Address); }
+    // Assuming same offset as MatchWinner based on prior comments
+    ATeam AGameEvent::GetGameWinner(const MemoryManager& pm) const { return GetMatchWinner(pm); }
+    APRI AGameEvent::GetMVP(const MemoryManager& pm) const { return MVP::Get(pm, Address); }
+    APRI AGameEvent::GetFastestGoalPlayer(const MemoryManager& pm) const { return FastestGoalPlayer::Get(pm, Address); }
+    APRI AGameEvent::GetSlowestGoalPlayer(const MemoryManager& pm) const { return SlowestGoalPlayer::Get(pm, Address); }
+    APRI AGameEvent::GetFurthestGoalPlayer(const MemoryManager& pm) const { return FurthestGoalPlayer::Get(pm, Address); }
+    float AGameEvent::GetFastestGoalSpeed(const MemoryManager& pm) const { return FastestGoalSpeed::Get(pm, Address); }
+    float AGameEvent::GetSlowestGoalSpeed(const MemoryManager& pm) const { return SlowestGoalSpeed::Get(pm, Address); }
+    float AGameEvent::GetFurthestGoal(const MemoryManager& pm) const { return FurthestGoal::Get(pm, Address); }
+    APRI AGameEvent::GetScoringPlayer(const MemoryManager& pm) const { return ScoringPlayer::Get(pm, Address); }
+    int32_t AGameEvent::GetRoundNum(const MemoryManager& pm) const { return RoundNum::Get(pm, Address); }
+    APRI AGameEvent::GetGameOwner(const MemoryManager& pm) const { return GameOwner::Get(pm, Address); }
+    int32_t AGameEvent::GetCountDownTime(const MemoryManager& pm) const { return CountDownTime::Get(pm, Address); }
+
+    TArrayView<AGoal> AGameEvent::GetGoals(const MemoryManager& pm) const {
+        if (!IsValid()) return {};
+        return TArrayView<AGoal>(pm, Address + Goals::Offset());
     }
 
-    float AGameEvent::GetFurthestGoal(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_FurthestGoal).value_or(0.0f);
+    TArrayView<APlayerController> AGameEvent::GetLocalPlayers(const MemoryManager& pm) const {
+        if (!IsValid()) return {};
+        return TArrayView<APlayerController>(pm, Address + LocalPlayers::Offset());
     }
 
-    APRI AGameEvent::GetScoringPlayer(const MemoryManager& pm) const {
-        if (!IsValid()) return APRI(0);
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_ScoringPlayer);
-        return APRI(addrOpt.value_or(0));
-    }
+    // These should also be mostly fine, relying on game-specific offsets.
 
-    int32_t AGameEvent::GetRoundNum(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_RoundNum).value_or(0);
-    }
+    FVectorData AActor::GetLocation(const MemoryManager& pm) const { return Location::Get(pm, Address); }
+    FRotatorData AActor::GetRotation(const MemoryManager& pm) const { return Rotation::Get(pm, Address); }
+    FVectorData AActor::GetVelocity(const MemoryManager& pm) const { return Velocity::Get(pm, Address); }
+    FVectorData AActor::GetAngularVelocity(const MemoryManager& pm) const { return AngularVelocity::Get(pm, Address); }
 
-    APRI AGameEvent::GetGameOwner(const MemoryManager& pm) const {
-        if (!IsValid()) return APRI(0);
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_GameOwner);
-        return APRI(addrOpt.value_or(0));
-    }
+    // --- FString reading ---
 
-    int32_t AGameEvent::GetCountDownTime(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_CountDownTime).value_or(0);
-    }
+    int32_t ReadFStringChars(const MemoryManager& pm, const FStringLayout& layout, char16_t (&out)[MaxFStringChars]) {
+        if (layout.ArrayData == 0 || layout.ArrayCount <= 0) return 0;
+        // ArrayCount includes the terminator; a truncated read simply has none.
+        const int32_t count = (std::min)(layout.ArrayCount, MaxFStringChars);
+        if (!pm.ReadBytes(layout.ArrayData, out, static_cast<size_t>(count) * sizeof(char16_t))) {
+            return -1;
+        }
+        int32_t length = 0;
+        while (length < count && out[length] != u'\0') {
+            ++length;
+        }
+        return length;
+    }
+
+    size_t Utf16ToUtf8(const char16_t* in, size_t count, char* out, size_t outCapacity) {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+        size_t i = 0;
+        size_t written = 0;
+        while (i < count) {
+            // Fast path: runs of units that are all 1..0x7F pack straight down to bytes, sixteen
+            // (then eight) at a time.
+            if (i + 16 <= count && written + 16 <= outCapacity) {
+                const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+                const __m128i bad = _mm_or_si128(_mm_or_si128(_mm_and_si128(low, nonAsciiMask), _mm_and_si128(high, nonAsciiMask)),
+                                                 _mm_or_si128(_mm_cmpeq_epi16(low, zero), _mm_cmpeq_epi16(high, zero)));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(bad, zero)) == 0xFFFF) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + written), _mm_packus_epi16(low, high));
+                    i += 16;
+                    written += 16;
+                    continue;
+                }
+            }
+            if (i + 8 <= count && written + 8 <= outCapacity) {
+                const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                const __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(units, nonAsciiMask), zero);
+                const __m128i nul = _mm_cmpeq_epi16(units, zero);
+                if (_mm_movemask_epi8(_mm_andnot_si128(nul, ascii)) == 0xFFFF) {
+                    _mm_storel_epi64(reinterpret_cast<__m128i*>(out + written), _mm_packus_epi16(units, units));
+                    i += 8;
+                    written += 8;
+                    continue;
+                }
+            }
 
-    std::vector<AGoal> AGameEvent::GetGoals(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        return GetTArrayItems<AGoal>(pm, Address + Offset_Goals);
-    }
+            uint32_t codePoint = in[i];
+            if (codePoint == 0) break;
+            size_t consumed = 1;
+            if (codePoint >= 0xD800 && codePoint <= 0xDFFF) {
+                if (codePoint <= 0xDBFF && i + 1 < count && in[i + 1] >= 0xDC00 && in[i + 1] <= 0xDFFF) {
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (in[i + 1] - 0xDC00u);
+                    consumed = 2;
+                }
+                else {
+                    codePoint = 0xFFFD; // Unpaired surrogate
+                }
+            }
 
-    std::vector<APlayerController> AGameEvent::GetLocalPlayers(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        return GetTArrayItems<APlayerController>(pm, Address + Offset_LocalPlayers);
+            const size_t bytes = codePoint < 0x80 ? 1 : codePoint < 0x800 ? 2 : codePoint < 0x10000 ? 3 : 4;
+            if (written + bytes > outCapacity) break;
+            switch (bytes) {
+            case 1:
+                out[written] = static_cast<char>(codePoint);
+                break;
+            case 2:
+                out[written] = static_cast<char>(0xC0 | (codePoint >> 6));
+                out[written + 1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                break;
+            case 3:
+                out[written] = static_cast<char>(0xE0 | (codePoint >> 12));
+                out[written + 1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out[written + 2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                break;
+            default:
+                out[written] = static_cast<char>(0xF0 | (codePoint >> 18));
+                out[written + 1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+                out[written + 2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                out[written + 3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                break;
+            }
+            written += bytes;
+            i += consumed;
+        }
+        return written;
     }
 
-    // These should also be mostly fine, relying on game-specific offsets.
+    std::string_view FStringCache::Get(const MemoryManager& pm, uintptr_t fstring_address) {
+        if (!pm.IsAttached() || fstring_address == 0) return {};
+        auto layoutOpt = pm.Read<FStringLayout>(fstring_address);
+        if (!layoutOpt || layoutOpt->ArrayData == 0 || layoutOpt->ArrayCount <= 0) return {};
 
-    FVectorData AActor::GetLocation(const MemoryManager& pm) const {
-        if (!IsValid()) return {}; // Return default-initialized struct
-        // Location might be indirect via RootComponent, verify offset validity
-        // Assuming Offset_Location is correct for the game version
-        return pm.Read<FVectorData>(Address + Offset_Location).value_or(FVectorData{});
-    }
+        const Key key{ layoutOpt->ArrayData, layoutOpt->ArrayCount };
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            return it->second;
+        }
 
-    FRotatorData AActor::GetRotation(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_Rotation is correct
-        return pm.Read<FRotatorData>(Address + Offset_Rotation).value_or(FRotatorData{});
-    }
+        char16_t chars[MaxFStringChars];
+        const int32_t length = ReadFStringChars(pm, *layoutOpt, chars);
+        if (length < 0) return {}; // Not cached, so the next call retries
+        char utf8[MaxFStringUtf8Bytes];
+        const size_t bytes = Utf16ToUtf8(chars, static_cast<size_t>(length), utf8, sizeof(utf8));
 
-    FVectorData AActor::GetVelocity(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_Velocity points directly to the FVectorData
-        return pm.Read<FVectorData>(Address + Offset_Velocity).value_or(FVectorData{});
-    }
-
-    FVectorData AActor::GetAngularVelocity(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-       // Assuming Offset_AngularVelocity points directly to the FVectorData
-        return pm.Read<FVectorData>(Address + Offset_AngularVelocity).value_or(FVectorData{});
+        if (entries_.size() >= MaxEntries) {
+            entries_.clear();
+        }
+        return entries_.emplace(key, std::string(utf8, bytes)).first->second;
     }
 
     // Need to update GetPlayerName to use the new GetFString helper (already done in header)
@@ -451,85 +472,63 @@ namespace SDK {
     std::wstring APlayerReplicationInfo::GetPlayerName(const MemoryManager& pm) const {
         if (!IsValid()) return L"";
         // Use the GetFString helper defined in Objects.hpp
-        return GetFString(pm, Address + Offset_PlayerName);
-    }
-
-    uintptr_t APlayerReplicationInfo::GetTeamInfoAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<uintptr_t>(Address + Offset_TeamInfo).value_or(0);
+        return GetFString(pm, Address + PlayerName::Offset());
     }
 
-    ATeamInfo APlayerReplicationInfo::GetTeamInfo(const MemoryManager& pm) const {
-        return ATeamInfo(GetTeamInfoAddress(pm));
-    }
-
-    int32_t APlayerReplicationInfo::GetScore(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_Score).value_or(0);
-    }
-
-    int32_t APlayerReplicationInfo::GetDeaths(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_Deaths).value_or(0);
-    }
-
-    uint8_t APlayerReplicationInfo::GetPing(const MemoryManager& pm) const {
-        if (!IsValid()) return 255; // Use a common max/default value
-        return pm.Read<uint8_t>(Address + Offset_Ping).value_or(255);
+    std::string_view APlayerReplicationInfo::GetPlayerName(const MemoryManager& pm, FStringCache& cache) const {
+        if (!IsValid()) return {};
+        return cache.Get(pm, Address + PlayerName::Offset());
     }
 
-    int32_t APlayerReplicationInfo::GetPlayerID(const MemoryManager& pm) const {
-        if (!IsValid()) return 0; // Or -1 if that's more appropriate
-        return pm.Read<int32_t>(Address + Offset_PlayerID).value_or(0);
-    }
+    uintptr_t APlayerReplicationInfo::GetTeamInfoAddress(const MemoryManager& pm) const { return TeamInfo::Get(pm, Address).Address; }
+    ATeamInfo APlayerReplicationInfo::GetTeamInfo(const MemoryManager& pm) const { return TeamInfo::Get(pm, Address); }
+    int32_t APlayerReplicationInfo::GetScore(const MemoryManager& pm) const { return Score::Get(pm, Address); }
+    int32_t APlayerReplicationInfo::GetDeaths(const MemoryManager& pm) const { return Deaths::Get(pm, Address); }
+    uint8_t APlayerReplicationInfo::GetPing(const MemoryManager& pm) const { return Ping::Get(pm, Address, 255); } // Common max/default
+    int32_t APlayerReplicationInfo::GetPlayerID(const MemoryManager& pm) const { return PlayerID::Get(pm, Address); }
 
     // Internal helper macro for reading PRI flags safely
-#define GET_PRI_FLAG_IMPL(pm, addr, offset, bit) \
-    (addr != 0 ? ((pm.Read<uint32_t>(addr + offset).value_or(0) >> bit) & 1) : false)
+#define GET_PRI_FLAG_IMPL(pm, addr, field, bit) \
+    (((field::Get(pm, addr) >> bit) & 1) != 0)
 
 // Bitfield flag implementations
-    bool APlayerReplicationInfo::IsAdmin(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 0); }
-    bool APlayerReplicationInfo::IsSpectator(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 1); }
-    bool APlayerReplicationInfo::IsOnlySpectator(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 2); }
-    bool APlayerReplicationInfo::IsWaitingPlayer(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 3); }
-    bool APlayerReplicationInfo::IsReadyToPlay(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 4); }
-    bool APlayerReplicationInfo::IsOutOfLives(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 5); }
-    bool APlayerReplicationInfo::IsBot(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 6); }
-    bool APlayerReplicationInfo::IsInactive(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 7); }
-    bool APlayerReplicationInfo::IsFromPreviousLevel(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 8); }
-    bool APlayerReplicationInfo::IsTimedOut(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 9); }
-    bool APlayerReplicationInfo::IsUnregistered(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Offset_Flags, 10); }
+    bool APlayerReplicationInfo::IsAdmin(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 0); }
+    bool APlayerReplicationInfo::IsSpectator(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 1); }
+    bool APlayerReplicationInfo::IsOnlySpectator(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 2); }
+    bool APlayerReplicationInfo::IsWaitingPlayer(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 3); }
+    bool APlayerReplicationInfo::IsReadyToPlay(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 4); }
+    bool APlayerReplicationInfo::IsOutOfLives(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 5); }
+    bool APlayerReplicationInfo::IsBot(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 6); }
+    bool APlayerReplicationInfo::IsInactive(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 7); }
+    bool APlayerReplicationInfo::IsFromPreviousLevel(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 8); }
+    bool APlayerReplicationInfo::IsTimedOut(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 9); }
+    bool APlayerReplicationInfo::IsUnregistered(const MemoryManager& pm) const { return GET_PRI_FLAG_IMPL(pm, Address, Flags, 10); }
 
 #undef GET_PRI_FLAG_IMPL // Undefine the helper macro
 
-    // ADDED implementation for GetCameraSettings
-    std::optional<FProfileCameraSettings> APRI::GetCameraSettings(const MemoryManager& pm) const {
-        if (!IsValid()) return std::nullopt;
-        
-        // First get the Camera (ACameraSettingsActor_TA) address
-        auto cameraAddressOpt = pm.Read<uintptr_t>(Address + Offset_CameraSettings);
-        if (!cameraAddressOpt || *cameraAddressOpt == 0) return std::nullopt;
-        
-        // Now read the ProfileSettings from the Camera object at offset 0x0278
-        return pm.Read<FProfileCameraSettings>(*cameraAddressOpt + Offset_CameraSettingsFProfileCameraSettings);
+    std::optional<FProfileCameraSettings> ACameraSettingsActor::GetProfileSettings(const MemoryManager& pm) const {
+        return ProfileSettings::Read(pm, Address);
     }
 
-    // --- APawn Method Definitions ---
-    uintptr_t APawn::GetPlayerInfoAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        // Assuming Offset_PlayerReplicationInfo is correct for APawn
-        return pm.Read<uintptr_t>(Address + Offset_PlayerReplicationInfo).value_or(0);
+    std::optional<FProfileCameraSettings> APRI::GetCameraSettings(const MemoryManager& pm) const {
+        // The profile lives on the player's CameraSettingsActor_TA
+        return CameraSettings::Get(pm, Address).GetProfileSettings(pm);
     }
 
-    APlayerReplicationInfo APawn::GetPlayerInfo(const MemoryManager& pm) const {
-        // Returns the base class wrapper. User might need to cast to APRI based on context.
-        return APlayerReplicationInfo(GetPlayerInfoAddress(pm));
-    }
+    // --- APawn Method Definitions ---
+    uintptr_t APawn::GetPlayerInfoAddress(const MemoryManager& pm) const { return PlayerReplicationInfo::Get(pm, Address).Address; }
+    // Returns the base class wrapper. User might need to cast to APRI based on context.
+    APlayerReplicationInfo APawn::GetPlayerInfo(const MemoryManager& pm) const { return PlayerReplicationInfo::Get(pm, Address); }
 
     // Update GetName to use GetFString helper
     std::wstring ATeamInfo::GetName(const MemoryManager& pm) const {
         if (!IsValid()) return L"";
-        return GetFString(pm, Address + Offset_TeamName);
+        return GetFString(pm, Address + TeamName::Offset());
+    }
+
+    std::string_view ATeamInfo::GetName(const MemoryManager& pm, FStringCache& cache) const {
+        if (!IsValid()) return {};
+        return cache.Get(pm, Address + TeamName::Offset());
     }
 
     // ... rest of ATeamInfo methods (GetSize might still be problematic)
@@ -543,66 +542,29 @@ namespace SDK {
         return pm.Read<int32_t>(Address + 0x0278 /* Placeholder offset, likely incorrect */).value_or(0);
     }
 
-    int32_t ATeamInfo::GetScore(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_Score).value_or(0);
-    }
+    int32_t ATeamInfo::GetScore(const MemoryManager& pm) const { return Score::Get(pm, Address); }
+    int32_t ATeamInfo::GetIndex(const MemoryManager& pm) const { return TeamIndex::Get(pm, Address, -1); } // 0 or 1 are valid indices
+    FColorData ATeamInfo::GetColor(const MemoryManager& pm) const { return TeamColor::Get(pm, Address); }
 
-    int32_t ATeamInfo::GetIndex(const MemoryManager& pm) const {
-        if (!IsValid()) return -1; // 0 or 1 are valid indices
-        return pm.Read<int32_t>(Address + Offset_TeamIndex).value_or(-1);
-    }
 
-    FColorData ATeamInfo::GetColor(const MemoryManager& pm) const {
-        if (!IsValid()) return {}; // Return default FColorData
-        return pm.Read<FColorData>(Address + Offset_TeamColor).value_or(FColorData{});
-    }
-
-
-    std::vector<APRI> ATeam::GetMembers(const MemoryManager& pm) const {
+    TArrayView<APRI> ATeam::GetMembers(const MemoryManager& pm) const {
         if (!IsValid()) return {};
         // Reads the TArray of APRI pointers representing team members
-        return GetTArrayItems<APRI>(pm, Address + Offset_Members);
-    }
-
-
-    uintptr_t APlayerController::GetPRIActorAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        // Reads the pointer to this controller's Player Replication Info / Player State
-        return pm.Read<uintptr_t>(Address + Offset_PlayerReplicationInfo).value_or(0);
+        return TArrayView<APRI>(pm, Address + Members::Offset());
     }
 
-    APRI APlayerController::GetPRIActor(const MemoryManager& pm) const {
-        // Returns as APRI, assuming the PRI is always an APRI in Rocket League context
-        return APRI(GetPRIActorAddress(pm));
-    }
 
-    uintptr_t APlayerController::GetCarAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        // AcknowledgedPawn usually points to the pawn the controller is currently controlling
-        return pm.Read<uintptr_t>(Address + Offset_AcknowledgedPawn).value_or(0);
-    }
+    uintptr_t APlayerController::GetPRIActorAddress(const MemoryManager& pm) const { return PlayerReplicationInfo::Get(pm, Address).Address; }
+    // Returns as APRI, assuming the PRI is always an APRI in Rocket League context
+    APRI APlayerController::GetPRIActor(const MemoryManager& pm) const { return PlayerReplicationInfo::Get(pm, Address); }
+    // AcknowledgedPawn usually points to the pawn the controller is currently controlling
+    uintptr_t APlayerController::GetCarAddress(const MemoryManager& pm) const { return AcknowledgedPawn::Get(pm, Address).Address; }
+    // Assumes the acknowledged pawn is an ACar
+    ACar APlayerController::GetCar(const MemoryManager& pm) const { return ACar(GetCarAddress(pm)); }
+    uintptr_t APlayerController::GetPlayerCameraAddress(const MemoryManager& pm) const { return PlayerCamera::Get(pm, Address).Address; }
+    ACamera APlayerController::GetPlayerCamera(const MemoryManager& pm) const { return PlayerCamera::Get(pm, Address); }
 
-    ACar APlayerController::GetCar(const MemoryManager& pm) const {
-        // Assumes the acknowledged pawn is an ACar
-        return ACar(GetCarAddress(pm));
-    }
-
-    // IMPLEMENT PlayerCamera Accessors
-    uintptr_t APlayerController::GetPlayerCameraAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<uintptr_t>(Address + Offset_PlayerCamera).value_or(0);
-    }
-
-    ACamera APlayerController::GetPlayerCamera(const MemoryManager& pm) const {
-        return ACamera(GetPlayerCameraAddress(pm));
-    }
-
-    FPickupData AVehiclePickup::GetPickupData(const MemoryManager& pm) const {
-        if (!IsValid()) return {}; // Return default FPickupData
-        // Assuming Offset_PickupData is correct relative to AVehiclePickup address
-        return pm.Read<FPickupData>(Address + Offset_PickupData).value_or(FPickupData{});
-    }
+    FPickupData AVehiclePickup::GetPickupData(const MemoryManager& pm) const { return PickupData::Get(pm, Address); }
 
     ACar AVehiclePickup::GetInstigatorCar(const MemoryManager& pm) const {
         if (!IsValid()) return ACar(0);
@@ -618,24 +580,9 @@ namespace SDK {
         return data.IsPickedUp();
     }
 
-    float AVehiclePickup::GetRespawnDelay(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        // Assuming Offset_RespawnDelay is correct
-        return pm.Read<float>(Address + Offset_RespawnDelay).value_or(0.0f);
-    }
-
-    // These inherit from AVehiclePickup
-    float AVehiclePickup_Boost::GetBoostAmount(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        // Assuming Offset_BoostAmount is correct relative to AVehiclePickup_Boost address
-        return pm.Read<float>(Address + Offset_BoostAmount).value_or(0.0f);
-    }
-
-    uint8_t AVehiclePickup_Boost::GetBoostType(const MemoryManager& pm) const {
-        if (!IsValid()) return 0; // Assuming 0 is an invalid/default type
-        // Assuming Offset_BoostType is correct (may not exist)
-        return pm.Read<uint8_t>(Address + Offset_BoostType).value_or(0);
-    }
+    float AVehiclePickup::GetRespawnDelay(const MemoryManager& pm) const { return RespawnDelay::Get(pm, Address); }
+    float AVehiclePickup_Boost::GetBoostAmount(const MemoryManager& pm) const { return BoostAmount::Get(pm, Address); }
+    uint8_t AVehiclePickup_Boost::GetBoostType(const MemoryManager& pm) const { return BoostType::Get(pm, Address); } // 0 if unused
 
     bool AVehiclePickup_Boost::IsBigPad(const MemoryManager& pm) const {
         // Logic might depend on BoostType enum or amount. Using amount for now.
@@ -645,48 +592,13 @@ namespace SDK {
         return amount > 50.0f; // Example threshold, adjust as needed
     }
 
-    // Fix implementations assuming AGoal definition is correct in Objects.hpp
-    uint8_t AGoal::GetTeamNum(const MemoryManager& pm) const {
-        if (!IsValid()) return 255; // Use an invalid team number like 255
-        // Assuming Offset_TeamNum is correct
-        return pm.Read<uint8_t>(Address + Offset_TeamNum).value_or(255);
-    }
-
-    FVectorData AGoal::GetLocation(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_Location is correct
-        return pm.Read<FVectorData>(Address + Offset_Location).value_or(FVectorData{});
-    }
-
-    FVectorData AGoal::GetDirection(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_Direction is correct
-        return pm.Read<FVectorData>(Address + Offset_Direction).value_or(FVectorData{});
-    }
-
-    FVectorData AGoal::GetRight(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_Right is correct
-        return pm.Read<FVectorData>(Address + Offset_Right).value_or(FVectorData{});
-    }
-
-    FVectorData AGoal::GetUp(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_Up is correct
-        return pm.Read<FVectorData>(Address + Offset_Up).value_or(FVectorData{});
-    }
-
-    FRotatorData AGoal::GetRotation(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_Rotation is correct
-        return pm.Read<FRotatorData>(Address + Offset_Rotation).value_or(FRotatorData{});
-    }
-
-    FBoxData AGoal::GetWorldBox(const MemoryManager& pm) const {
-        if (!IsValid()) return {};
-        // Assuming Offset_WorldBox is correct
-        return pm.Read<FBoxData>(Address + Offset_WorldBox).value_or(FBoxData{});
-    }
+    uint8_t AGoal::GetTeamNum(const MemoryManager& pm) const { return TeamNum::Get(pm, Address, 255); } // 255: no team
+    FVectorData AGoal::GetLocation(const MemoryManager& pm) const { return Location::Get(pm, Address); }
+    FVectorData AGoal::GetDirection(const MemoryManager& pm) const { return Direction::Get(pm, Address); }
+    FVectorData AGoal::GetRight(const MemoryManager& pm) const { return Right::Get(pm, Address); }
+    FVectorData AGoal::GetUp(const MemoryManager& pm) const { return Up::Get(pm, Address); }
+    FRotatorData AGoal::GetRotation(const MemoryManager& pm) const { return Rotation::Get(pm, Address); }
+    FBoxData AGoal::GetWorldBox(const MemoryManager& pm) const { return WorldBox::Get(pm, Address); }
 
     float AGoal::GetWidth(const MemoryManager& pm) const {
         if (!IsValid()) return 0.0f;
@@ -712,16 +624,8 @@ namespace SDK {
         return std::abs(box.Max.X - box.Min.X);
     }
 
-    // Fix implementations assuming definition is correct in Objects.hpp
-    uintptr_t UGameViewportClient::GetGameEventAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        // Assuming Offset_GameEvent is correct
-        return pm.Read<uintptr_t>(Address + Offset_GameEvent).value_or(0);
-    }
-
-    AGameEvent UGameViewportClient::GetGameEvent(const MemoryManager& pm) const {
-        return AGameEvent(GetGameEventAddress(pm));
-    }
+    uintptr_t UGameViewportClient::GetGameEventAddress(const MemoryManager& pm) const { return GameEvent::Get(pm, Address).Address; }
+    AGameEvent UGameViewportClient::GetGameEvent(const MemoryManager& pm) const { return GameEvent::Get(pm, Address); }
 
     // --- BoostPadState Method Definitions --- (Should be fine, not directly using UObject offsets)
     // ... (Keep BoostPadState methods as they were)
@@ -731,132 +635,28 @@ namespace SDK {
     // Note: UpdateAllPads relies on AVehiclePickup_Boost::GetLocation which comes from AActor -> UObject
     // Ensure AVehiclePickup_Boost definition in Objects.hpp is correct.
 
-    APRI AVehicle::GetPRI(const MemoryManager& pm) const {
-        // Read ReplicatedPRI directly from AVehicle offset
-        if (!IsValid()) return APRI(0);
-        auto priAddrOpt = pm.Read<uintptr_t>(Address + Offset_PRI); 
-        return APRI(priAddrOpt.value_or(0));
-    }
-
-    // NEW: Add the missing implementation for GetBoostComponent
-    uintptr_t AVehicle::GetBoostComponentAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_BoostComponent);
-        return addrOpt.value_or(0);
-    }
-
-    // NEW: Add the missing implementation for GetBoostComponent
-    UBoostComponent AVehicle::GetBoostComponent(const MemoryManager& pm) const {
-        return UBoostComponent(GetBoostComponentAddress(pm));
-    }
-
-    // NEW: Add the missing implementation for GetAmount
-    float UBoostComponent::GetAmount(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        auto amountOpt = pm.Read<float>(Address + Offset_CurrentAmount);
-        // Multiply by 100 to convert from 0.0-1.0 scale to 0-100 percentage
-        return amountOpt.value_or(0.0f) * 100.0f;
-    }
-
-    uintptr_t APRI::GetCarAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        auto addrOpt = pm.Read<uintptr_t>(Address + Offset_Car);
-        return addrOpt.value_or(0);
-    }
-
-    ACar APRI::GetCar(const MemoryManager& pm) const {
-        return ACar(GetCarAddress(pm));
-    }
-
-    int32_t APRI::GetBallTouches(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_BallTouches).value_or(0);
-    }
-
-    int32_t APRI::GetCarTouches(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_CarTouches).value_or(0);
-    }
-
-    int32_t APRI::GetBoostPickups(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<int32_t>(Address + Offset_BoostPickups).value_or(0);
-    }
-
-    uintptr_t APRI::GetGameEventAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<uintptr_t>(Address + Offset_GameEvent).value_or(0);
-    }
-
-    AGameEvent APRI::GetGameEvent(const MemoryManager& pm) const {
-        return AGameEvent(GetGameEventAddress(pm));
-    }
-
-    uintptr_t APRI::GetReplicatedGameEventAddress(const MemoryManager& pm) const {
-        if (!IsValid()) return 0;
-        return pm.Read<uintptr_t>(Address + Offset_ReplicatedGameEvent).value_or(0);
-    }
-
-    AGameEvent APRI::GetReplicatedGameEvent(const MemoryManager& pm) const {
-        return AGameEvent(GetReplicatedGameEventAddress(pm));
-    }
-
-    float UBoostComponent::GetMaxAmount(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_MaxAmount).value_or(0.0f);
-    }
-
-    float UBoostComponent::GetConsumptionRate(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_ConsumptionRate).value_or(0.0f);
-    }
-
-    float UBoostComponent::GetStartAmount(const MemoryManager& pm) const {
-        if (!IsValid()) return 0.0f;
-        return pm.Read<float>(Address + Offset_StartAmount).value_or(0.0f);
-    }
-
-    // --- BoostPadState Method Definitions ---
-    void SDK::BoostPadState::Reset() {
-        IsActive = true;
-        PickupActorAddress = 0;
-        PickedUpTime = std::chrono::steady_clock::time_point(); // Default/empty time point
-    }
-
-    float SDK::BoostPadState::RespawnTimeSeconds() const {
-        return IsBigPad ? 10.0f : 4.0f; // Big pads take 10 seconds, small pads take 4 seconds
-    }
-
-    std::optional<float> SDK::BoostPadState::GetElapsedSeconds() const {
-        // If we don't have a pickup time, return nullopt
-        if (PickedUpTime == std::chrono::steady_clock::time_point()) {
-            return std::nullopt;
-        }
-        
-        // Calculate elapsed time since pickup
-        auto now = std::chrono::steady_clock::now();
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - PickedUpTime).count() / 1000.0f;
-        return elapsed;
-    }
-
-    std::optional<float> SDK::BoostPadState::GetRemainingSeconds() const {
-        auto elapsed = GetElapsedSeconds();
-        if (!elapsed) {
-            return std::nullopt;
-        }
-        
-        // Calculate remaining time
-        float respawnTime = RespawnTimeSeconds();
-        float remaining = respawnTime - *elapsed;
-        return std::max(0.0f, remaining); // Don't return negative time
-    }
-
-    void SDK::BoostPadState::MarkInactive() {
-        IsActive = false;
-        PickedUpTime = std::chrono::steady_clock::now();
-    }
-
-    void SDK::BoostPadState::UpdateState(MemoryManager& pm) {
+    APRI AVehicle::GetPRI(const MemoryManager& pm) const { return PRI::Get(pm, Address); } // ReplicatedPRI
+    uintptr_t AVehicle::GetBoostComponentAddress(const MemoryManager& pm) const { return BoostComponent::Get(pm, Address).Address; }
+    UBoostComponent AVehicle::GetBoostComponent(const MemoryManager& pm) const { return BoostComponent::Get(pm, Address); }
+
+    // 0-100: CurrentAmount is stored on a 0.0-1.0 scale
+    float UBoostComponent::GetAmount(const MemoryManager& pm) const { return CurrentAmount::Get(pm, Address) * 100.0f; }
+    float UBoostComponent::GetMaxAmount(const MemoryManager& pm) const { return MaxAmount::Get(pm, Address); }
+    float UBoostComponent::GetConsumptionRate(const MemoryManager& pm) const { return ConsumptionRate::Get(pm, Address); }
+    float UBoostComponent::GetStartAmount(const MemoryManager& pm) const { return StartAmount::Get(pm, Address); }
+
+    uintptr_t APRI::GetCarAddress(const MemoryManager& pm) const { return Car::Get(pm, Address).Address; }
+    ACar APRI::GetCar(const MemoryManager& pm) const { return Car::Get(pm, Address); }
+    int32_t APRI::GetBallTouches(const MemoryManager& pm) const { return BallTouches::Get(pm, Address); }
+    int32_t APRI::GetCarTouches(const MemoryManager& pm) const { return CarTouches::Get(pm, Address); }
+    int32_t APRI::GetBoostPickups(const MemoryManager& pm) const { return BoostPickups::Get(pm, Address); }
+    uintptr_t APRI::GetGameEventAddress(const MemoryManager& pm) const { return GameEvent::Get(pm, Address).Address; }
+    AGameEvent APRI::GetGameEvent(const MemoryManager& pm) const { return GameEvent::Get(pm, Address); }
+    uintptr_t APRI::GetReplicatedGameEventAddress(const MemoryManager& pm) const { return ReplicatedGameEvent::Get(pm, Address).Address; }
+    AGameEvent APRI::GetReplicatedGameEvent(const MemoryManager& pm) const { return ReplicatedGameEvent::Get(pm, Address); }
+
+    // --- Pad state updates that read pickup actors (pure state logic lives in FieldState.cpp) ---
+    void SDK::BoostPadState::UpdateState(MemoryManager& pm, float gameTime) {
         // If we don't have a pickup actor address, we can't update
         if (PickupActorAddress == 0) {
             return;
@@ -864,54 +664,14 @@ namespace SDK {
         
         // Read the pickup data to see if it's picked up
         AVehiclePickup pickup(PickupActorAddress);
-        bool isPickedUp = pickup.IsPickedUp(pm);
-        
-        // If the state changed from active to inactive, mark the time
-        if (IsActive && isPickedUp) {
-            MarkInactive();
-        }
-        // If the state changed from inactive to active, reset
-        else if (!IsActive && !isPickedUp) {
-            Reset();
-        }
-        
-        // If it's been inactive for longer than the respawn time, it should be active again
-        auto remaining = GetRemainingSeconds();
-        if (!IsActive && remaining && *remaining <= 0.0f) {
-            Reset();
-        }
-    }
-
-    // --- FieldState Method Definitions ---
-    void SDK::FieldState::ResetBoostPads() {
-        for (auto& pad : BoostPads) {
-            pad.Reset();
-        }
-    }
-
-    SDK::BoostPadState* SDK::FieldState::FindPadByLocation(const Vector3D& location, float tolerance) {
-        for (auto& pad : BoostPads) {
-            if (pad.Location.DistanceTo(location) <= tolerance) {
-                return &pad;
-            }
-        }
-        return nullptr;
-    }
-
-    SDK::BoostPadState* SDK::FieldState::FindPadByActorAddress(uintptr_t actorAddress) {
-        for (auto& pad : BoostPads) {
-            if (pad.PickupActorAddress == actorAddress) {
-                return &pad;
-            }
-        }
-        return nullptr;
+        ApplyPickedUp(pickup.IsPickedUp(pm), gameTime);
     }
 
-    void SDK::FieldState::UpdateAllPads(MemoryManager& pm, const std::vector<AVehiclePickup_Boost>& all_boost_pickups) {
+    void SDK::FieldState::UpdateAllPads(MemoryManager& pm, const std::vector<AVehiclePickup_Boost>& all_boost_pickups, float gameTime) {
         // First, update all pads that already have a pickup actor address
         for (auto& pad : BoostPads) {
             if (pad.PickupActorAddress != 0) {
-                pad.UpdateState(pm);
+                pad.UpdateState(pm, gameTime);
             }
         }
         
@@ -927,7 +687,7 @@ namespace SDK {
                 // If the pad doesn't have a pickup actor address yet, assign it
                 if (pad->PickupActorAddress == 0) {
                     pad->PickupActorAddress = pickup.Address;
-                    pad->UpdateState(pm);
+                    pad->UpdateState(pm, gameTime);
                 }
             }
         }
@@ -1,15 +1,23 @@
 #pragma once // Use include guards
 
 #include <cstdint>       // For uintptr_t, int32_t, uint32_t, etc.
+#include <array>         // For TArrayView inline storage
 #include <vector>        // For TArray::GetItems and std::vector return types
+#include <iterator>      // For TArrayView::Iterator
+#include <cstddef>       // For std::ptrdiff_t
 #include <string>        // For FString, GetName etc.
+#include <string_view>   // For FStringCache results
+#include <unordered_map> // For FStringCache
 #include <cmath>         // For FRotator conversion and distance calculations
 #include <chrono>        // For BoostPad timing
 #include <optional>      // To represent potential null returns safely
 #include <algorithm>     // For std::max in BoostPadState
+#include <cstring>       // For std::memcpy in FieldSnapshot
+#include <tuple>         // For FieldSnapshot's first field
 #include <type_traits>   // For SFINAE or concepts if needed later
 
 #include "MemoryManager.h"
+#include "ObjectFields.h"
 
 class GNameTable;
 
@@ -123,6 +131,20 @@ namespace SDK
     }; // Size: 0x10
 
 
+    // Upper bound on the characters read from one FString; longer strings are truncated. Player
+    // and team names are far shorter, and the bound keeps every buffer below on the stack.
+    constexpr int32_t MaxFStringChars = 256;
+    constexpr size_t MaxFStringUtf8Bytes = MaxFStringChars * 3; // A UTF-16 unit is at most 3 UTF-8 bytes
+
+    // Reads the characters of the FString described by 'layout' with one ReadBytes into 'out' and
+    // returns how many there are before the terminator, or -1 if the read failed.
+    int32_t ReadFStringChars(const MemoryManager& pm, const FStringLayout& layout, char16_t (&out)[MaxFStringChars]);
+
+    // UTF-16 to UTF-8, stopping at 'count' units or the first NUL. ASCII runs are converted sixteen
+    // units at a time with SSE2; unpaired surrogates become U+FFFD. Never writes more than
+    // 'outCapacity' bytes or splits a sequence. Returns the bytes written.
+    size_t Utf16ToUtf8(const char16_t* in, size_t count, char* out, size_t outCapacity);
+
     // Helper function to read FString content (defined inline for header use)
     // Updated to use FStringLayout and assumes wchar_t based on previous logic
     inline std::wstring GetFString(const MemoryManager& pm, uintptr_t fstring_address)
@@ -135,25 +157,38 @@ namespace SDK
         FStringLayout strLayout = *strLayoutOpt;
         if (strLayout.ArrayData == 0 || strLayout.ArrayCount <= 0) return L""; // Count should be >0 for null term
 
-        // Prevent reading excessive amounts of memory
-        const int32_t maxReasonableCount = 4096;
-        if (strLayout.ArrayCount > maxReasonableCount || strLayout.ArrayCount < 0) return L"[ReadError:InvalidCount]";
-
-        // Allocate buffer (+1 for safety, though Count should include null)
-        std::vector<wchar_t> buffer(static_cast<size_t>(strLayout.ArrayCount) + 1, L'\0');
-        // Read ArrayCount characters (assuming Count includes null terminator or is length+1)
-        // Read (ArrayCount - 1) if Count is just length? Let's assume Count includes null for now.
-        if (!pm.ReadBytes(strLayout.ArrayData, buffer.data(), (strLayout.ArrayCount) * sizeof(wchar_t)))
-        {
-            return L"[ReadError:StringBytes]";
-        }
-        // Ensure null termination
-        buffer[strLayout.ArrayCount] = L'\0';
-
-        // Construct string up to the first null terminator found
-        return std::wstring(buffer.data());
+        char16_t buffer[MaxFStringChars];
+        const int32_t length = ReadFStringChars(pm, strLayout, buffer);
+        if (length < 0) return L"[ReadError:StringBytes]";
+        return std::wstring(buffer, buffer + length);
     }
 
+    // UTF-8 FString contents keyed by (data pointer, length). A name that hasn't been reassigned
+    // costs only the 16-byte layout read; a new one is read and converted once. Entries are
+    // never invalidated individually, the whole cache is dropped when it fills up.
+    // Not thread safe: give each reading thread its own.
+    class FStringCache
+    {
+    public:
+        static constexpr size_t MaxEntries = 256;
+
+        // Empty on a read error. The view is valid until the next Get() or Clear().
+        std::string_view Get(const MemoryManager& pm, uintptr_t fstring_address);
+        void Clear() { entries_.clear(); }
+        size_t Size() const { return entries_.size(); }
+
+    private:
+        struct Key {
+            uintptr_t Data;
+            int32_t Count;
+            bool operator==(const Key& other) const { return Data == other.Data && Count == other.Count; }
+        };
+        struct KeyHash {
+            size_t operator()(const Key& key) const { return std::hash<uintptr_t>()(key.Data ^ (static_cast<uintptr_t>(key.Count) << 48)); }
+        };
+        std::unordered_map<Key, std::string, KeyHash> entries_;
+    };
+
 
     // Layout for TArray (Based on GameDefines.hpp) - Used by GetTArrayItems helper
     struct alignas(8) TArrayLayout
@@ -163,49 +198,106 @@ namespace SDK
         int32_t ArrayMax = 0;    // 0x0C - Allocated capacity of the array
     }; // Size: 0x10
 
-    // Template helper function to get items from a TArray of POINTERS (defined inline)
-    // Updated to use TArrayLayout
-    template <typename T> // T is the C++ WRAPPER type (e.g., UObject, ACar)
-    inline std::vector<T> GetTArrayItems(const MemoryManager& pm, uintptr_t tarray_address)
+    // View of a TArray of POINTERS. The layout is read once and the element pointers are bulk-read
+    // in chunks straight into inline storage, so the usual handful of balls, cars, PRIs or teams
+    // costs two reads and no allocation. Arrays past InlineCapacity spill into a heap buffer that
+    // is kept across Read() calls, so a view that lives across frames only allocates once.
+    // Null entries are skipped. Elements are the wrapper type T, built from the pointer on access.
+    template <typename T, size_t InlineCapacity = 16> // T is the C++ WRAPPER type (e.g., UObject, ACar)
+    class TArrayView
     {
-        std::vector<T> items;
-        if (!pm.IsAttached() || tarray_address == 0) return items;
+    public:
+        static constexpr int32_t MaxCount = 4096;     // Sanity limit on ArrayCount
+        static constexpr size_t ReadChunkSize = 512;  // Pointers per ReadBytes (4 KB)
 
-        auto layoutOpt = pm.Read<TArrayLayout>(tarray_address);
-        if (!layoutOpt) return items; // Failed to read layout
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = T;
+
+            explicit Iterator(const uintptr_t* current) : current_(current) {}
+            T operator*() const { return T(*current_); }
+            Iterator& operator++() { ++current_; return *this; }
+            Iterator operator++(int) { Iterator previous = *this; ++current_; return previous; }
+            bool operator==(const Iterator& other) const { return current_ == other.current_; }
+            bool operator!=(const Iterator& other) const { return current_ != other.current_; }
+
+        private:
+            const uintptr_t* current_;
+        };
 
-        TArrayLayout layout = *layoutOpt;
-        // Basic sanity checks
-        const int32_t maxReasonableCount = 4096; // Increased sanity check limit
-        if (layout.ArrayData == 0 || layout.ArrayCount <= 0 || layout.ArrayCount > maxReasonableCount) {
-            return items;
-        }
+        TArrayView() = default;
+        TArrayView(const MemoryManager& pm, uintptr_t tarray_address) { Read(pm, tarray_address); }
 
-        items.reserve(static_cast<size_t>(layout.ArrayCount));
-        constexpr size_t pointerSize = sizeof(uintptr_t); // 8 bytes for 64-bit
-
-        // Optimized: Read all pointers at once if count is reasonable
-        if (layout.ArrayCount <= 128) { // Threshold for bulk read
-            std::vector<uintptr_t> addresses(layout.ArrayCount);
-            if (pm.ReadBytes(layout.ArrayData, addresses.data(), layout.ArrayCount * pointerSize)) {
-                for (uintptr_t itemAddress : addresses) {
-                    if (itemAddress != 0) {
-                        // Construct the wrapper object around the address
-                        items.emplace_back(itemAddress); // Assumes T has a constructor taking uintptr_t
-                    }
+        // Re-reads the array at 'tarray_address'. Returns false (and leaves the view empty) if the
+        // layout couldn't be read or fails the sanity checks; a chunk whose read fails is skipped.
+        bool Read(const MemoryManager& pm, uintptr_t tarray_address)
+        {
+            layout_ = TArrayLayout{};
+            count_ = 0;
+            spilled_ = false;
+            if (!pm.IsAttached() || tarray_address == 0) return false;
+
+            auto layoutOpt = pm.Read<TArrayLayout>(tarray_address);
+            if (!layoutOpt) return false; // Failed to read layout
+            layout_ = *layoutOpt;
+            if (layout_.ArrayCount == 0) return true;
+            if (layout_.ArrayData == 0 || layout_.ArrayCount < 0 || layout_.ArrayCount > MaxCount) return false;
+
+            const size_t arrayCount = static_cast<size_t>(layout_.ArrayCount);
+            uintptr_t* out = inline_.data();
+            if (arrayCount > InlineCapacity) {
+                if (spill_.size() < arrayCount) spill_.resize(arrayCount);
+                out = spill_.data();
+                spilled_ = true;
+            }
+
+            size_t kept = 0; // Local, since stores through 'out' could alias count_
+            for (size_t begin = 0; begin < arrayCount; begin += ReadChunkSize) {
+                const size_t chunk = (std::min)(ReadChunkSize, arrayCount - begin);
+                // Read in behind the entries kept so far and compact the nulls out in place.
+                uintptr_t* chunkData = out + kept;
+                if (!pm.ReadBytes(layout_.ArrayData + begin * sizeof(uintptr_t), chunkData, chunk * sizeof(uintptr_t))) continue;
+                for (size_t i = 0; i < chunk; ++i) {
+                    out[kept] = chunkData[i];
+                    kept += chunkData[i] != 0;
                 }
-                return items;
             }
+            count_ = kept;
+            return true;
         }
 
-        // Fallback: Read addresses individually
-        for (int32_t i = 0; i < layout.ArrayCount; ++i)
-        {
-            auto itemAddressOpt = pm.Read<uintptr_t>(layout.ArrayData + i * pointerSize);
-            if (itemAddressOpt && *itemAddressOpt != 0)
-            {
-                items.emplace_back(*itemAddressOpt); // Construct the wrapper
-            }
+        size_t size() const { return count_; }
+        bool empty() const { return count_ == 0; }
+        T operator[](size_t index) const { return T(Data()[index]); }
+        Iterator begin() const { return Iterator(Data()); }
+        Iterator end() const { return Iterator(Data() + count_); }
+
+        const uintptr_t* Data() const { return spilled_ ? spill_.data() : inline_.data(); }
+        const TArrayLayout& Layout() const { return layout_; } // As read, including ArrayCount before nulls were skipped
+
+    private:
+        TArrayLayout layout_;
+        size_t count_ = 0;
+        bool spilled_ = false;
+        std::array<uintptr_t, InlineCapacity> inline_{};
+        std::vector<uintptr_t> spill_;
+    };
+
+    // Template helper function to get items from a TArray of POINTERS (defined inline)
+    // Copies a TArrayView into a vector; prefer the view where the result doesn't outlive the frame.
+    template <typename T> // T is the C++ WRAPPER type (e.g., UObject, ACar)
+    inline std::vector<T> GetTArrayItems(const MemoryManager& pm, uintptr_t tarray_address)
+    {
+        TArrayView<T> view(pm, tarray_address);
+        std::vector<T> items;
+        items.reserve(view.size());
+        for (size_t i = 0; i < view.size(); ++i) {
+            items.emplace_back(view.Data()[i]); // Assumes T has a constructor taking uintptr_t
         }
         return items;
     }
@@ -252,7 +344,84 @@ namespace SDK
     class UVehicleSim;
     class UWheel;
     class BoostPadState;
+    class ACameraSettingsActor;
     struct FProfileCameraSettings;
+    struct FPickupData;
+    struct VehicleInputsData;
+    struct FWheelContactData;
+
+    // --- Typed fields (the manifest is ObjectFields.h) ---
+
+    enum class FieldId : uint16_t {
+#define VUTRIUM_FIELD_ID(owner, name, type, offset, property) owner##_##name,
+        VUTRIUM_OBJECT_FIELDS(VUTRIUM_FIELD_ID)
+#undef VUTRIUM_FIELD_ID
+        Count
+    };
+
+    struct FieldInfo {
+        const char* Owner;       // SDK class, "AGameEvent"
+        const char* Name;        // "Cars"
+        const char* Property;    // Name in the game's reflection data
+        uintptr_t DefaultOffset;
+        uint32_t Size;           // Bytes read; a pointer for object-valued fields
+    };
+
+    // Defined after the classes, once every field type is complete.
+    constexpr const FieldInfo& GetFieldInfo(FieldId id);
+
+    // The offsets Field<>::Offset() reads, indexed by FieldId: the manifest defaults until
+    // ResolveFieldOffsets() (FieldOffsetResolver.h) replaces them with what the game's reflection
+    // data says. Written once during SDK init, before any reader thread starts.
+    inline uintptr_t FieldOffsets[static_cast<size_t>(FieldId::Count)] = {
+#define VUTRIUM_FIELD_DEFAULT_OFFSET(owner, name, type, offset, property) offset,
+        VUTRIUM_OBJECT_FIELDS(VUTRIUM_FIELD_DEFAULT_OFFSET)
+#undef VUTRIUM_FIELD_DEFAULT_OFFSET
+    };
+
+    // What a field is stored as in game memory: object wrappers are read as the pointer.
+    template<typename T>
+    struct FieldStorage {
+        using Type = std::conditional_t<std::is_base_of_v<UObject, T>, uintptr_t, T>;
+    };
+
+    // One member of a game object, declared from the manifest inside its owner class as
+    // Owner::Name (AGameEvent::Cars, AVehicle::PRI, ...). Each accessor is one read of exactly
+    // the field. Object-valued fields come back as their wrapper, built from the pointer.
+    // DefaultOffset is the manifest's; Offset() is where the field is in the running game.
+    template<typename Owner, typename T, uintptr_t DefaultOffsetValue, FieldId IdValue>
+    struct Field {
+        using OwnerType = Owner;
+        using ValueType = T;
+        static constexpr uintptr_t DefaultOffset = DefaultOffsetValue;
+        static constexpr FieldId Id = IdValue;
+
+        static uintptr_t Offset() { return FieldOffsets[static_cast<size_t>(Id)]; }
+        static constexpr size_t Size() { return sizeof(typename FieldStorage<T>::Type); }
+
+        // nullopt if 'object' is null or the read failed.
+        static std::optional<T> Read(const MemoryManager& pm, uintptr_t object) {
+            if (object == 0) return std::nullopt;
+            auto stored = pm.Read<typename FieldStorage<T>::Type>(object + Offset());
+            if (!stored) return std::nullopt;
+            return T(*stored);
+        }
+        static T Get(const MemoryManager& pm, uintptr_t object, T fallback = T{}) {
+            auto value = Read(pm, object);
+            return value ? *value : fallback;
+        }
+        // From a copy of the field's bytes.
+        static T FromBytes(const uint8_t* bytes) {
+            typename FieldStorage<T>::Type stored;
+            std::memcpy(&stored, bytes, sizeof(stored));
+            return T(stored);
+        }
+    };
+
+    // Declares the manifest's fields of 'owner' inside its class body.
+#define VUTRIUM_DECLARE_FIELD(owner, name, type, offset, property) \
+    using name = Field<owner, type, offset, FieldId::owner##_##name>;
+#define VUTRIUM_DECLARE_FIELDS(owner) VUTRIUM_FIELDS_##owner(VUTRIUM_DECLARE_FIELD)
 
     class UObject
     {
@@ -286,6 +455,11 @@ namespace SDK
         static constexpr uintptr_t Offset_Class = 0x0050;
         static constexpr uintptr_t Offset_ObjectArchetype = 0x0058;
 
+        // EObjectFlags bits (UE3) used to tell live instances from templates
+        static constexpr uint64_t RF_ClassDefaultObject = 0x0000000000000200ull;
+        static constexpr uint64_t RF_ArchetypeObject = 0x0000000000000400ull;
+        static constexpr uint64_t RF_PendingKill = 0x0000000020000000ull;
+
 
         explicit UObject(uintptr_t address = 0) : Address(address) {}
         bool IsValid() const { return Address != 0; }
@@ -298,6 +472,9 @@ namespace SDK
         UObject GetOuter(const MemoryManager& pm) const;
         uintptr_t GetClassAddress(const MemoryManager& pm) const;
         UClass GetClass(const MemoryManager& pm) const; // Requires UClass definition
+        uint64_t GetObjectFlags(const MemoryManager& pm) const;
+        // Not a class default object, archetype or object already pending kill
+        bool IsLiveInstance(const MemoryManager& pm) const;
         // GetFullName needs update to handle FName struct and new hierarchy traversal
         std::string GetFullName(const MemoryManager& pm, const GNameTable& gnames) const;
         // IsA needs update for new hierarchy traversal (SuperField)
@@ -372,6 +549,31 @@ namespace SDK
         UField GetChildren(const MemoryManager& pm) const;
     };
 
+    class UProperty : public UField
+    {
+    public:
+        // Inherits UObject and UField members... UField ends at 0x70 (Next + padding, like UStruct above)
+        int32_t ArrayDim;                              // 0x0070
+        int32_t ElementSize;                           // 0x0074 (Size of one element; 4 for a bool's bitfield dword)
+        uint64_t PropertyFlags;                        // 0x0078
+        // uint8_t Unknown_0080[0x18];
+        int32_t Offset;                                // 0x0098 (Offset of the member in its owner's instances)
+
+        static constexpr uintptr_t Offset_ArrayDim = 0x0070;
+        static constexpr uintptr_t Offset_ElementSize = 0x0074;
+        static constexpr uintptr_t Offset_PropertyFlags = 0x0078;
+        static constexpr uintptr_t Offset_Offset = 0x0098; // **(NEEDS VERIFICATION)** - ResolveFieldOffsets() rejects what doesn't fit
+
+        explicit UProperty(uintptr_t address = 0) : UField(address) {}
+
+        int32_t GetElementSize(const MemoryManager& pm) const {
+            return pm.Read<int32_t>(Address + Offset_ElementSize).value_or(0);
+        }
+        int32_t GetOffset(const MemoryManager& pm) const {
+            return pm.Read<int32_t>(Address + Offset_Offset).value_or(-1);
+        }
+    };
+
     class UFunction : public UStruct
     {
     public:
@@ -411,43 +613,16 @@ namespace SDK
     class AGameEvent : public UObject // Typically inherits AInfo -> AActor -> UObject
     {
     public:
-        // --- Offsets --- (Updated as per Python)
-        static constexpr uintptr_t Offset_Goals = 0x00D8; // TArray<AGoal*>
-        static constexpr uintptr_t Offset_CountDownTime = 0x02A0; // int32_t
-        static constexpr uintptr_t Offset_Players = 0x0330; // TArray<AController*>
-        static constexpr uintptr_t Offset_PRIs = 0x0340; // TArray<APRI*>
-        static constexpr uintptr_t Offset_Cars = 0x0350; // TArray<ACar*>
-        static constexpr uintptr_t Offset_LocalPlayers = 0x0360; // TArray<APlayerController*>
-        static constexpr uintptr_t Offset_GameOwner = 0x0430; // APRI*
-        static constexpr uintptr_t Offset_Flags = 0x07F0; // uint32_t (bitfield)
-        static constexpr uintptr_t Offset_GameTime = 0x0814; // int32_t (Seconds?)
-        static constexpr uintptr_t Offset_WarmupTime = 0x0818; // int32_t (Seconds?)
-        static constexpr uintptr_t Offset_MaxScore = 0x081C; // int32_t
-        static constexpr uintptr_t Offset_TimeRemaining = 0x084C; // float (Seconds?)
-        static constexpr uintptr_t Offset_SecondsRemaining = 0x0850; // int32_t
-        static constexpr uintptr_t Offset_TotalGameTimePlayed = 0x0858; // float
-        static constexpr uintptr_t Offset_OvertimePlayed = 0x085C; // float
-        static constexpr uintptr_t Offset_Balls = 0x08C8; // TArray<ABall*>
-        static constexpr uintptr_t Offset_Teams = 0x0910; // TArray<ATeam*>
-        static constexpr uintptr_t Offset_MatchWinner = 0x0918; // ATeam*
-        static constexpr uintptr_t Offset_MVP = 0x0928; // APRI*
-        static constexpr uintptr_t Offset_FastestGoalPlayer = 0x0930; // APRI*
-        static constexpr uintptr_t Offset_SlowestGoalPlayer = 0x0938; // APRI*
-        static constexpr uintptr_t Offset_FurthestGoalPlayer = 0x0940; // APRI*
-        static constexpr uintptr_t Offset_FastestGoalSpeed = 0x0948; // float
-        static constexpr uintptr_t Offset_SlowestGoalSpeed = 0x094C; // float
-        static constexpr uintptr_t Offset_FurthestGoal = 0x0950; // float
-        static constexpr uintptr_t Offset_ScoringPlayer = 0x0958; // APRI*
-        static constexpr uintptr_t Offset_RoundNum = 0x0960; // int32_t
+        VUTRIUM_DECLARE_FIELDS(AGameEvent)
 
         explicit AGameEvent(uintptr_t address = 0) : UObject(address) {}
 
         // --- Accessor Methods (Definitions in Objects.cpp) ---
-        std::vector<ABall> GetBalls(const MemoryManager& pm) const;
-        std::vector<ACar> GetCars(const MemoryManager& pm) const;
-        std::vector<APRI> GetPRIs(const MemoryManager& pm) const;
-        std::vector<ATeam> GetTeams(const MemoryManager& pm) const;
-        std::vector<AController> GetPlayers(const MemoryManager& pm) const;
+        TArrayView<ABall> GetBalls(const MemoryManager& pm) const;
+        TArrayView<ACar> GetCars(const MemoryManager& pm) const;
+        TArrayView<APRI> GetPRIs(const MemoryManager& pm) const;
+        TArrayView<ATeam> GetTeams(const MemoryManager& pm) const;
+        TArrayView<AController> GetPlayers(const MemoryManager& pm) const;
         int32_t GetGameTime(const MemoryManager& pm) const;
         int32_t GetWarmupTime(const MemoryManager& pm) const;
         int32_t GetMaxScore(const MemoryManager& pm) const;
@@ -485,8 +660,8 @@ namespace SDK
         APRI GetGameOwner(const MemoryManager& pm) const;
         int32_t GetCountDownTime(const MemoryManager& pm) const;
 
-        std::vector<AGoal> GetGoals(const MemoryManager& pm) const;
-        std::vector<APlayerController> GetLocalPlayers(const MemoryManager& pm) const;
+        TArrayView<AGoal> GetGoals(const MemoryManager& pm) const;
+        TArrayView<APlayerController> GetLocalPlayers(const MemoryManager& pm) const;
     };
 
 
@@ -494,11 +669,7 @@ namespace SDK
     class AActor : public UObject
     {
     public:
-        static constexpr uintptr_t Offset_Location = 0x0090; // FVector (RootComponent?)
-        static constexpr uintptr_t Offset_Rotation = 0x009C; // FRotator (RootComponent?)
-        // Offsets below usually within ReplicatedMovement struct/component:
-        static constexpr uintptr_t Offset_Velocity = 0x01A8; // FVector (Example offset for Velocity in ReplicatedMovement)
-        static constexpr uintptr_t Offset_AngularVelocity = 0x01C0; // FVector (Example offset for AngularVelocity)
+        VUTRIUM_DECLARE_FIELDS(AActor)
         // Size: 0x0268 (minimum)
 
         explicit AActor(uintptr_t address = 0) : UObject(address) {}
@@ -525,18 +696,13 @@ namespace SDK
     class APlayerReplicationInfo : public UObject // Typically inherits AInfo -> AActor
     {
     public:
-        static constexpr uintptr_t Offset_Score = 0x0278;      // int32_t
-        static constexpr uintptr_t Offset_Deaths = 0x027C;     // int32_t
-        static constexpr uintptr_t Offset_Ping = 0x0280;       // uint8_t
-        static constexpr uintptr_t Offset_PlayerName = 0x0288; // FString
-        static constexpr uintptr_t Offset_PlayerID = 0x02A8;    // int32_t (Unique ID)
-        static constexpr uintptr_t Offset_TeamInfo = 0x02B0;    // ATeamInfo*
-        static constexpr uintptr_t Offset_Flags = 0x02B8;      // uint32_t (bitfield: bIsAdmin, bIsSpectator...)
+        VUTRIUM_DECLARE_FIELDS(APlayerReplicationInfo) // Flags: bIsAdmin, bIsSpectator, ... bitfield
         // Size: 0x0410
 
         explicit APlayerReplicationInfo(uintptr_t address = 0) : UObject(address) {}
 
         std::wstring GetPlayerName(const MemoryManager& pm) const;
+        std::string_view GetPlayerName(const MemoryManager& pm, FStringCache& cache) const; // UTF-8
         uintptr_t GetTeamInfoAddress(const MemoryManager& pm) const;
         ATeamInfo GetTeamInfo(const MemoryManager& pm) const;
         int32_t GetScore(const MemoryManager& pm) const;
@@ -557,17 +723,21 @@ namespace SDK
         bool IsUnregistered(const MemoryManager& pm) const;
     };
 
+    // CameraSettingsActor_TA: holds the player's camera profile.
+    class ACameraSettingsActor : public AActor
+    {
+    public:
+        VUTRIUM_DECLARE_FIELDS(ACameraSettingsActor)
+
+        explicit ACameraSettingsActor(uintptr_t address = 0) : AActor(address) {}
+
+        std::optional<FProfileCameraSettings> GetProfileSettings(const MemoryManager& pm) const;
+    };
+
     class APRI : public APlayerReplicationInfo
     {
     public:
-        static constexpr uintptr_t Offset_GameEvent = 0x0480; // AGameEvent* (Server version)
-        static constexpr uintptr_t Offset_ReplicatedGameEvent = 0x0488; // AGameEvent* (Client replicated version)
-        static constexpr uintptr_t Offset_Car = 0x0490;      // ACar* (Possessed/Associated Car)
-        static constexpr uintptr_t Offset_CameraSettings = 0x0608; // ACameraSettingsActor_TA* (Camera pointer)
-        static constexpr uintptr_t Offset_CameraSettingsFProfileCameraSettings = 0x0278; // FProfileCameraSettings offset inside ACameraSettingsActor_TA
-        static constexpr uintptr_t Offset_BoostPickups = 0x0708; // int32_t
-        static constexpr uintptr_t Offset_BallTouches = 0x070C; // int32_t
-        static constexpr uintptr_t Offset_CarTouches = 0x0710; // int32_t
+        VUTRIUM_DECLARE_FIELDS(APRI) // GameEvent is the server's, ReplicatedGameEvent the client's
         // Size: 0x0BD0
 
         explicit APRI(uintptr_t address = 0) : APlayerReplicationInfo(address) {}
@@ -587,8 +757,8 @@ namespace SDK
     class APawn : public AActor
     {
     public:
-        // Points to the PRI associated with this Pawn's controller
-        static constexpr uintptr_t Offset_PlayerReplicationInfo = 0x0410; // APlayerReplicationInfo*
+        // PlayerReplicationInfo is the PRI of this Pawn's controller
+        VUTRIUM_DECLARE_FIELDS(APawn)
         // Size: 0x0514
 
         explicit APawn(uintptr_t address = 0) : AActor(address) {}
@@ -602,10 +772,7 @@ namespace SDK
     class UBoostComponent : public UObject // Actually ActorComponent -> UObject
     {
     public:
-        static constexpr uintptr_t Offset_ConsumptionRate = 0x0300; // float
-        static constexpr uintptr_t Offset_MaxAmount = 0x0304; // float
-        static constexpr uintptr_t Offset_StartAmount = 0x0308; // float
-        static constexpr uintptr_t Offset_CurrentAmount = 0x0330; // float (ReplicatedBoostAmount)
+        VUTRIUM_DECLARE_FIELDS(UBoostComponent) // CurrentAmount is 0..1
         // Size: 0x0368
 
         explicit UBoostComponent(uintptr_t address = 0) : UObject(address) {}
@@ -654,8 +821,7 @@ namespace SDK
     class UWheel : public UObject
     {
     public:
-        static constexpr uintptr_t Offset_WheelIndex = 0x0158; // int32_t
-        static constexpr uintptr_t Offset_ContactData = 0x0160; // FWheelContactData
+        VUTRIUM_DECLARE_FIELDS(UWheel)
         // Size: 0x01E0
 
         explicit UWheel(uintptr_t address = 0) : UObject(address) {}
@@ -669,9 +835,7 @@ namespace SDK
     class UVehicleSim : public UObject
     {
     public:
-        static constexpr uintptr_t Offset_Wheels = 0x00A0;  // TArray<UWheel*>
-        static constexpr uintptr_t Offset_Vehicle = 0x0130; // AVehicle* (Owner Vehicle)
-        static constexpr uintptr_t Offset_Car = 0x0138;     // ACar* (Owner Car, convenience pointer?)
+        VUTRIUM_DECLARE_FIELDS(UVehicleSim) // Wheels: TArray<UWheel*>; Vehicle/Car: the owner
         // Size: 0x0164
 
         explicit UVehicleSim(uintptr_t address = 0) : UObject(address) {}
@@ -689,13 +853,8 @@ namespace SDK
     class AVehicle : public APawn
     {
     public:
-        // Inside ST_ReplicatedVehicleData or similar struct:
-        static constexpr uintptr_t Offset_VehicleSim = 0x07B0;    // UVehicleSim*
-        static constexpr uintptr_t Offset_Flags = 0x07C8;        // uint32_t (bitfield: bDriving, bJumped, bDoubleJumped, bOnGround, bSupersonic...)
-        static constexpr uintptr_t Offset_ReplicatedInputs = 0x09A8; // VehicleInputs (ST_ReplicatedVehicleData -> ReplicatedInputs)
-        // Direct members of AVehicle:
-        static constexpr uintptr_t Offset_PRI = 0x0410;         // APRI* (ReplicatedPRI)
-        static constexpr uintptr_t Offset_BoostComponent = 0x0840; // UBoostComponent*
+        // Flags: bDriving, bJumped, bDoubleJumped, bOnGround, bSupersonic... bitfield
+        VUTRIUM_DECLARE_FIELDS(AVehicle)
         // Size: 0x08A8
 
         explicit AVehicle(uintptr_t address = 0) : APawn(address) {}
@@ -724,7 +883,7 @@ namespace SDK
     class ACar : public AVehicle
     {
     public:
-        static constexpr uintptr_t Offset_AttackerPRI = 0x09E0; // APRI* (Last car touch/demolition related)
+        VUTRIUM_DECLARE_FIELDS(ACar) // AttackerPRI: last car touch/demolition related
         // Size: 0x0B48
 
         explicit ACar(uintptr_t address = 0) : AVehicle(address) {}
@@ -736,16 +895,13 @@ namespace SDK
     class ATeamInfo : public UObject // Typically inherits AReplicationInfo -> AInfo -> AActor
     {
     public:
-        static constexpr uintptr_t Offset_TeamName = 0x0268; // FString
-        // static constexpr uintptr_t Offset_Size = 0x0278; // Usually not directly on TeamInfo, use Members count
-        static constexpr uintptr_t Offset_Score = 0x027C;    // int32_t
-        static constexpr uintptr_t Offset_TeamIndex = 0x0280;// int32_t (0 or 1)
-        static constexpr uintptr_t Offset_TeamColor = 0x0284;// FColorData
+        VUTRIUM_DECLARE_FIELDS(ATeamInfo) // TeamIndex is 0 or 1
         // Size: 0x0290
 
         explicit ATeamInfo(uintptr_t address = 0) : UObject(address) {}
 
         std::wstring GetName(const MemoryManager& pm) const;
+        std::string_view GetName(const MemoryManager& pm, FStringCache& cache) const; // UTF-8
         int32_t GetSize(const MemoryManager& pm) const; // Might need dynamic_cast to ATeam and read Members
         int32_t GetScore(const MemoryManager& pm) const;
         int32_t GetIndex(const MemoryManager& pm) const;
@@ -755,12 +911,12 @@ namespace SDK
     class ATeam : public ATeamInfo
     {
     public:
-        static constexpr uintptr_t Offset_Members = 0x0318; // TArray<APRI*>
+        VUTRIUM_DECLARE_FIELDS(ATeam) // Members: TArray<APRI*>
         // Size: 0x0468
 
         explicit ATeam(uintptr_t address = 0) : ATeamInfo(address) {}
 
-        std::vector<APRI> GetMembers(const MemoryManager& pm) const;
+        TArrayView<APRI> GetMembers(const MemoryManager& pm) const;
     };
 
     class AController : public AActor
@@ -780,16 +936,14 @@ namespace SDK
     class APlayerController : public AController
     {
     public:
-        static constexpr uintptr_t Offset_AcknowledgedPawn = 0x0998;
-        static constexpr uintptr_t Offset_PlayerReplicationInfo = 0x09A0; // Updated from 0x0988 to 0x09A0
-        static constexpr uintptr_t Offset_PlayerCamera = 0x0480; // CORRECT Offset to ACamera*
+        VUTRIUM_DECLARE_FIELDS(APlayerController)
         // Size: 0x0D00
 
         explicit APlayerController(uintptr_t address = 0) : AController(address) {}
 
         APawn* GetAcknowledgedPawn(const MemoryManager& mem) const
         {
-            return mem.Read<APawn*>(this->Address + Offset_AcknowledgedPawn).value_or(nullptr);
+            return mem.Read<APawn*>(this->Address + AcknowledgedPawn::Offset()).value_or(nullptr);
         }
 
         uintptr_t GetPRIActorAddress(const MemoryManager& pm) const;
@@ -813,8 +967,7 @@ namespace SDK
     class AVehiclePickup : public AActor
     {
     public:
-        static constexpr uintptr_t Offset_RespawnDelay = 0x0268; // float
-        static constexpr uintptr_t Offset_PickupData = 0x02A8;   // FPickupData
+        VUTRIUM_DECLARE_FIELDS(AVehiclePickup)
 
         explicit AVehiclePickup(uintptr_t address = 0) : AActor(address) {}
 
@@ -828,8 +981,7 @@ namespace SDK
     class AVehiclePickup_Boost : public AVehiclePickup
     {
     public:
-        static constexpr uintptr_t Offset_BoostAmount = 0x02F0; // float
-        static constexpr uintptr_t Offset_BoostType = 0x0300;   // uint8_t (enum?) - May not exist, amount might define type
+        VUTRIUM_DECLARE_FIELDS(AVehiclePickup_Boost) // BoostType may not exist; the amount tells the pads apart
 
         explicit AVehiclePickup_Boost(uintptr_t address = 0) : AVehiclePickup(address) {}
 
@@ -841,13 +993,7 @@ namespace SDK
     class AGoal : public UObject // Typically inherits ATrigger -> AActor
     {
     public:
-        static constexpr uintptr_t Offset_TeamNum = 0x00DC;   // uint8_t
-        static constexpr uintptr_t Offset_Location = 0x0138; // FVector (World Loc of goal center?)
-        static constexpr uintptr_t Offset_Direction = 0x0144;// FVector (Goal Direction vector)
-        static constexpr uintptr_t Offset_Right = 0x0150;    // FVector (Goal Right vector)
-        static constexpr uintptr_t Offset_Up = 0x015C;       // FVector (Goal Up vector)
-        static constexpr uintptr_t Offset_Rotation = 0x0168; // FRotator (World Rot)
-        static constexpr uintptr_t Offset_WorldBox = 0x01A4; // FBoxData (Bounding box)
+        VUTRIUM_DECLARE_FIELDS(AGoal) // Location is the goal center; Direction/Right/Up its axes
         // Size: 0x01C0
 
         explicit AGoal(uintptr_t address = 0) : UObject(address) {}
@@ -868,8 +1014,8 @@ namespace SDK
     class UGameViewportClient : public UObject // Inherits from UObject directly or via intermediate classes
     {
     public:
-        // Pointer to the current GameEvent (may differ from server version)
-        static constexpr uintptr_t Offset_GameEvent = 0x02E8; // AGameEvent* (Verify this offset)
+        // GameEvent: the current one (may differ from server version)
+        VUTRIUM_DECLARE_FIELDS(UGameViewportClient)
         // Size: 0x03C0
 
         explicit UGameViewportClient(uintptr_t address = 0) : UObject(address) {}
@@ -903,8 +1049,8 @@ namespace SDK
         bool IsActive = true; // Current state (available or cooling down)
         // Store the address of the corresponding AVehiclePickup_Boost for updates
         uintptr_t PickupActorAddress = 0;
-        // Use chrono for time tracking
-        std::chrono::steady_clock::time_point PickedUpTime;
+        // Game time (seconds, see FieldState::GameTime) the pad was picked up at, < 0 when not timed
+        float PickedUpGameTime = -1.0f;
 
         BoostPadState(float x, float y, float z, bool isBig)
             : Location(x, y, z), IsBigPad(isBig) {
@@ -913,10 +1059,11 @@ namespace SDK
         // --- Methods (Definitions in Objects.cpp) ---
         void Reset(); // Resets IsActive, clears timer
         float RespawnTimeSeconds() const; // Returns 4.0f or 10.0f
-        std::optional<float> GetElapsedSeconds() const; // Time since picked up
-        std::optional<float> GetRemainingSeconds() const; // Time until respawn
-        void MarkInactive(); // Sets IsActive false, starts timer
-        void UpdateState(MemoryManager& pm); // Reads actor state and updates IsActive/timer
+        std::optional<float> GetElapsedSeconds(float gameTime) const; // Time since picked up
+        std::optional<float> GetRemainingSeconds(float gameTime) const; // Time until respawn
+        void MarkInactive(float gameTime); // Sets IsActive false, starts timer
+        void ApplyPickedUp(bool isPickedUp, float gameTime); // Applies a polled pickup flag, timing transitions
+        void UpdateState(MemoryManager& pm, float gameTime); // Reads actor state and updates IsActive/timer
     };
 
 
@@ -924,6 +1071,8 @@ namespace SDK
     class FieldState {
     public:
         std::vector<BoostPadState> BoostPads;
+        // Game clock the pad timers are measured against (AGameEvent time played, incl. overtime)
+        float GameTime = 0.0f;
 
         // Static boost pad locations (as in Python)
         static constexpr struct BoostLoc { float x, y, z; bool big; } BOOST_LOCATIONS[] = {
@@ -953,11 +1102,19 @@ namespace SDK
         // Finds a pad state object based on its known static location
         BoostPadState* FindPadByLocation(const Vector3D& location, float tolerance = 100.0f);
 
+        // Index into BoostPads/BOOST_LOCATIONS of the pad nearest to 'location', or -1 if none is within tolerance
+        int FindNearestPadIndex(const Vector3D& location, float tolerance = 100.0f) const;
+
         // Finds a pad state object based on the memory address of its pickup actor
         BoostPadState* FindPadByActorAddress(uintptr_t actorAddress);
 
+        // Bit i set when BoostPads[i] is available (recordings store pad state this way)
+        uint64_t GetActiveMask() const;
+        // Applies a snapshot produced by GetActiveMask, timing any transitions at 'gameTime'
+        void ApplyActiveMask(uint64_t activeMask, float gameTime);
+
         // Updates all boost pad states by reading memory, requires a list of relevant pickup actors
-        void UpdateAllPads(MemoryManager& pm, const std::vector<AVehiclePickup_Boost>& all_boost_pickups);
+        void UpdateAllPads(MemoryManager& pm, const std::vector<AVehiclePickup_Boost>& all_boost_pickups, float gameTime);
     };
 
     class ACamera : public AActor // Inherits Location/Rotation offsets
@@ -971,4 +1128,127 @@ namespace SDK
         // bool CalcCamera(const MemoryManager& pm, float DeltaTime, FVectorData& outLoc, FRotatorData& outRot, float& outFOV);
     };
 
+    // --- Field manifest and batched field reads ---
+
+    inline constexpr FieldInfo FieldManifest[static_cast<size_t>(FieldId::Count)] = {
+#define VUTRIUM_FIELD_INFO(owner, name, type, offset, property) \
+        { #owner, #name, property, offset, static_cast<uint32_t>(owner::name::Size()) },
+        VUTRIUM_OBJECT_FIELDS(VUTRIUM_FIELD_INFO)
+#undef VUTRIUM_FIELD_INFO
+    };
+
+    constexpr const FieldInfo& GetFieldInfo(FieldId id) {
+        return FieldManifest[static_cast<size_t>(id)];
+    }
+
+    // Several fields of one object fetched with a single read of the span they cover, e.g. an
+    // actor's location, rotation and both velocities (0x13C bytes) instead of four reads. Many
+    // objects' snapshots go out in one ReadScatter through ReadFieldSnapshots(). The fields must
+    // belong to the object's class or its bases and lie within MaxSpan of each other.
+    // The span is laid out by the default offsets. If the resolved offsets moved the fields
+    // relative to each other, each field is read on its own (MaxReads reads) into its slot.
+    template<typename... Fs>
+    class FieldSnapshot
+    {
+    public:
+        static constexpr uintptr_t MaxSpan = 0x1000;
+        static constexpr uintptr_t Begin = (std::min)({ Fs::DefaultOffset... });
+        static constexpr uintptr_t End = (std::max)({ static_cast<uintptr_t>(Fs::DefaultOffset + Fs::Size())... });
+        static constexpr size_t MaxReads = sizeof...(Fs);
+        static_assert(sizeof...(Fs) > 0 && End - Begin <= MaxSpan, "FieldSnapshot fields must lie within MaxSpan");
+
+        // True while every field is where the defaults put it, or all moved by the same amount.
+        static bool IsContiguous() {
+            const uintptr_t shift = Shift();
+            return ((Fs::Offset() - Fs::DefaultOffset == shift) && ...);
+        }
+
+        bool Read(const MemoryManager& pm, uintptr_t object) {
+            valid_ = false;
+            if (object == 0) return false;
+            if (IsContiguous()) {
+                valid_ = pm.ReadBytes(object + Begin + Shift(), bytes_.data(), bytes_.size());
+                return valid_;
+            }
+            MemoryManager::ScatterRead reads[MaxReads];
+            const size_t count = Request(object, reads);
+            pm.ReadScatter(reads, count);
+            Complete(reads, count);
+            return valid_;
+        }
+
+        // For batching: fills 'reads' (room for MaxReads) with what fills this snapshot and
+        // returns how many; pass them to Complete() once they've been issued.
+        size_t Request(uintptr_t object, MemoryManager::ScatterRead* reads) {
+            valid_ = false;
+            if (IsContiguous()) {
+                reads[0] = { object + Begin + Shift(), bytes_.data(), bytes_.size(), false };
+                return 1;
+            }
+            size_t count = 0;
+            ((reads[count++] = { object + Fs::Offset(), bytes_.data() + (Fs::DefaultOffset - Begin), Fs::Size(), false }), ...);
+            return count;
+        }
+        void Complete(const MemoryManager::ScatterRead* reads, size_t count) {
+            valid_ = count > 0;
+            for (size_t i = 0; i < count; ++i) valid_ = valid_ && reads[i].Success;
+        }
+        void Reset() { valid_ = false; }
+
+        bool IsValid() const { return valid_; }
+
+        template<typename F>
+        typename F::ValueType Get() const {
+            static_assert((std::is_same_v<F, Fs> || ...), "Field is not part of this snapshot");
+            return F::FromBytes(bytes_.data() + (F::DefaultOffset - Begin));
+        }
+
+        // Calls visit(const FieldInfo&, value) for every field, in the order they were listed.
+        // The manifest supplies names, properties and sizes, so a snapshot can be written out or
+        // compared without code per field.
+        template<typename Visitor>
+        void ForEach(Visitor&& visit) const {
+            (visit(GetFieldInfo(Fs::Id), Get<Fs>()), ...);
+        }
+
+    private:
+        // How far the first field moved from its default; the others match it when contiguous.
+        static uintptr_t Shift() {
+            using First = std::tuple_element_t<0, std::tuple<Fs...>>;
+            return First::Offset() - First::DefaultOffset;
+        }
+
+        std::array<uint8_t, End - Begin> bytes_{};
+        bool valid_ = false;
+    };
+
+    // Fills snapshots[i] from objects[i] with one ReadScatter; null objects are left invalid.
+    // 'reads' is staging that can be reused across calls. Returns how many were read.
+    template<typename Snapshot>
+    size_t ReadFieldSnapshots(const MemoryManager& pm, const uintptr_t* objects, Snapshot* snapshots, size_t count,
+                              std::vector<MemoryManager::ScatterRead>& reads)
+    {
+        reads.resize(count * Snapshot::MaxReads);
+        size_t issued = 0;
+        for (size_t i = 0; i < count; ++i) {
+            snapshots[i].Reset();
+            if (objects[i] != 0) issued += snapshots[i].Request(objects[i], reads.data() + issued);
+        }
+        pm.ReadScatter(reads.data(), issued);
+
+        const size_t perObject = Snapshot::IsContiguous() ? 1 : Snapshot::MaxReads;
+        size_t next = 0;
+        size_t succeeded = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (objects[i] == 0) continue;
+            snapshots[i].Complete(reads.data() + next, perObject);
+            next += perObject;
+            succeeded += snapshots[i].IsValid();
+        }
+        return succeeded;
+    }
+
+    // What the FrameWorker reads of every ball and car each frame.
+    using ActorMotionSnapshot = FieldSnapshot<AActor::Location, AActor::Rotation, AActor::Velocity, AActor::AngularVelocity>;
+
 }
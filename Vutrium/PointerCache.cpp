@@ -0,0 +1,83 @@
+#include "PointerCache.h"
+#include "Objects.hpp"
+
+namespace SDK {
+
+    void PointerCache::BeginFrame(const MemoryManager& pm, uintptr_t gameEvent) {
+        ++frame_;
+        if (gameEvent != gameEvent_) {
+            // New match (or none): every actor the links point from is about to be replaced.
+            Clear();
+            gameEvent_ = gameEvent;
+            ++generation_;
+            return;
+        }
+        if (frame_ - lastRevalidateFrame_ >= RevalidateFrames) {
+            Revalidate(pm);
+        }
+    }
+
+    void PointerCache::Revalidate(const MemoryManager& pm) {
+        lastRevalidateFrame_ = frame_;
+
+        checkKeys_.clear();
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            if (frame_ - it->second.UsedFrame >= EvictFrames) {
+                it = entries_.erase(it); // The owner left the match (or stopped being asked about)
+                continue;
+            }
+            checkKeys_.push_back(it->first);
+            ++it;
+        }
+        if (checkKeys_.empty()) return;
+
+        // Both reads of every entry go out in one batch; the slots of one owner usually coalesce.
+        checks_.assign(checkKeys_.size(), Check{});
+        checkReads_.resize(checkKeys_.size() * 2);
+        for (size_t i = 0; i < checkKeys_.size(); ++i) {
+            const Entry& entry = entries_.find(checkKeys_[i])->second;
+            checkReads_[i * 2] = { checkKeys_[i].Owner + checkKeys_[i].Offset, &checks_[i].Link, sizeof(uintptr_t), false };
+            checkReads_[i * 2 + 1] = { entry.Target + UObject::Offset_Class, &checks_[i].Class, sizeof(uintptr_t), false };
+        }
+        pm.ReadScatter(checkReads_.data(), checkReads_.size());
+
+        for (size_t i = 0; i < checkKeys_.size(); ++i) {
+            auto it = entries_.find(checkKeys_[i]);
+            const bool read = checkReads_[i * 2].Success && checkReads_[i * 2 + 1].Success;
+            if (!read || checks_[i].Link != it->second.Target || checks_[i].Class != it->second.TargetClass) {
+                entries_.erase(it);
+                ++stats_.Invalidated;
+            }
+        }
+    }
+
+    uintptr_t PointerCache::Resolve(const MemoryManager& pm, uintptr_t owner, uintptr_t offset) {
+        if (owner == 0) return 0;
+
+        const Key key{ owner, offset };
+        auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            it->second.UsedFrame = frame_;
+            ++stats_.Hits;
+            return it->second.Target;
+        }
+
+        ++stats_.Misses;
+        const uintptr_t target = pm.Read<uintptr_t>(owner + offset).value_or(0);
+        if (target == 0) return 0;
+        const auto targetClass = pm.Read<uintptr_t>(target + UObject::Offset_Class);
+        if (!targetClass || *targetClass == 0) return target; // Not an object we can validate later; don't cache
+
+        if (entries_.size() >= MaxEntries) {
+            entries_.clear();
+        }
+        entries_.emplace(key, Entry{ target, *targetClass, frame_ });
+        return target;
+    }
+
+    void PointerCache::Clear() {
+        entries_.clear();
+        lastRevalidateFrame_ = frame_;
+    }
+
+} // namespace SDK
@@ -0,0 +1,87 @@
+#ifndef POINTER_CACHE_H
+#define POINTER_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include "MemoryManager.h"
+
+namespace SDK {
+
+    // Remembers the object pointers stored in other objects (car -> PRI, PRI -> TeamInfo,
+    // car -> BoostComponent, ...) so a frame only reads the leaf values hanging off them. Those
+    // links are set when an actor spawns or replicates and then hold for the rest of the match.
+    // Entries are dropped wholesale when the GameEvent changes (a new generation), and every
+    // RevalidateFrames the cached links and their targets' Class pointers are re-read in one
+    // scatter read; a link whose slot now holds something else, or whose target's Class changed
+    // (freed and reused), is dropped and re-read on the next Resolve. Null links are never cached,
+    // so a PRI that replicates after its car is picked up as soon as it arrives.
+    // One thread at a time; the FrameWorker owns one.
+    class PointerCache {
+    public:
+        static constexpr uint32_t RevalidateFrames = 30;  // ~4 Hz at the FrameWorker's 120 Hz
+        static constexpr uint32_t EvictFrames = 240;      // Links nobody asked for in ~2 s
+        static constexpr size_t MaxEntries = 1024;        // Cleared when full, like FStringCache
+
+        struct Stats {
+            uint64_t Hits = 0;
+            uint64_t Misses = 0;
+            uint64_t Invalidated = 0; // Dropped by revalidation because the link or its target changed
+        };
+
+        // Call once per frame before resolving anything. 'gameEvent' is the current GameEvent
+        // address (0 outside a match); a different one starts a new generation.
+        void BeginFrame(const MemoryManager& pm, uintptr_t gameEvent);
+
+        // The pointer stored at owner + offset, or 0 if it's null or unreadable.
+        uintptr_t Resolve(const MemoryManager& pm, uintptr_t owner, uintptr_t offset);
+        // The same for an object-valued manifest field (AVehicle::PRI, APRI::TeamInfo, ...).
+        template<typename F>
+        typename F::ValueType Resolve(const MemoryManager& pm, uintptr_t owner) {
+            return typename F::ValueType(Resolve(pm, owner, F::Offset()));
+        }
+
+        void Clear();
+        uint32_t GetGeneration() const { return generation_; }
+        size_t GetEntryCount() const { return entries_.size(); }
+        const Stats& GetStats() const { return stats_; }
+
+    private:
+        struct Key {
+            uintptr_t Owner = 0;
+            uintptr_t Offset = 0;
+            bool operator==(const Key& other) const { return Owner == other.Owner && Offset == other.Offset; }
+        };
+        struct KeyHash {
+            size_t operator()(const Key& key) const {
+                return std::hash<uintptr_t>()(key.Owner ^ (key.Offset * 0x9E3779B97F4A7C15ull));
+            }
+        };
+        struct Entry {
+            uintptr_t Target = 0;
+            uintptr_t TargetClass = 0;
+            uint32_t UsedFrame = 0;
+        };
+        // Revalidation staging: what the link slot and the target's Class read back as.
+        struct Check {
+            uintptr_t Link = 0;
+            uintptr_t Class = 0;
+        };
+
+        void Revalidate(const MemoryManager& pm);
+
+        std::unordered_map<Key, Entry, KeyHash> entries_;
+        std::vector<Key> checkKeys_;                         // Staging
+        std::vector<Check> checks_;                          // Staging
+        std::vector<MemoryManager::ScatterRead> checkReads_; // Staging
+        uintptr_t gameEvent_ = 0;
+        uint32_t generation_ = 0;
+        uint32_t frame_ = 0;
+        uint32_t lastRevalidateFrame_ = 0;
+        Stats stats_;
+    };
+
+} // namespace SDK
+
+#endif // POINTER_CACHE_H
@@ -0,0 +1,74 @@
+#ifndef PRESENT_TIMER_H
+#define PRESENT_TIMER_H
+
+#include <windows.h>
+#include <cstdint>
+
+// QueryPerformanceCounter-based timing of our work inside the Present hook.
+// Only touched from the render thread.
+class PresentTimer {
+public:
+    static constexpr double BudgetMicroseconds = 500.0;
+    static constexpr int WindowFrames = 240;
+
+    PresentTimer() {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        ticksToMicroseconds_ = 1000000.0 / static_cast<double>(frequency.QuadPart);
+    }
+
+    void Begin() {
+        QueryPerformanceCounter(&start_);
+    }
+
+    double ElapsedMicroseconds() const {
+        LARGE_INTEGER now;
+        QueryPerformanceCounter(&now);
+        return static_cast<double>(now.QuadPart - start_.QuadPart) * ticksToMicroseconds_;
+    }
+
+    bool OverBudget() const { return ElapsedMicroseconds() >= BudgetMicroseconds; }
+
+    void End() {
+        lastMicroseconds_ = ElapsedMicroseconds();
+        averageMicroseconds_ = frames_ == 0 ? lastMicroseconds_ : averageMicroseconds_ * 0.95 + lastMicroseconds_ * 0.05;
+        ++frames_;
+
+        if (lastMicroseconds_ > windowMaxAccum_) windowMaxAccum_ = lastMicroseconds_;
+        if (++windowCount_ >= WindowFrames) {
+            windowMaxMicroseconds_ = windowMaxAccum_;
+            windowMaxAccum_ = 0.0;
+            windowCount_ = 0;
+        }
+
+        if (lastMicroseconds_ > BudgetMicroseconds) {
+            ++overBudgetFrames_;
+        }
+    }
+
+    // Called when a drawing layer is skipped because the budget was already spent.
+    void NoteSkippedLayer() { ++skippedLayers_; }
+
+    double GetLastMicroseconds() const { return lastMicroseconds_; }
+    double GetAverageMicroseconds() const { return averageMicroseconds_; }
+    double GetWindowMaxMicroseconds() const { return windowMaxMicroseconds_ > windowMaxAccum_ ? windowMaxMicroseconds_ : windowMaxAccum_; }
+    uint64_t GetFrames() const { return frames_; }
+    uint64_t GetOverBudgetFrames() const { return overBudgetFrames_; }
+    uint64_t GetSkippedLayers() const { return skippedLayers_; }
+
+private:
+    double ticksToMicroseconds_ = 0.0;
+    LARGE_INTEGER start_ = {};
+
+    double lastMicroseconds_ = 0.0;
+    double averageMicroseconds_ = 0.0;
+    double windowMaxAccum_ = 0.0;
+    double windowMaxMicroseconds_ = 0.0;
+    int windowCount_ = 0;
+
+    uint64_t frames_ = 0;
+    uint64_t overBudgetFrames_ = 0;
+    uint64_t skippedLayers_ = 0;
+};
+
+#endif // PRESENT_TIMER_H
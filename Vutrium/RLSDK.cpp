@@ -1,6 +1,8 @@
 #include "RLSDK.h"
 #include "EventData.h"
+#include "FieldOffsetResolver.h"
 #include "Logger.h"      // Include Logger
+#include "ReadStats.h"
 #include <iostream>
 #include <stdexcept>     // For throwing exceptions
 #include <windows.h>
@@ -11,22 +13,23 @@
 #include <sstream>       // Needed for Logger::to_hex
 
 namespace FunctionName {
-    inline constexpr const char* BoostPickedUp = "Function TAGame.VehiclePickup_Boost_TA.Idle.EndState";
-    inline constexpr const char* BoostRespawn = "Function TAGame.VehiclePickup_Boost_TA.Idle.BeginState";
-    inline constexpr const char* PlayerTick = "Function Engine.PlayerController.PlayerTick";
-    inline constexpr const char* HandleKeyPress = "Function TAGame.GameViewportClient_TA.HandleKeyPress";
-    inline constexpr const char* RoundActiveBegin = "Function TAGame.GameEvent_Soccar_TA.Active.BeginState";
-    inline constexpr const char* RoundActiveEnd = "Function TAGame.GameEvent_Soccar_TA.Active.EndState";
-    inline constexpr const char* ResetPickups = "Function TAGame.GameEvent_TA.ResetPickups";
-    inline constexpr const char* GameEventBeginPlay = "Function TAGame.GameEvent_Soccar_TA.PostBeginPlay";
-    inline constexpr const char* ViewportClientTick = "Function Engine.GameViewportClient.Tick";
-    inline constexpr const char* GameEventDestroyed = "Function TAGame.GameEvent_Soccar_TA.Destroyed";
+    inline constexpr SDK::ObjectPath BoostPickedUp{ "Function TAGame.VehiclePickup_Boost_TA.Idle.EndState" };
+    inline constexpr SDK::ObjectPath BoostRespawn{ "Function TAGame.VehiclePickup_Boost_TA.Idle.BeginState" };
+    inline constexpr SDK::ObjectPath PlayerTick{ "Function Engine.PlayerController.PlayerTick" };
+    inline constexpr SDK::ObjectPath HandleKeyPress{ "Function TAGame.GameViewportClient_TA.HandleKeyPress" };
+    inline constexpr SDK::ObjectPath RoundActiveBegin{ "Function TAGame.GameEvent_Soccar_TA.Active.BeginState" };
+    inline constexpr SDK::ObjectPath RoundActiveEnd{ "Function TAGame.GameEvent_Soccar_TA.Active.EndState" };
+    inline constexpr SDK::ObjectPath ResetPickups{ "Function TAGame.GameEvent_TA.ResetPickups" };
+    inline constexpr SDK::ObjectPath GameEventBeginPlay{ "Function TAGame.GameEvent_Soccar_TA.PostBeginPlay" };
+    inline constexpr SDK::ObjectPath ViewportClientTick{ "Function Engine.GameViewportClient.Tick" };
+    inline constexpr SDK::ObjectPath GameEventDestroyed{ "Function TAGame.GameEvent_Soccar_TA.Destroyed" };
 } // namespace FunctionName
 
 namespace ClassName {
-    inline constexpr const char* CoreObject = "Class Core.Object";
-    inline constexpr const char* GameViewportClient = "Engine.GameViewportClient";
-    // Define a name for the ProcessEvent hook
+    inline constexpr SDK::ObjectPath CoreObject{ "Class Core.Object" };
+    inline constexpr SDK::ObjectPath GameViewportClientClass{ "Class Engine.GameViewportClient" };
+    inline constexpr SDK::ObjectPath GameViewportClientTA{ "Class TAGame.GameViewportClient_TA" };
+    // Name of the ProcessEvent hook in HookManager (not an object path)
     inline constexpr const char* ProcessEvent = "Engine.Object.ProcessEvent";
 } // namespace ClassName
 
@@ -52,12 +55,12 @@ namespace {
         std::vector<uint8_t> buffer;
         try { buffer.resize(size); }
         catch (const std::bad_alloc&) {
-            Logger::Error("RLSDK Scan Error: Failed to allocate buffer of size " + std::to_string(size) + " for pattern " + patternName);
+            VUTRIUM_LOG_ERROR("RLSDK Scan Error: Failed to allocate buffer of size " + std::to_string(size) + " for pattern " + patternName);
             return std::nullopt;
         }
 
         if (!pm.ReadBytes(begin, buffer.data(), size)) {
-            Logger::Error("RLSDK Scan Error: Failed to read memory for pattern " + patternName);
+            VUTRIUM_LOG_ERROR("RLSDK Scan Error: Failed to read memory for pattern " + patternName);
             return std::nullopt;
         }
 
@@ -75,7 +78,7 @@ namespace {
                 return foundAddress;
             }
         }
-        Logger::Warning("RLSDK Scan Warning: Pattern " + patternName + " not found.");
+        VUTRIUM_LOG_WARNING("RLSDK Scan Warning: Pattern " + patternName + " not found.");
         return std::nullopt;
     }
 
@@ -96,7 +99,7 @@ namespace {
             return finalAddr;
         }
         catch (const std::exception& e) {
-            Logger::Error("Scan Calc1 Exception for " + std::string(isGNames ? "GNames" : "GObjects") + ": " + e.what());
+            VUTRIUM_LOG_ERROR("Scan Calc1 Exception for " + std::string(isGNames ? "GNames" : "GObjects") + ": " + e.what());
             return std::nullopt;
         }
         // return std::nullopt; // Unreachable
@@ -113,7 +116,7 @@ namespace {
             return finalAddr;
         }
         catch (const std::exception& e) {
-            Logger::Error("Scan Calc2 Exception: " + std::string(e.what()));
+            VUTRIUM_LOG_ERROR("Scan Calc2 Exception: " + std::string(e.what()));
             return std::nullopt;
         }
     }
@@ -132,13 +135,12 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
     processId_(0),
     gnamesOffset_(0),
     gobjectsOffset_(0),
-    buildType_("unknown"),
-    currentGameEvent_(0) // Initialize with invalid address
+    buildType_("unknown")
 {
-    Logger::Info("RLSDK: Initializing...");
+    VUTRIUM_LOG_INFO("RLSDK: Initializing...");
     try {
         // 1. Attach to Process
-        Logger::Info("RLSDK: Attaching to process: " + std::string(moduleName_.begin(), moduleName_.end()));
+        VUTRIUM_LOG_INFO("RLSDK: Attaching to process: " + std::string(moduleName_.begin(), moduleName_.end()));
         if (!memManager_.Attach(moduleName_)) {
             throw std::runtime_error("Failed to attach to process: " + std::string(moduleName_.begin(), moduleName_.end()));
         }
@@ -152,7 +154,7 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
 
         if (!gotModuleInfo) {
             if (moduleBase_ == 0) throw std::runtime_error("Failed to get module base address for: " + std::string(moduleName_.begin(), moduleName_.end()));
-            Logger::Warning("Failed to get module size information. Using estimated scan size.");
+            VUTRIUM_LOG_WARNING("Failed to get module size information. Using estimated scan size.");
             moduleInfo.SizeOfImage = 150 * 1024 * 1024; // Estimate size (adjust if needed)
         }
         else {
@@ -160,16 +162,14 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
         }
         if (moduleBase_ == 0) throw std::runtime_error("Failed to obtain module base address.");
 
-        Logger::Info("RLSDK: Attached - PID: " + std::to_string(processId_) +
-            ", Base: " + Logger::to_hex(moduleBase_) +
-            ", Scan Size: " + Logger::to_hex(moduleInfo.SizeOfImage));
+        VUTRIUM_LOG(LogFormat::SdkAttached, processId_, Logger::Hex(moduleBase_), Logger::Hex(moduleInfo.SizeOfImage));
 
         // 2. Detect Build Type
         buildType_ = DetectBuildType();
-        Logger::Info("RLSDK: Detected build type: " + buildType_);
+        VUTRIUM_LOG_INFO("RLSDK: Detected build type: " + buildType_);
 
         // 3. Determine Offsets (Always resolve now)
-        Logger::Info("RLSDK: Resolving offsets via pattern scanning...");
+        VUTRIUM_LOG_INFO("RLSDK: Resolving offsets via pattern scanning...");
         if (!ResolveOffsets(moduleInfo.SizeOfImage)) { // Call the overloaded ResolveOffsets
             throw std::runtime_error("Failed to resolve required GNames/GObjects offsets via pattern scanning.");
         }
@@ -178,57 +178,60 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
         }
 
         // 4. Initialize GNameTable
-        Logger::Info("RLSDK: Initializing GNameTable...");
+        VUTRIUM_LOG_INFO("RLSDK: Initializing GNameTable...");
         if (!gnames_.Initialize(memManager_, moduleBase_, gnamesOffset_)) {
             throw std::runtime_error("Failed to initialize GNameTable.");
         }
-        Logger::Info("RLSDK: GNameTable Initialized. Loaded " + std::to_string(gnames_.GetNameCount()) + " names.");
+        VUTRIUM_LOG_INFO("RLSDK: GNameTable Initialized. Loaded " + std::to_string(gnames_.GetNameCount()) + " names.");
 
         // 5. Initialize GObjectsTable
-        Logger::Info("RLSDK: Initializing GObjectsTable...");
+        VUTRIUM_LOG_INFO("RLSDK: Initializing GObjectsTable...");
         if (!gobjects_.Initialize(memManager_, gnames_, moduleBase_, gobjectsOffset_)) {
             throw std::runtime_error("Failed to initialize GObjectsTable.");
         }
-        Logger::Info("RLSDK: GObjectsTable Initialized. Mapped "
+        VUTRIUM_LOG_INFO("RLSDK: GObjectsTable Initialized. Mapped "
             + std::to_string(gobjects_.GetMappedClassCount()) + " classes, "
             + std::to_string(gobjects_.GetMappedFunctionCount()) + " functions.");
 
+        // 5b. Check the SDK's field offsets against the game's reflection data; moved fields are
+        // read from where the game has them from here on. Mismatches are logged.
+        SDK::ResolveFieldOffsets(memManager_, gnames_, gobjects_);
+
         // --- ADDED: Find the main UGameViewportClient instance ---
-        Logger::Info("RLSDK: Searching for main UGameViewportClient instance...");
-        int32_t objectCount = gobjects_.GetObjectCount(memManager_);
+        // The first Refresh() builds the per-class instance lists; later ones (ObjectDiscovery) only diff.
+        VUTRIUM_LOG_INFO("RLSDK: Searching for main UGameViewportClient instance...");
+        ReadScope viewportScanScope(ReadCategory::GObjects);
         bool foundViewport = false;
-        for (int32_t i = 0; i < objectCount; ++i) {
-            SDK::UObject obj = gobjects_.GetObjectByIndex(memManager_, i);
-            if (obj.IsValid()) {
-                std::string objName = obj.GetName(memManager_, gnames_); // Get simple name first
-                if (objName == "GameViewportClient") { // Check simple name
-                     // Optional: Check full name or class name for confirmation
-                     std::string objFullName = obj.GetFullName(memManager_, gnames_);
-                     if (objFullName.find(ClassName::GameViewportClient) != std::string::npos) {
-                          g_GameViewportClientAddress = obj.Address;
-                          Logger::Info("RLSDK: Found main GameViewportClient instance at: " + Logger::to_hex(g_GameViewportClientAddress));
-                          foundViewport = true;
-                          break; // Assume the first one found is the main one
-                     }
+        if (gobjects_.Refresh(memManager_)) {
+            for (const SDK::ObjectPath* className : { &ClassName::GameViewportClientTA, &ClassName::GameViewportClientClass }) {
+                SDK::UClass viewportClass = gobjects_.FindStaticClass(*className);
+                if (!viewportClass.IsValid()) continue;
+                for (const auto& instance : gobjects_.GetInstances(viewportClass.Address)) {
+                    if (!SDK::UObject(instance.Address).IsLiveInstance(memManager_)) continue; // Skip Default__ and archetypes
+                    g_GameViewportClientAddress = instance.Address;
+                    VUTRIUM_LOG(LogFormat::SdkViewportClientFound, Logger::Hex(g_GameViewportClientAddress));
+                    foundViewport = true;
+                    break; // Assume the first one found is the main one
                 }
+                if (foundViewport) break;
             }
         }
         if (!foundViewport) {
-             Logger::Warning("RLSDK: Could not find the main UGameViewportClient instance in GObjects! Tick hook might not work correctly.");
-             // Proceeding anyway, the hook will just filter everything if address is 0
+             VUTRIUM_LOG_WARNING("RLSDK: Could not find the main UGameViewportClient instance in GObjects! Tick hook might not work correctly.");
+             // Proceeding anyway; ObjectDiscovery fills it in if the viewport shows up later
         }
         // --- END Find UGameViewportClient ---
 
         // 6. Initialize HookManager (MinHook)
-        Logger::Info("RLSDK: Initializing HookManager...");
+        VUTRIUM_LOG_INFO("RLSDK: Initializing HookManager...");
         if (!hookMgr_.Initialize()) {
             throw std::runtime_error("Failed to initialize HookManager (MinHook)."); // Specific error logged inside
         }
 
         // 7. Setup Hooks
-        Logger::Info("RLSDK: Setting up hooks...");
+        VUTRIUM_LOG_INFO("RLSDK: Setting up hooks...");
         if (!SetupHooks()) {
-            Logger::Warning("Failed to set up one or more function hooks.");
+            VUTRIUM_LOG_WARNING("Failed to set up one or more function hooks.");
         }
 
         // 8. Subscribe internal handlers AFTER hooks are set
@@ -258,8 +261,7 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
 
             // Only process if the address is actually new OR if we currently have no event
             if (newGEAddress != 0 && newGEAddress != previousGEAddress) {
-                Logger::Info("RLSDK: OnGameEventStarted received. Updating pointer. Prev: " + 
-                           Logger::to_hex(previousGEAddress) + ", New: " + Logger::to_hex(newGEAddress));
+                VUTRIUM_LOG(LogFormat::GameEventStartedReceived, Logger::Hex(previousGEAddress), Logger::Hex(newGEAddress));
                 // If there was a different valid previous event, notify destroyed
                 if (previousGEAddress != 0) {
                     this->NotifyGameEventDestroyed(previousGEAddress);
@@ -278,7 +280,7 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
              const auto* destroyData = dynamic_cast<const EventGameEventDestroyedData*>(&data);
              if (!destroyData) return;
              if (this->currentGameEvent_.Address == destroyData->GameEventAddress) { // Only clear if it matches current
-                Logger::Info("RLSDK: OnGameEventDestroyed received. Clearing pointer for: " + Logger::to_hex(destroyData->GameEventAddress));
+                VUTRIUM_LOG(LogFormat::GameEventDestroyedReceived, Logger::Hex(destroyData->GameEventAddress));
                 this->NotifyGameEventDestroyed(destroyData->GameEventAddress); // Update internal pointer
                 // Note: Public OnGameEventDestroyed was already fired
              }
@@ -289,7 +291,7 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
             // Logger::Info("**** RLSDK OnViewportTick Handler ENTERED ****"); // Can be noisy
             const auto* tickData = dynamic_cast<const EventViewportTickData*>(&data);
             if (!tickData) {
-                 Logger::Warning("RLSDK OnViewportTick Handler: Failed dynamic_cast to EventViewportTickData!");
+                 VUTRIUM_LOG_WARNING("RLSDK OnViewportTick Handler: Failed dynamic_cast to EventViewportTickData!");
                  return; 
             }
 
@@ -298,8 +300,7 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
 
             if (currentGEAddressFromTick != previousGEAddress) {
                  // Log the change for debugging
-                Logger::Info("RLSDK: Detected GameEvent change via Viewport Tick. Prev: " + 
-                           Logger::to_hex(previousGEAddress) + ", CurrFromTick: " + Logger::to_hex(currentGEAddressFromTick));
+                VUTRIUM_LOG(LogFormat::GameEventTickChanged, Logger::Hex(previousGEAddress), Logger::Hex(currentGEAddressFromTick));
 
                 // If previous was valid and current is null -> Destroyed
                 if (previousGEAddress != 0 && currentGEAddressFromTick == 0) { 
@@ -332,11 +333,14 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
         eventMgr_.Subscribe(EventType::OnProbableGameEventFound, [this](const EventData& data) {
             const auto* geFoundData = dynamic_cast<const EventProbableGameEventFoundData*>(&data);
             if (!geFoundData) {
-                Logger::Warning("RLSDK OnProbableGameEventFound Handler: Failed dynamic_cast!");
+                VUTRIUM_LOG_WARNING("RLSDK OnProbableGameEventFound Handler: Failed dynamic_cast!");
                 return;
             }
+            ReadScope readScope(ReadCategory::GameEvent);
+            // Fired from the game thread (hook heuristic) and the ObjectDiscovery thread.
+            std::lock_guard<std::mutex> lock(this->gameEventMutex_);
 
-            uintptr_t previousGEAddress = this->currentGameEvent_.Address;
+            uintptr_t previousGEAddress = this->currentGameEventAddress_.load();
             uintptr_t probableGEAddress = geFoundData->ProbableGameEventAddress;
 
             // --- ADD Verification Step --- 
@@ -348,7 +352,7 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
                     verified = true;
                 }
                 else {
-                     Logger::Info("RLSDK: Heuristic found candidate 0x" + Logger::to_hex(probableGEAddress) + " but IsA(GameEvent_Soccar_TA) failed verification.");
+                     VUTRIUM_LOG_LIMITED(1.0, 5, LogFormat::GameEventCandidateRejected, Logger::Hex(probableGEAddress));
                 }
             }
             else { // If probable address is 0, consider it 'verified' as the end state
@@ -358,15 +362,14 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
 
             // Only update state if the address is different AND verified
             if (verified && probableGEAddress != previousGEAddress) {
-                Logger::Info("RLSDK: Verified GameEvent address changed. Prev: " + 
-                           Logger::to_hex(previousGEAddress) + ", New: " + Logger::to_hex(probableGEAddress));
+                VUTRIUM_LOG(LogFormat::GameEventVerifiedChange, Logger::Hex(previousGEAddress), Logger::Hex(probableGEAddress));
 
                 // If previous was valid, fire destroyed event
                 if (previousGEAddress != 0) {
                     this->NotifyGameEventDestroyed(previousGEAddress); // Update internal pointer first (sets to 0)
                     EventGameEventDestroyedData destroyEvent(previousGEAddress);
                     this->eventMgr_.Fire(EventType::OnGameEventDestroyed, destroyEvent);
-                    Logger::Info("RLSDK: Fired OnGameEventDestroyed for " + Logger::to_hex(previousGEAddress));
+                    VUTRIUM_LOG(LogFormat::GameEventFiredDestroyed, Logger::Hex(previousGEAddress));
                 }
                 
                 // Update internal pointer regardless of whether new address is valid or 0
@@ -376,23 +379,26 @@ RLSDK::RLSDK(const std::wstring& processName, bool hookPlayerTick)
                 if (probableGEAddress != 0) {
                     EventGameEventStartedData startEvent(probableGEAddress);
                     this->eventMgr_.Fire(EventType::OnGameEventStarted, startEvent);
-                    Logger::Info("RLSDK: Fired OnGameEventStarted for " + Logger::to_hex(probableGEAddress));
+                    VUTRIUM_LOG(LogFormat::GameEventFiredStarted, Logger::Hex(probableGEAddress));
                 }
             }
             // else: Probable address is the same as current, or failed verification. Do nothing.
         });
 
         initialized_ = true;
-        Logger::Info("RLSDK: Initialization successful.");
+
+        // 9. Hook-free fallback: find the GameEvent, viewport and pickups by scanning GObjects
+        discovery_.Start(this);
+        VUTRIUM_LOG_INFO("RLSDK: Initialization successful.");
 
     }
     catch (const std::exception& e) {
-        Logger::Error("RLSDK Initialization Error: " + std::string(e.what()));
+        VUTRIUM_LOG_ERROR("RLSDK Initialization Error: " + std::string(e.what()));
         Shutdown(); // Ensure partial cleanup
         throw; // Re-throw
     }
     catch (...) {
-        Logger::Error("RLSDK Initialization Error: An unknown exception occurred.");
+        VUTRIUM_LOG_ERROR("RLSDK Initialization Error: An unknown exception occurred.");
         Shutdown(); // Ensure partial cleanup
         throw std::runtime_error("Unknown error during RLSDK initialization.");
     }
@@ -407,12 +413,13 @@ RLSDK::~RLSDK() {
 void RLSDK::Shutdown() {
     // Ensure graceful shutdown even if called multiple times or before full init
     if (!initialized_ && !memManager_.IsAttached()) return;
-    Logger::Info("RLSDK: Shutting down...");
+    VUTRIUM_LOG_INFO("RLSDK: Shutting down...");
+    discovery_.Stop();        // Joins the scan thread, so never call this from DllMain
     hookMgr_.Shutdown();      // Shutdown hooks first
     memManager_.Detach();     // Detach from process
     initialized_ = false;     // Mark as not initialized
-    currentGameEvent_ = SDK::AGameEvent(0); // Reset game event pointer
-    Logger::Info("RLSDK: Shutdown complete.");
+    currentGameEventAddress_ = 0; // Reset game event pointer
+    VUTRIUM_LOG_INFO("RLSDK: Shutdown complete.");
 }
 
 // --- Initialization Status ---
@@ -431,6 +438,8 @@ EventManager& RLSDK::GetEventManager() { return eventMgr_; }
 const EventManager& RLSDK::GetEventManager() const { return eventMgr_; }
 HookManager& RLSDK::GetHookManager() { return hookMgr_; }
 const HookManager& RLSDK::GetHookManager() const { return hookMgr_; }
+ObjectDiscovery& RLSDK::GetObjectDiscovery() { return discovery_; }
+const ObjectDiscovery& RLSDK::GetObjectDiscovery() const { return discovery_; }
 uintptr_t RLSDK::GetModuleBaseAddress() const { return moduleBase_; }
 DWORD RLSDK::GetProcessID() const { return processId_; }
 const std::wstring& RLSDK::GetModuleName() const { return moduleName_; }
@@ -440,14 +449,14 @@ const std::string& RLSDK::GetBuildType() const { return buildType_; }
 std::string RLSDK::GetName(int32_t index) const {
     return gnames_.GetName(index);
 }
-SDK::UClass RLSDK::FindStaticClass(const std::string& fullName) const {
-    return gobjects_.FindStaticClass(fullName);
+SDK::UClass RLSDK::FindStaticClass(const SDK::ObjectPath& path) const {
+    return gobjects_.FindStaticClass(path);
 }
-SDK::UFunction RLSDK::FindStaticFunction(const std::string& fullName) const {
-    return gobjects_.FindStaticFunction(fullName);
+SDK::UFunction RLSDK::FindStaticFunction(const SDK::ObjectPath& path) const {
+    return gobjects_.FindStaticFunction(path);
 }
 SDK::AGameEvent RLSDK::GetCurrentGameEvent() const {
-    return currentGameEvent_;
+    return SDK::AGameEvent(currentGameEventAddress_.load());
 }
 void RLSDK::Subscribe(const std::string& eventType, EventManager::Callback callback) {
     eventMgr_.Subscribe(eventType, callback);
@@ -459,18 +468,17 @@ void RLSDK::Unsubscribe(const std::string& eventType, const EventManager::Callba
 // --- Update Callbacks for Hooks ---
 void RLSDK::UpdateCurrentGameEvent(uintptr_t gameEventAddress) {
     // ADDED LOG
-    Logger::Info("**** RLSDK::UpdateCurrentGameEvent called with address: " + Logger::to_hex(gameEventAddress) + " ****"); 
-    if (currentGameEvent_.Address != gameEventAddress) {
-        currentGameEvent_ = SDK::AGameEvent(gameEventAddress);
-        Logger::Info("RLSDK: Current GameEvent pointer updated to " + Logger::to_hex(gameEventAddress));
+    VUTRIUM_LOG(LogFormat::GameEventUpdateCalled, Logger::Hex(gameEventAddress));
+    if (currentGameEventAddress_.exchange(gameEventAddress) != gameEventAddress) {
+        VUTRIUM_LOG(LogFormat::GameEventUpdated, Logger::Hex(gameEventAddress));
     }
 }
 void RLSDK::NotifyGameEventDestroyed(uintptr_t gameEventAddress) {
     // ADDED LOG
-    Logger::Info("**** RLSDK::NotifyGameEventDestroyed called for address: " + Logger::to_hex(gameEventAddress) + " ****");
-    if (currentGameEvent_.Address == gameEventAddress) {
-        currentGameEvent_ = SDK::AGameEvent(0);
-        Logger::Info("RLSDK: Current GameEvent pointer cleared (Destroyed: " + Logger::to_hex(gameEventAddress) + ")");
+    VUTRIUM_LOG(LogFormat::GameEventDestroyCalled, Logger::Hex(gameEventAddress));
+    uintptr_t expected = gameEventAddress;
+    if (currentGameEventAddress_.compare_exchange_strong(expected, 0)) {
+        VUTRIUM_LOG(LogFormat::GameEventCleared, Logger::Hex(gameEventAddress));
     }
 }
 
@@ -481,102 +489,99 @@ std::string RLSDK::DetectBuildType() {
     char processPathRaw[MAX_PATH] = { 0 };
     if (GetModuleFileNameExA(memManager_.GetProcessHandle(), NULL, processPathRaw, MAX_PATH) == 0) {
         DWORD error = GetLastError();
-        Logger::Warning("Could not get process executable path (Error: " + std::to_string(error) + "). Assuming 'epic'.");
+        VUTRIUM_LOG_WARNING("Could not get process executable path (Error: " + std::to_string(error) + "). Assuming 'epic'.");
         return "epic";
     }
     std::string processPath(processPathRaw);
     std::transform(processPath.begin(), processPath.end(), processPath.begin(), ::tolower);
     if (processPath.find("steam") != std::string::npos) return "steam";
     else if (processPath.find("epic games") != std::string::npos || processPath.find("epicgames") != std::string::npos) return "epic";
-    else { Logger::Warning("Could not determine build type from path '" + std::string(processPathRaw) + "'. Assuming 'epic'."); return "epic"; }
+    else { VUTRIUM_LOG_WARNING("Could not determine build type from path '" + std::string(processPathRaw) + "'. Assuming 'epic'."); return "epic"; }
 }
 
 bool RLSDK::ResolveOffsets(size_t moduleSize) {
     std::optional<uintptr_t> gnamesAddrOpt;
     std::optional<uintptr_t> gobjectsAddrOpt;
 
-    Logger::Info("RLSDK Resolve: Trying offset method 1...");
+    VUTRIUM_LOG_INFO("RLSDK Resolve: Trying offset method 1...");
     auto gnamesPattern1Opt = PatternScan(memManager_, moduleBase_, moduleSize, SCAN_PATTERNS.at("GNames_1"), "GNames_1");
     if (gnamesPattern1Opt) {
         gnamesAddrOpt = CalculateMethod1(memManager_, *gnamesPattern1Opt, true);
-        if (gnamesAddrOpt) Logger::Info("Found GNames via Method 1 at: " + Logger::to_hex(*gnamesAddrOpt));
+        if (gnamesAddrOpt) VUTRIUM_LOG(LogFormat::SdkFoundGNames, 1, Logger::Hex(*gnamesAddrOpt));
     }
 
     auto gobjectsPattern1Opt = PatternScan(memManager_, moduleBase_, moduleSize, SCAN_PATTERNS.at("GObjects_1"), "GObjects_1");
     if (gobjectsPattern1Opt) {
         gobjectsAddrOpt = CalculateMethod1(memManager_, *gobjectsPattern1Opt, false);
-        if (gobjectsAddrOpt) Logger::Info("Found GObjects via Method 1 at: " + Logger::to_hex(*gobjectsAddrOpt));
+        if (gobjectsAddrOpt) VUTRIUM_LOG(LogFormat::SdkFoundGObjects, 1, Logger::Hex(*gobjectsAddrOpt));
     }
 
     // --- Try Alternative Method 2 (Matches Python GNames_2/GObjects_2) --- 
     if (!gnamesAddrOpt) {
-        Logger::Info("RLSDK Resolve: GNames Method 1 failed, trying Method 2 (GNames_2)...");
+        VUTRIUM_LOG_INFO("RLSDK Resolve: GNames Method 1 failed, trying Method 2 (GNames_2)...");
         auto gnamesPattern2Opt = PatternScan(memManager_, moduleBase_, moduleSize, SCAN_PATTERNS.at("GNames_2"), "GNames_2");
         if (gnamesPattern2Opt) {
             gnamesAddrOpt = CalculateMethod2(memManager_, *gnamesPattern2Opt);
-            if (gnamesAddrOpt) Logger::Info("Found GNames via Method 2 at: " + Logger::to_hex(*gnamesAddrOpt));
+            if (gnamesAddrOpt) VUTRIUM_LOG(LogFormat::SdkFoundGNames, 2, Logger::Hex(*gnamesAddrOpt));
         }
     }
 
     if (!gobjectsAddrOpt) {
-        Logger::Info("RLSDK Resolve: GObjects Method 1 failed, trying Method 2 (GObjects_2)...");
+        VUTRIUM_LOG_INFO("RLSDK Resolve: GObjects Method 1 failed, trying Method 2 (GObjects_2)...");
         auto gobjectsPattern2Opt = PatternScan(memManager_, moduleBase_, moduleSize, SCAN_PATTERNS.at("GObjects_2"), "GObjects_2");
         if (gobjectsPattern2Opt) {
             gobjectsAddrOpt = CalculateMethod2(memManager_, *gobjectsPattern2Opt);
-             if (gobjectsAddrOpt) Logger::Info("Found GObjects via Method 2 at: " + Logger::to_hex(*gobjectsAddrOpt));
+             if (gobjectsAddrOpt) VUTRIUM_LOG(LogFormat::SdkFoundGObjects, 2, Logger::Hex(*gobjectsAddrOpt));
         }
     }
     // Add more alternative methods here if needed, like GObjects_3
 
     // --- Final Check and Adjustment --- 
     if (!gnamesAddrOpt || !gobjectsAddrOpt) {
-        Logger::Error("RLSDK Resolve Error: Failed to find both GNames and GObjects addresses via any method.");
+        VUTRIUM_LOG_ERROR("RLSDK Resolve Error: Failed to find both GNames and GObjects addresses via any method.");
         return false;
     }
 
     uintptr_t gnamesAddr = *gnamesAddrOpt;
     uintptr_t gobjectsAddr = *gobjectsAddrOpt;
 
-    Logger::Info("RLSDK Resolve: Found absolute addresses: GNames=" + Logger::to_hex(gnamesAddr) +
-        ", GObjects=" + Logger::to_hex(gobjectsAddr));
+    VUTRIUM_LOG(LogFormat::SdkResolvedAbsolute, Logger::Hex(gnamesAddr), Logger::Hex(gobjectsAddr));
 
     // Perform the 0x48 difference check and adjustment (like Python)
     constexpr uintptr_t EXPECTED_DIFF = 0x48;
     uintptr_t currentDiff = (gobjectsAddr > gnamesAddr) ? (gobjectsAddr - gnamesAddr) : (gnamesAddr - gobjectsAddr);
 
     if (currentDiff != EXPECTED_DIFF) {
-        Logger::Warning("RLSDK Resolve: Offset difference is " + Logger::to_hex(currentDiff) +
-            ", expected " + Logger::to_hex(EXPECTED_DIFF) + ". Adjusting GNames based on GObjects.");
+        VUTRIUM_LOG(LogFormat::SdkOffsetDifference, Logger::Hex(currentDiff), Logger::Hex(EXPECTED_DIFF));
         if (gobjectsAddr > EXPECTED_DIFF) {
             gnamesAddr = gobjectsAddr - EXPECTED_DIFF;
-            Logger::Info("RLSDK Resolve: Adjusted GNames absolute address: " + Logger::to_hex(gnamesAddr));
+            VUTRIUM_LOG(LogFormat::SdkAdjustedGNames, Logger::Hex(gnamesAddr));
         }
         else {
-            Logger::Error("RLSDK Resolve Error: Cannot adjust GNames, GObjects address too low (" + Logger::to_hex(gobjectsAddr) + ").");
+            VUTRIUM_LOG(LogFormat::SdkGObjectsTooLow, Logger::Hex(gobjectsAddr));
             return false;
         }
     }
 
     if (gnamesAddr < moduleBase_ || gobjectsAddr < moduleBase_) {
-        Logger::Error("RLSDK Resolve Error: Calculated absolute addresses lower than module base.");
+        VUTRIUM_LOG_ERROR("RLSDK Resolve Error: Calculated absolute addresses lower than module base.");
         return false;
     }
     gnamesOffset_ = gnamesAddr - moduleBase_;
     gobjectsOffset_ = gobjectsAddr - moduleBase_;
 
-    Logger::Info("RLSDK Resolve: Successfully resolved relative offsets: GNames=" + Logger::to_hex(gnamesOffset_) +
-        ", GObjects=" + Logger::to_hex(gobjectsOffset_));
+    VUTRIUM_LOG(LogFormat::SdkResolvedOffsets, Logger::Hex(gnamesOffset_), Logger::Hex(gobjectsOffset_));
     return true;
 }
 
 bool RLSDK::SetupHooks() {
     bool allHooksSuccessful = true;
-    Logger::Info("RLSDK: Setting up ProcessEvent hook...");
+    VUTRIUM_LOG_INFO("RLSDK: Setting up ProcessEvent hook...");
 
     // --- Find Core.Object Class --- 
     SDK::UClass coreObjectClass = gobjects_.FindStaticClass(ClassName::CoreObject);
     if (!coreObjectClass.IsValid()) {
-        Logger::Error("SetupHooks Error: Could not find 'Class Core.Object'. Cannot find ProcessEvent.");
+        VUTRIUM_LOG_ERROR("SetupHooks Error: Could not find 'Class Core.Object'. Cannot find ProcessEvent.");
         return false;
     }
     // Logger::Info("Found Core.Object UClass at: " + Logger::to_hex(coreObjectClass.Address)); // Less verbose
@@ -584,7 +589,7 @@ bool RLSDK::SetupHooks() {
     // --- Get VTable Address --- 
     uintptr_t vtableAddress = memManager_.Read<uintptr_t>(coreObjectClass.Address).value_or(0);
     if (vtableAddress == 0) {
-        Logger::Error("SetupHooks Error: Failed to read VTable address from Core.Object UClass at offset 0.");
+        VUTRIUM_LOG_ERROR("SetupHooks Error: Failed to read VTable address from Core.Object UClass at offset 0.");
         return false;
     }
     // Logger::Info("Potential VTable address read: " + Logger::to_hex(vtableAddress)); // Less verbose
@@ -594,7 +599,7 @@ bool RLSDK::SetupHooks() {
     uintptr_t processEventAddress = memManager_.Read<uintptr_t>(vtableAddress + (sizeof(uintptr_t) * processEventVTableIndex)).value_or(0);
     
     if (processEventAddress == 0) {
-        Logger::Error("SetupHooks Error: Failed to read ProcessEvent function pointer from VTable index " + std::to_string(processEventVTableIndex));
+        VUTRIUM_LOG_ERROR("SetupHooks Error: Failed to read ProcessEvent function pointer from VTable index " + std::to_string(processEventVTableIndex));
         return false;
     }
     // Logger::Info("Found potential ProcessEvent address: " + Logger::to_hex(processEventAddress)); // Less verbose
@@ -606,20 +611,20 @@ bool RLSDK::SetupHooks() {
 
     // --- MODIFIED: Hook GameViewportClient::Tick via VTable --- 
     /* // REMOVE THIS BLOCK
-    Logger::Info("RLSDK: Setting up GameViewportClient::Tick hook via VTable...");
+    VUTRIUM_LOG_INFO("RLSDK: Setting up GameViewportClient::Tick hook via VTable...");
     constexpr int viewportTickVTableIndex = 71; // Common index for Tick
     uintptr_t viewportTickAddr = memManager_.Read<uintptr_t>(vtableAddress + (sizeof(uintptr_t) * viewportTickVTableIndex)).value_or(0);
 
     if (viewportTickAddr != 0) {
-         Logger::Info("Found potential GameViewportClient::Tick address via VTable: " + Logger::to_hex(viewportTickAddr));
+         VUTRIUM_LOG(LogFormat::SdkViewportTickFound, Logger::Hex(viewportTickAddr));
          if (!hookMgr_.CreateAndEnableHook("Engine.GameViewportClient.Tick", reinterpret_cast<LPVOID>(Hook_GameViewportClient_Tick), viewportTickAddr)) {
-             Logger::Error("SetupHooks Error: Failed to create hook for GameViewportClient::Tick via VTable.");
+             VUTRIUM_LOG_ERROR("SetupHooks Error: Failed to create hook for GameViewportClient::Tick via VTable.");
              // Decide if this failure is critical
              allHooksSuccessful = false; // Mark as failure if tick hook fails
          }
     } else {
-        Logger::Warning("SetupHooks Warning: Could not read GameViewportClient::Tick address from VTable index "
-                       + std::to_string(viewportTickVTableIndex) + ". GameEvent detection will not work.");
+        VUTRIUM_LOG_WARNING("SetupHooks Warning: Could not read GameViewportClient::Tick address from VTable index "
+                            + std::to_string(viewportTickVTableIndex) + ". GameEvent detection will not work.");
         allHooksSuccessful = false; // This hook is critical
     }
     */
@@ -641,19 +646,20 @@ bool RLSDK::SetupHooks() {
     }
     */
 
-    Logger::Info("RLSDK: Hook setup finished.");
+    VUTRIUM_LOG_INFO("RLSDK: Hook setup finished.");
     return allHooksSuccessful;
 }
 
 // Implementation of GetPing method
 int RLSDK::GetPing() const {
     // If the SDK is not initialized or we don't have a current game event, return -1
-    if (!initialized_ || !currentGameEvent_.IsValid()) {
+    SDK::AGameEvent gameEvent = GetCurrentGameEvent();
+    if (!initialized_ || !gameEvent.IsValid()) {
         return -1;
     }
     
     // Try to get the PRI for the local player
-    auto localPlayers = currentGameEvent_.GetLocalPlayers(memManager_);
+    auto localPlayers = gameEvent.GetLocalPlayers(memManager_);
     if (localPlayers.empty()) {
         return -1;
     }
@@ -676,10 +682,11 @@ std::optional<SDK::UObject> RLSDK::GetPlayerInput(std::optional<SDK::APlayerRepl
     }
     
     SDK::APlayerReplicationInfo pri = priOpt.value_or(SDK::APlayerReplicationInfo(0));
+    SDK::AGameEvent gameEvent = GetCurrentGameEvent();
     
     // If no PRI was provided, try to get the one from the current game event
-    if (!pri.IsValid() && currentGameEvent_.IsValid()) {
-        auto localPlayers = currentGameEvent_.GetLocalPlayers(memManager_);
+    if (!pri.IsValid() && gameEvent.IsValid()) {
+        auto localPlayers = gameEvent.GetLocalPlayers(memManager_);
         if (!localPlayers.empty()) {
             // localPlayers already contains APlayerController objects
             pri = localPlayers[0].GetPRI(memManager_);
@@ -691,9 +698,9 @@ std::optional<SDK::UObject> RLSDK::GetPlayerInput(std::optional<SDK::APlayerRepl
     }
     
     // Find the PlayerController for this PRI
-    std::vector<SDK::AController> allPlayers;
-    if (currentGameEvent_.IsValid()) {
-        allPlayers = currentGameEvent_.GetPlayers(memManager_);
+    SDK::TArrayView<SDK::AController> allPlayers;
+    if (gameEvent.IsValid()) {
+        allPlayers = gameEvent.GetPlayers(memManager_);
     }
     
     for (const auto& controller : allPlayers) {
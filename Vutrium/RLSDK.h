@@ -6,11 +6,14 @@
 #include <cstdint>
 #include <functional>
 #include <optional>
+#include <atomic>
+#include <mutex>
 #include "MemoryManager.h"
 #include "GNameTable.h"
 #include "GObjectsTable.h"
 #include "EventManager.h"
 #include "HookManager.h"
+#include "ObjectDiscovery.h"
 #include "Objects.hpp"
 #include "EventData.h"
 
@@ -28,11 +31,12 @@ public:
     GObjectsTable& GetGObjectsTable(); const GObjectsTable& GetGObjectsTable() const;
     EventManager& GetEventManager(); const EventManager& GetEventManager() const;
     HookManager& GetHookManager(); const HookManager& GetHookManager() const;
+    ObjectDiscovery& GetObjectDiscovery(); const ObjectDiscovery& GetObjectDiscovery() const;
     uintptr_t GetModuleBaseAddress() const; DWORD GetProcessID() const;
     const std::wstring& GetModuleName() const; const std::string& GetBuildType() const;
     std::string GetName(int32_t index) const;
-    SDK::UClass FindStaticClass(const std::string& fullName) const;
-    SDK::UFunction FindStaticFunction(const std::string& fullName) const;
+    SDK::UClass FindStaticClass(const SDK::ObjectPath& path) const;
+    SDK::UFunction FindStaticFunction(const SDK::ObjectPath& path) const;
     SDK::AGameEvent GetCurrentGameEvent() const;
     void Subscribe(const std::string& eventType, EventManager::Callback callback);
     void Unsubscribe(const std::string& eventType, const EventManager::Callback& callback);
@@ -45,7 +49,10 @@ public:
 private:
     MemoryManager memManager_; GNameTable gnames_; GObjectsTable gobjects_; EventManager eventMgr_; HookManager hookMgr_;
     bool initialized_ = false; bool shouldHookPlayerTick_ = false; std::wstring moduleName_; uintptr_t moduleBase_ = 0; DWORD processId_ = 0;
-    uintptr_t gnamesOffset_ = 0; uintptr_t gobjectsOffset_ = 0; std::string buildType_; SDK::AGameEvent currentGameEvent_;
+    uintptr_t gnamesOffset_ = 0; uintptr_t gobjectsOffset_ = 0; std::string buildType_;
+    // Written by the hook thread and ObjectDiscovery, read by everyone; transitions are serialized by gameEventMutex_.
+    std::atomic<uintptr_t> currentGameEventAddress_ = 0; std::mutex gameEventMutex_;
+    ObjectDiscovery discovery_; // Stopped in Shutdown() before the hooks and the MemoryManager go away
     std::string DetectBuildType(); bool ResolveOffsets(size_t moduleSize); bool SetupHooks();
 };
 
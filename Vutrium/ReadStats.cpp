@@ -0,0 +1,151 @@
+#include "ReadStats.h"
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace {
+    // Written only by the owning thread (relaxed load + store, no lock prefix), read by Collect().
+    struct Slab {
+        std::atomic<uint64_t> Values[ReadStats::CategoryCount][4] = {};
+    };
+
+    // Leaked on purpose: thread_local owners can be destroyed after static destructors have run.
+    struct Registry {
+        std::mutex Mutex;
+        std::vector<Slab*> Slabs;
+        ReadStats::Snapshot Retired; // Counts from threads that have exited
+    };
+
+    Registry& GetRegistry() {
+        static Registry* registry = new Registry();
+        return *registry;
+    }
+
+    void AddSlab(ReadStats::Snapshot& snapshot, const Slab& slab) {
+        for (size_t c = 0; c < ReadStats::CategoryCount; ++c) {
+            ReadStats::Counters& counters = snapshot.Categories[c];
+            counters.Calls += slab.Values[c][0].load(std::memory_order_relaxed);
+            counters.Bytes += slab.Values[c][1].load(std::memory_order_relaxed);
+            counters.Failures += slab.Values[c][2].load(std::memory_order_relaxed);
+            counters.Nanoseconds += slab.Values[c][3].load(std::memory_order_relaxed);
+        }
+    }
+
+    struct SlabOwner {
+        Slab* Owned = new Slab();
+
+        SlabOwner() {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            registry.Slabs.push_back(Owned);
+        }
+
+        ~SlabOwner() {
+            Registry& registry = GetRegistry();
+            std::lock_guard<std::mutex> lock(registry.Mutex);
+            AddSlab(registry.Retired, *Owned);
+            for (size_t i = 0; i < registry.Slabs.size(); ++i) {
+                if (registry.Slabs[i] == Owned) {
+                    registry.Slabs[i] = registry.Slabs.back();
+                    registry.Slabs.pop_back();
+                    break;
+                }
+            }
+            delete Owned;
+        }
+    };
+
+    inline void Bump(std::atomic<uint64_t>& value, uint64_t amount) {
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    // "12.3k" style counts for the log line.
+    std::string Compact(double value) {
+        char buffer[32];
+        if (value >= 1e6) snprintf(buffer, sizeof(buffer), "%.1fM", value / 1e6);
+        else if (value >= 1e4) snprintf(buffer, sizeof(buffer), "%.1fk", value / 1e3);
+        else snprintf(buffer, sizeof(buffer), "%.0f", value);
+        return buffer;
+    }
+}
+
+namespace ReadStats {
+    Counters Snapshot::Total() const {
+        Counters total;
+        for (const Counters& counters : Categories) {
+            total.Calls += counters.Calls;
+            total.Bytes += counters.Bytes;
+            total.Failures += counters.Failures;
+            total.Nanoseconds += counters.Nanoseconds;
+        }
+        return total;
+    }
+
+    Snapshot Snapshot::Since(const Snapshot& earlier) const {
+        Snapshot delta;
+        for (size_t c = 0; c < CategoryCount; ++c) {
+            delta.Categories[c].Calls = Categories[c].Calls - earlier.Categories[c].Calls;
+            delta.Categories[c].Bytes = Categories[c].Bytes - earlier.Categories[c].Bytes;
+            delta.Categories[c].Failures = Categories[c].Failures - earlier.Categories[c].Failures;
+            delta.Categories[c].Nanoseconds = Categories[c].Nanoseconds - earlier.Categories[c].Nanoseconds;
+        }
+        return delta;
+    }
+
+    const char* CategoryName(ReadCategory category) {
+        switch (category) {
+        case ReadCategory::Untagged: return "Untagged";
+        case ReadCategory::GNames: return "GNames";
+        case ReadCategory::GObjects: return "GObjects";
+        case ReadCategory::GameEvent: return "GameEvent";
+        case ReadCategory::Frame: return "Frame";
+        case ReadCategory::Pads: return "Pads";
+        case ReadCategory::Discovery: return "Discovery";
+        case ReadCategory::Hooks: return "Hooks";
+        case ReadCategory::Bridge: return "Bridge";
+        default: return "?";
+        }
+    }
+
+    void Record(ReadCategory category, size_t bytes, bool success, uint64_t nanoseconds) {
+        // The plain pointer keeps the per-read path off the guarded thread_local; the owner is
+        // only touched once per thread, to register the slab and retire it at thread exit.
+        thread_local Slab* slab = nullptr;
+        if (slab == nullptr) {
+            thread_local SlabOwner owner;
+            slab = owner.Owned;
+        }
+        std::atomic<uint64_t>* values = slab->Values[static_cast<size_t>(category) % CategoryCount];
+        Bump(values[0], 1);
+        Bump(values[1], bytes);
+        if (!success) Bump(values[2], 1);
+        Bump(values[3], nanoseconds);
+    }
+
+    Snapshot Collect() {
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.Mutex);
+        Snapshot snapshot = registry.Retired;
+        for (const Slab* slab : registry.Slabs) AddSlab(snapshot, *slab);
+        return snapshot;
+    }
+
+    std::string FormatSummary(const Snapshot& interval, double seconds) {
+        std::string summary;
+        for (size_t c = 0; c < CategoryCount; ++c) {
+            const Counters& counters = interval.Categories[c];
+            if (counters.Calls == 0) continue;
+
+            char buffer[160];
+            snprintf(buffer, sizeof(buffer), "%s %s calls (%s/s, %.1f MB, avg %.1f us%s%s)",
+                     CategoryName(static_cast<ReadCategory>(c)), Compact(static_cast<double>(counters.Calls)).c_str(),
+                     Compact(seconds > 0.0 ? counters.Calls / seconds : 0.0).c_str(), counters.Bytes / (1024.0 * 1024.0),
+                     counters.Nanoseconds / 1000.0 / counters.Calls, counters.Failures ? ", failed " : "",
+                     counters.Failures ? Compact(static_cast<double>(counters.Failures)).c_str() : "");
+            if (!summary.empty()) summary += ", ";
+            summary += buffer;
+        }
+        return summary;
+    }
+}
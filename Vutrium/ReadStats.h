@@ -0,0 +1,95 @@
+#ifndef READ_STATS_H
+#define READ_STATS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Accounting for MemoryManager::ReadBytes. Every read is charged to the category of the
+// innermost ReadScope on the calling thread: calls, bytes, failures and time spent in the
+// read. Counters live in per-thread slabs written only by their owner; Collect() sums them.
+//
+// Compiled in when VUTRIUM_READ_STATS is non-zero, which defaults to debug builds. When it
+// is zero, ReadScope is an empty object and ReadBytes skips the bookkeeping at compile time.
+#ifndef VUTRIUM_READ_STATS
+#ifdef _DEBUG
+#define VUTRIUM_READ_STATS 1
+#else
+#define VUTRIUM_READ_STATS 0
+#endif
+#endif
+
+enum class ReadCategory : uint8_t {
+    Untagged,   // Outside any ReadScope
+    GNames,     // GNameTable::Initialize
+    GObjects,   // GObjectsTable scans and lookups
+    GameEvent,  // Verifying and tracking the current GameEvent
+    Frame,      // FrameWorker captures (ball, cars, camera)
+    Pads,       // BoostPadTracker
+    Discovery,  // ObjectDiscovery tail scans
+    Hooks,      // Hook_ProcessEvent on the game thread
+    Bridge,     // Server thread (ball prediction stream)
+    Count
+};
+
+namespace ReadStats {
+    constexpr bool Enabled = VUTRIUM_READ_STATS != 0;
+    constexpr size_t CategoryCount = static_cast<size_t>(ReadCategory::Count);
+    constexpr double LogIntervalSeconds = 30.0;
+
+    struct Counters {
+        uint64_t Calls = 0;
+        uint64_t Bytes = 0;
+        uint64_t Failures = 0;
+        uint64_t Nanoseconds = 0;
+    };
+
+    struct Snapshot {
+        Counters Categories[CategoryCount];
+
+        const Counters& operator[](ReadCategory category) const { return Categories[static_cast<size_t>(category)]; }
+        Counters Total() const;
+        // Counts accumulated since 'earlier' (an older snapshot).
+        Snapshot Since(const Snapshot& earlier) const;
+    };
+
+    const char* CategoryName(ReadCategory category);
+
+    // The calling thread's current category; ReadScope is the way to change it.
+    inline ReadCategory& CurrentCategory() {
+        thread_local ReadCategory category = ReadCategory::Untagged;
+        return category;
+    }
+
+    void Record(ReadCategory category, size_t bytes, bool success, uint64_t nanoseconds);
+
+    // Sums every thread's slab, including threads that have exited. Takes a lock; meant for
+    // the debug window and the periodic log, not per-read use.
+    Snapshot Collect();
+
+    // One line per interval: "Frame 14.4k calls (480/s, 1.9 MB, avg 2.1 us), Pads ...".
+    // Empty if nothing was read.
+    std::string FormatSummary(const Snapshot& interval, double seconds);
+}
+
+// Charges reads on this thread to 'category' until the scope ends; scopes nest.
+class ReadScope {
+public:
+#if VUTRIUM_READ_STATS
+    explicit ReadScope(ReadCategory category) : previous_(ReadStats::CurrentCategory()) {
+        ReadStats::CurrentCategory() = category;
+    }
+    ~ReadScope() { ReadStats::CurrentCategory() = previous_; }
+#else
+    explicit ReadScope(ReadCategory) {}
+#endif
+    ReadScope(const ReadScope&) = delete;
+    ReadScope& operator=(const ReadScope&) = delete;
+
+private:
+#if VUTRIUM_READ_STATS
+    ReadCategory previous_;
+#endif
+};
+
+#endif // READ_STATS_H
@@ -0,0 +1,422 @@
+#include "SyntheticHeap.h"
+#include "Objects.hpp"
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+namespace {
+    // Object footprints. Only the headers are read, but real objects are this far apart, which
+    // matters for any read that spans neighbours.
+    constexpr size_t ObjectSize = 0x60;
+    constexpr size_t PropertySize = 0xB8;
+    constexpr size_t StructSize = 0x100;
+    constexpr size_t ClassSize = 0x200;
+    constexpr size_t ActorSize = 0x100;
+
+    constexpr uintptr_t VfTableOffset = 0x0800;
+    constexpr uintptr_t NativeFuncOffset = 0x0900;
+    constexpr size_t ModulePageSize = 0x1000;
+    constexpr size_t TailPadding = 0x1000; // GNameTable reads MaxNameLength characters past every string
+
+    const char* const CoreNames[] = {
+        "None", "Core", "Engine", "TAGame", "ProjectX", "Stadium_P", "TheWorld", "PersistentLevel",
+        "Object", "Field", "Struct", "State", "Class", "Function", "ScriptStruct", "Package",
+        "Property", "IntProperty", "FloatProperty", "BoolProperty", "ByteProperty", "NameProperty",
+        "StrProperty", "ObjectProperty", "StructProperty", "ArrayProperty", "Actor", "World", "Level",
+    };
+    enum CoreName : int32_t {
+        N_None, N_Core, N_Engine, N_TAGame, N_ProjectX, N_Stadium_P, N_TheWorld, N_PersistentLevel,
+        N_Object, N_Field, N_Struct, N_State, N_Class, N_Function, N_ScriptStruct, N_Package,
+        N_Property, N_IntProperty, N_FloatProperty, N_BoolProperty, N_ByteProperty, N_NameProperty,
+        N_StrProperty, N_ObjectProperty, N_StructProperty, N_ArrayProperty, N_Actor, N_World, N_Level,
+        N_CoreCount
+    };
+    static_assert(sizeof(CoreNames) / sizeof(CoreNames[0]) == N_CoreCount, "CoreNames out of sync");
+
+    const char* const NameParts[] = {
+        "Boost", "Car", "Ball", "Pickup", "Vehicle", "Team", "Score", "Goal", "Camera", "Input",
+        "Player", "Controller", "Replay", "Stat", "Match", "Game", "Event", "Server", "Client", "Net",
+        "Replicated", "Physics", "Wheel", "Jump", "Dodge", "Flip", "Demolish", "Rumble", "Item", "Product",
+        "Online", "Party", "Menu", "Audio", "Sound", "Particle", "Mesh", "Component", "Data", "Config",
+        "Settings", "Handle", "Update", "Tick", "Spawn", "Touch", "Hit", "Velocity", "Location", "Rotation",
+        "Angular", "Max", "Min", "Time", "Rate", "Count", "Index", "Info", "Save", "Load",
+        "Local", "Remote", "Active", "Mutator",
+    };
+    const char* const NamePrefixes[] = { "Get", "Set", "On", "Is", "Can", "Server", "Client", "event", "exec", "Init", "Reset" };
+    const char* const NameSuffixes[] = { "_TA", "_X", "_GFx", "_ORS", "_TA" };
+    constexpr size_t NamePartCount = sizeof(NameParts) / sizeof(NameParts[0]);
+    constexpr size_t NamePrefixCount = sizeof(NamePrefixes) / sizeof(NamePrefixes[0]);
+    constexpr size_t NameSuffixCount = sizeof(NameSuffixes) / sizeof(NameSuffixes[0]);
+
+    // The SDK's own classes (VUTRIUM_FIELD_OWNERS) with their manifest properties at the default
+    // offsets, so ResolveFieldOffsets() has something to find. Supers are earlier owners (below),
+    // otherwise Core.Object; AActor is Engine.Actor itself.
+    struct ManifestOwner { const char* Owner; const char* Package; const char* Name; };
+    constexpr ManifestOwner ManifestOwners[] = {
+#define VUTRIUM_HEAP_MANIFEST_OWNER(owner, package, name) { #owner, package, name },
+        VUTRIUM_FIELD_OWNERS(VUTRIUM_HEAP_MANIFEST_OWNER)
+#undef VUTRIUM_HEAP_MANIFEST_OWNER
+    };
+    constexpr size_t ManifestOwnerCount = sizeof(ManifestOwners) / sizeof(ManifestOwners[0]);
+    struct ManifestSuper { const char* Owner; const char* Super; };
+    constexpr ManifestSuper ManifestSupers[] = {
+        { "AGameEvent", "AActor" }, { "APlayerReplicationInfo", "AActor" }, { "APRI", "APlayerReplicationInfo" },
+        { "ACameraSettingsActor", "AActor" }, { "APawn", "AActor" }, { "AVehicle", "APawn" }, { "ACar", "AVehicle" },
+        { "ATeamInfo", "AActor" }, { "ATeam", "ATeamInfo" }, { "APlayerController", "AActor" },
+        { "AVehiclePickup", "AActor" }, { "AVehiclePickup_Boost", "AVehiclePickup" },
+    };
+    constexpr uint32_t ManifestPropertySize = 0x1000; // Past every manifest offset
+    constexpr uint32_t ManifestFillerMembers = 12;    // Up to this many other members before each manifest property
+
+    constexpr size_t FunctionSampleStride = 16;
+    constexpr size_t FunctionSampleLimit = 8192;
+}
+
+uint64_t SyntheticHeap::Rng::Next() {
+    // splitmix64: the heap must come out identical on MSVC and GCC, which <random> distributions don't promise.
+    uint64_t z = (State += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+uintptr_t SyntheticHeap::Allocate(size_t size, size_t alignment) {
+    const size_t offset = (image_.size() + alignment - 1) & ~(alignment - 1);
+    image_.resize(offset + size);
+    return ModuleBase + offset;
+}
+
+template<typename T>
+void SyntheticHeap::Put(uintptr_t address, const T& value) {
+    std::memcpy(image_.data() + (address - ModuleBase), &value, sizeof(T));
+}
+
+int32_t SyntheticHeap::AddName(const std::string& name) {
+    const int32_t index = static_cast<int32_t>(nameSlots_.size());
+    const uintptr_t entry = Allocate(SDK::FNameEntry::Offset_StringData + (name.size() + 1) * sizeof(char16_t), 8);
+    Put<int32_t>(entry + SDK::FNameEntry::Offset_IndexInEntry, index);
+    uintptr_t character = entry + SDK::FNameEntry::Offset_StringData;
+    for (char c : name) {
+        Put<char16_t>(character, static_cast<char16_t>(c));
+        character += sizeof(char16_t);
+    }
+    nameSlots_.push_back(entry);
+    return index;
+}
+
+void SyntheticHeap::PushObjectSlot(uintptr_t object) {
+    if (rng_.Chance(holeRatio_)) objectSlots_.push_back(0);
+    Put<int32_t>(object + SDK::UObject::Offset_InternalInteger, static_cast<int32_t>(objectSlots_.size()));
+    objectSlots_.push_back(object);
+}
+
+uintptr_t SyntheticHeap::AddObject(int32_t nameId, uintptr_t outer, uintptr_t objectClass, size_t size) {
+    const uintptr_t object = Allocate(size);
+    Put<uintptr_t>(object, ModuleBase + VfTableOffset);
+    Put<uintptr_t>(object + SDK::UObject::Offset_Outer, outer);
+    Put<int32_t>(object + SDK::UObject::Offset_Name, nameId);
+    Put<uintptr_t>(object + SDK::UObject::Offset_Class, objectClass);
+    PushObjectSlot(object);
+    return object;
+}
+
+void SyntheticHeap::LinkField(uintptr_t owner, uintptr_t field, uintptr_t& lastField) {
+    Put<uintptr_t>(lastField != 0 ? lastField + SDK::UField::Offset_Next : owner + SDK::UStruct::Offset_Children, field);
+    lastField = field;
+}
+
+bool SyntheticHeap::Build(const Config& config) {
+    image_.clear();
+    nameSlots_.clear();
+    objectSlots_.clear();
+    classFullNames_.clear();
+    functionFullNames_.clear();
+    instances_.clear();
+    nameCount_ = objectCount_ = functionCount_ = 0;
+    ResetCounters();
+
+    if (config.NameCount < N_CoreCount * 2 || config.NameCount > 500000 || config.ObjectCount < 1000) return false;
+    rng_.State = config.Seed;
+    holeRatio_ = config.HoleRatio;
+
+    image_.reserve(ModulePageSize + config.NameCount * 72 + config.ObjectCount * 0xB0 + TailPadding);
+    image_.resize(ModulePageSize);
+
+    // --- GNames ---
+    std::vector<std::string> names;
+    names.reserve(config.NameCount);
+    std::unordered_set<std::string> used;
+    used.reserve(config.NameCount);
+    for (const char* core : CoreNames) {
+        names.emplace_back(core);
+        used.insert(core);
+    }
+    auto addFixedName = [&](const char* name) {
+        if (used.insert(name).second) names.emplace_back(name);
+    };
+    for (const ManifestOwner& owner : ManifestOwners) addFixedName(owner.Name);
+    for (size_t field = 0; field < static_cast<size_t>(SDK::FieldId::Count); ++field) {
+        addFixedName(SDK::GetFieldInfo(static_cast<SDK::FieldId>(field)).Property);
+    }
+    const size_t firstRandomName = names.size();
+    auto fixedName = [&](std::string_view name) -> size_t {
+        return std::find(names.begin(), names.begin() + firstRandomName, name) - names.begin();
+    };
+    size_t collisions = 0;
+    while (names.size() < config.NameCount) {
+        std::string name;
+        if (rng_.Chance(0.3)) name = NamePrefixes[rng_.Below(NamePrefixCount)];
+        const uint32_t parts = 1 + rng_.Below(3) + (rng_.Chance(0.25) ? 1 : 0);
+        for (uint32_t p = 0; p < parts; ++p) name += NameParts[rng_.Below(NamePartCount)];
+        if (rng_.Chance(0.15)) name += NameSuffixes[rng_.Below(NameSuffixCount)];
+        if (!used.insert(name).second) {
+            name += "_" + std::to_string(collisions++);
+            used.insert(name);
+        }
+        names.push_back(std::move(name));
+    }
+    used.clear();
+
+    std::vector<int32_t> nameIds;
+    nameIds.reserve(names.size());
+    for (const std::string& name : names) {
+        if (nameSlots_.size() >= N_CoreCount && nameSlots_.size() + 1 < config.NameCount && rng_.Chance(holeRatio_)) {
+            nameSlots_.push_back(0);
+        }
+        if (nameSlots_.size() >= config.NameCount) break;
+        nameIds.push_back(AddName(name));
+    }
+    nameCount_ = nameIds.size();
+
+    // Unique names (classes, packages) are handed out in order; member names repeat across classes.
+    // The fixed names after CoreNames (the manifest's) are only handed out to the manifest classes.
+    size_t nextUniqueName = firstRandomName;
+    auto uniqueName = [&]() -> size_t {
+        if (nextUniqueName >= nameIds.size()) nextUniqueName = firstRandomName;
+        return nextUniqueName++;
+    };
+    auto memberName = [&]() -> size_t {
+        return firstRandomName + rng_.Below(static_cast<uint32_t>(nameIds.size() - firstRandomName));
+    };
+
+    // --- Core and Engine classes ---
+    // Created with a null Class first: the metaclasses don't exist until the end of this block.
+    const uintptr_t corePackage = AddObject(nameIds[N_Core], 0, 0, ObjectSize);
+    const uintptr_t enginePackage = AddObject(nameIds[N_Engine], 0, 0, ObjectSize);
+
+    struct ClassInfo { uintptr_t Address; size_t Name; size_t Package; bool IsActor; };
+    std::vector<ClassInfo> classes;
+    std::vector<size_t> actorClasses;
+    auto addClass = [&](size_t name, uintptr_t package, size_t packageName, uintptr_t metaClass, uintptr_t superClass, bool isActor) {
+        const uintptr_t address = AddObject(nameIds[name], package, metaClass, ClassSize);
+        Put<uintptr_t>(address + SDK::UStruct::Offset_SuperField, superClass);
+        if (isActor) actorClasses.push_back(classes.size());
+        classes.push_back({ address, name, packageName, isActor });
+        classFullNames_.push_back("Class " + names[packageName] + "." + names[name]);
+        return address;
+    };
+
+    const uintptr_t objectClass = addClass(N_Object, corePackage, N_Core, 0, 0, false);
+    Put<uint32_t>(objectClass + SDK::UStruct::Offset_PropertySize, static_cast<uint32_t>(ObjectSize)); // Where Actor's members start
+    const uintptr_t fieldClass = addClass(N_Field, corePackage, N_Core, 0, objectClass, false);
+    const uintptr_t structClass = addClass(N_Struct, corePackage, N_Core, 0, fieldClass, false);
+    const uintptr_t stateClass = addClass(N_State, corePackage, N_Core, 0, structClass, false);
+    const uintptr_t classClass = addClass(N_Class, corePackage, N_Core, 0, stateClass, false);
+    const uintptr_t functionClass = addClass(N_Function, corePackage, N_Core, 0, structClass, false);
+    const uintptr_t scriptStructClass = addClass(N_ScriptStruct, corePackage, N_Core, 0, structClass, false);
+    const uintptr_t packageClass = addClass(N_Package, corePackage, N_Core, 0, objectClass, false);
+    const uintptr_t propertyClass = addClass(N_Property, corePackage, N_Core, 0, fieldClass, false);
+    std::vector<uintptr_t> propertyClasses;
+    for (size_t name = N_IntProperty; name <= N_ArrayProperty; ++name) {
+        propertyClasses.push_back(addClass(name, corePackage, N_Core, 0, propertyClass, false));
+    }
+    const uintptr_t actorClass = addClass(N_Actor, enginePackage, N_Engine, 0, objectClass, true);
+    const uintptr_t worldClass = addClass(N_World, enginePackage, N_Engine, 0, objectClass, false);
+    const uintptr_t levelClass = addClass(N_Level, enginePackage, N_Engine, 0, objectClass, false);
+
+    for (const ClassInfo& info : classes) Put<uintptr_t>(info.Address + SDK::UObject::Offset_Class, classClass);
+    // Core.Class is its own class, and GObjectsTable skips self-classed objects like the game's.
+    classFullNames_.erase(std::find(classFullNames_.begin(), classFullNames_.end(), "Class Core.Class"));
+    Put<uintptr_t>(corePackage + SDK::UObject::Offset_Class, packageClass);
+    Put<uintptr_t>(enginePackage + SDK::UObject::Offset_Class, packageClass);
+
+    // --- Script packages: classes with functions, parameters, properties and structs ---
+    // The first ~3/4 of GObjects is what loads at startup; the rest is spawned per match.
+    const size_t staticObjects = config.ObjectCount * 3 / 4;
+    const size_t packageCount = (std::max)(static_cast<size_t>(4), config.ObjectCount / 20000);
+    const size_t classesPerPackage = (std::max)(static_cast<size_t>(8), staticObjects / 20 / packageCount);
+
+    auto addProperty = [&](uintptr_t owner, uintptr_t& lastField) {
+        const uintptr_t propertyType = propertyClasses[rng_.Below(static_cast<uint32_t>(propertyClasses.size()))];
+        LinkField(owner, AddObject(nameIds[memberName()], owner, propertyType, PropertySize), lastField);
+    };
+
+    size_t packageName = N_TAGame;
+    uintptr_t package = AddObject(nameIds[packageName], 0, packageClass, ObjectSize);
+    size_t packageClasses = 0;
+
+    fieldProperties_.assign(static_cast<size_t>(SDK::FieldId::Count), 0);
+    std::vector<uintptr_t> ownerClasses(ManifestOwnerCount, 0);
+    std::vector<bool> ownerIsActor(ManifestOwnerCount, false);
+    for (size_t owner = 0; owner < ManifestOwnerCount; ++owner) {
+        const ManifestOwner& info = ManifestOwners[owner];
+        if (std::strcmp(info.Owner, "AActor") == 0) {
+            ownerClasses[owner] = actorClass;
+            ownerIsActor[owner] = true;
+        }
+        else {
+            const char* superOwner = nullptr;
+            for (const ManifestSuper& entry : ManifestSupers) {
+                if (std::strcmp(entry.Owner, info.Owner) == 0) superOwner = entry.Super;
+            }
+            uintptr_t superClass = objectClass;
+            for (size_t super = 0; superOwner != nullptr && super < owner; ++super) {
+                if (std::strcmp(ManifestOwners[super].Owner, superOwner) != 0) continue;
+                superClass = ownerClasses[super];
+                ownerIsActor[owner] = ownerIsActor[super];
+            }
+            const bool inEngine = std::strcmp(info.Package, "Engine") == 0;
+            ownerClasses[owner] = addClass(fixedName(info.Name), inEngine ? enginePackage : package, inEngine ? N_Engine : N_TAGame,
+                                           classClass, superClass, ownerIsActor[owner]);
+        }
+        Put<uint32_t>(ownerClasses[owner] + SDK::UStruct::Offset_PropertySize, ManifestPropertySize);
+
+        uintptr_t lastField = 0;
+        for (size_t field = 0; field < fieldProperties_.size(); ++field) {
+            const SDK::FieldInfo& fieldInfo = SDK::GetFieldInfo(static_cast<SDK::FieldId>(field));
+            if (std::strcmp(fieldInfo.Owner, info.Owner) != 0) continue;
+            const uint32_t fillerCount = rng_.Below(ManifestFillerMembers + 1);
+            for (uint32_t f = 0; f < fillerCount; ++f) addProperty(ownerClasses[owner], lastField);
+
+            const uintptr_t propertyType = propertyClasses[rng_.Below(static_cast<uint32_t>(propertyClasses.size()))];
+            const uintptr_t property = AddObject(nameIds[fixedName(fieldInfo.Property)], ownerClasses[owner], propertyType, PropertySize);
+            Put<int32_t>(property + SDK::UProperty::Offset_ArrayDim, 1);
+            Put<int32_t>(property + SDK::UProperty::Offset_ElementSize, static_cast<int32_t>(fieldInfo.Size));
+            Put<int32_t>(property + SDK::UProperty::Offset_Offset, static_cast<int32_t>(fieldInfo.DefaultOffset));
+            LinkField(ownerClasses[owner], property, lastField);
+            fieldProperties_[field] = property;
+        }
+    }
+    while (objectSlots_.size() < staticObjects) {
+        if (packageClasses++ >= classesPerPackage) {
+            packageName = packageName == N_TAGame ? static_cast<size_t>(N_ProjectX) : uniqueName();
+            package = AddObject(nameIds[packageName], 0, packageClass, ObjectSize);
+            packageClasses = 1;
+        }
+
+        // Random recursive tree over everything so far: depth grows like ln(classes), ~10 at RL's size.
+        const ClassInfo& parent = classes[rng_.Below(static_cast<uint32_t>(classes.size()))];
+        const size_t className = uniqueName();
+        const bool isActor = parent.IsActor;
+        const uintptr_t classAddress = addClass(className, package, packageName, classClass, parent.Address, isActor);
+
+        uintptr_t lastField = 0;
+        const uint32_t functionCount = rng_.Below(11);
+        for (uint32_t f = 0; f < functionCount; ++f) {
+            const size_t functionName = memberName();
+            const uintptr_t function = AddObject(nameIds[functionName], classAddress, functionClass, StructSize);
+            Put<uintptr_t>(function + SDK::UFunction::Offset_Func, ModuleBase + NativeFuncOffset);
+            LinkField(classAddress, function, lastField);
+
+            uintptr_t lastParameter = 0;
+            const uint32_t parameterCount = rng_.Below(4);
+            for (uint32_t p = 0; p < parameterCount; ++p) addProperty(function, lastParameter);
+
+            if (functionCount_++ % FunctionSampleStride == 0 && functionFullNames_.size() < FunctionSampleLimit) {
+                functionFullNames_.push_back("Function " + names[packageName] + "." + names[className] + "." + names[functionName]);
+            }
+        }
+
+        const uint32_t propertyCount = rng_.Below(9);
+        for (uint32_t p = 0; p < propertyCount; ++p) addProperty(classAddress, lastField);
+
+        if (rng_.Chance(0.25)) {
+            const uintptr_t scriptStruct = AddObject(nameIds[memberName()], classAddress, scriptStructClass, StructSize);
+            LinkField(classAddress, scriptStruct, lastField);
+            uintptr_t lastMember = 0;
+            const uint32_t memberCount = 1 + rng_.Below(6);
+            for (uint32_t m = 0; m < memberCount; ++m) addProperty(scriptStruct, lastMember);
+        }
+    }
+
+    // --- Match-time actors: Stadium_P.TheWorld.PersistentLevel.<Actor>[.<Component>] ---
+    const uintptr_t mapPackage = AddObject(nameIds[N_Stadium_P], 0, packageClass, ObjectSize);
+    const uintptr_t world = AddObject(nameIds[N_TheWorld], mapPackage, worldClass, ObjectSize);
+    const uintptr_t level = AddObject(nameIds[N_PersistentLevel], world, levelClass, ObjectSize);
+    std::vector<int32_t> instanceNumbers(classes.size(), 0);
+    while (objectSlots_.size() < config.ObjectCount) {
+        const size_t classIndex = actorClasses[rng_.Below(static_cast<uint32_t>(actorClasses.size()))];
+        const ClassInfo& info = classes[classIndex];
+        const uintptr_t actor = AddObject(nameIds[info.Name], level, info.Address, ActorSize);
+        Put<int32_t>(actor + SDK::UObject::Offset_InstanceNumber, instanceNumbers[classIndex]++);
+        instances_.push_back(actor);
+
+        const uint32_t componentCount = rng_.Below(3);
+        for (uint32_t c = 0; c < componentCount && objectSlots_.size() < config.ObjectCount; ++c) {
+            const ClassInfo& componentClass = classes[rng_.Below(static_cast<uint32_t>(classes.size()))];
+            AddObject(nameIds[componentClass.Name], actor, componentClass.Address, ObjectSize);
+        }
+    }
+    objectCount_ = objectSlots_.size();
+
+    // --- The two TArrays the module globals point at ---
+    const uintptr_t namesData = Allocate(nameSlots_.size() * sizeof(uintptr_t), 8);
+    std::memcpy(image_.data() + (namesData - ModuleBase), nameSlots_.data(), nameSlots_.size() * sizeof(uintptr_t));
+    const uintptr_t objectsData = Allocate(objectSlots_.size() * sizeof(uintptr_t), 8);
+    std::memcpy(image_.data() + (objectsData - ModuleBase), objectSlots_.data(), objectSlots_.size() * sizeof(uintptr_t));
+
+    SDK::TArrayLayout namesArray;
+    namesArray.ArrayData = namesData;
+    namesArray.ArrayCount = namesArray.ArrayMax = static_cast<int32_t>(nameSlots_.size());
+    Put(ModuleBase + GNamesOffset, namesArray);
+    SDK::TArrayLayout objectsArray;
+    objectsArray.ArrayData = objectsData;
+    objectsArray.ArrayCount = objectsArray.ArrayMax = static_cast<int32_t>(objectSlots_.size());
+    Put(ModuleBase + GObjectsOffset, objectsArray);
+
+    image_.resize(image_.size() + TailPadding);
+    nameSlots_.clear();
+    nameSlots_.shrink_to_fit();
+    objectSlots_.clear();
+    objectSlots_.shrink_to_fit();
+    return true;
+}
+
+uintptr_t SyntheticHeap::AddTArray(const std::vector<uintptr_t>& elements) {
+    if (image_.empty()) return 0;
+    SDK::TArrayLayout layout;
+    layout.ArrayCount = layout.ArrayMax = static_cast<int32_t>(elements.size());
+    if (!elements.empty()) {
+        layout.ArrayData = Allocate(elements.size() * sizeof(uintptr_t), 8);
+        std::memcpy(image_.data() + (layout.ArrayData - ModuleBase), elements.data(), elements.size() * sizeof(uintptr_t));
+    }
+    const uintptr_t header = Allocate(sizeof(layout), 8);
+    Put(header, layout);
+    return header;
+}
+
+uintptr_t SyntheticHeap::AddFString(const std::u16string& text) {
+    if (image_.empty()) return 0;
+    SDK::FStringLayout layout;
+    layout.ArrayCount = layout.ArrayMax = static_cast<int32_t>(text.size() + 1);
+    const size_t bytes = (text.size() + 1) * sizeof(char16_t);
+    layout.ArrayData = Allocate(bytes, 8);
+    std::memcpy(image_.data() + (layout.ArrayData - ModuleBase), text.c_str(), bytes);
+    const uintptr_t header = Allocate(sizeof(layout), 8);
+    Put(header, layout);
+    return header;
+}
+
+bool SyntheticHeap::ReadBytes(uintptr_t address, void* pBuffer, size_t size) const {
+    readCount_.fetch_add(1, std::memory_order_relaxed);
+    bytesRead_.fetch_add(size, std::memory_order_relaxed);
+    if (address < ModuleBase || size > image_.size() || address - ModuleBase > image_.size() - size) return false;
+    std::memcpy(pBuffer, image_.data() + (address - ModuleBase), size);
+    return true;
+}
+
+bool SyntheticHeap::WriteBytes(uintptr_t address, const void* pBuffer, size_t size) {
+    if (address < ModuleBase || size > image_.size() || address - ModuleBase > image_.size() - size) return false;
+    std::memcpy(image_.data() + (address - ModuleBase), pBuffer, size);
+    return true;
+}
@@ -0,0 +1,111 @@
+#ifndef SYNTHETIC_HEAP_H
+#define SYNTHETIC_HEAP_H
+
+#include "MemoryManager.h"
+#include "Objects.hpp"
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A fabricated UE3 process image for exercising GNameTable/GObjectsTable without the game.
+// Build() lays out, in one contiguous buffer at a fake x64 image base:
+//   - a "module" page holding the GNames and GObjects TArrays (at GetGNamesOffset()/GetGObjectsOffset())
+//   - FNameEntry records (index at Offset_IndexInEntry, UTF-16 string at Offset_StringData)
+//   - UObjects with the SDK::UObject header (see Offset_* in SDK::UObject): packages,
+//     a Class/SuperField hierarchy rooted at Core.Object, functions and properties linked through
+//     Children/Next, and match-time actors and components with Outer chains up to the map package.
+//   - the SDK's own classes (TAGame.GameEvent_Soccar_TA, Engine.Actor, ...) with every manifest
+//     property at its default offset, among other members
+
+// Attach a MemoryManager to it and pass GetModuleBase() plus the offsets to the Initialize calls.
+// Generation is seeded and platform independent, so every machine builds the same heap.
+class SyntheticHeap : public MemoryBackend {
+public:
+    struct Config {
+        size_t NameCount = 500000;      // GNames slots; GNameTable rejects more than 500k
+        size_t ObjectCount = 1000000;   // GObjects slots, holes included
+        double HoleRatio = 0.002;       // Fraction of null slots in both tables (freed entries)
+        uint64_t Seed = 0x5654524955ull;
+    };
+
+    SyntheticHeap() = default;
+    SyntheticHeap(const SyntheticHeap&) = delete;
+    SyntheticHeap& operator=(const SyntheticHeap&) = delete;
+
+    bool Build(const Config& config);
+
+    uintptr_t GetModuleBase() const { return ModuleBase; }
+    uintptr_t GetGNamesOffset() const { return GNamesOffset; }
+    uintptr_t GetGObjectsOffset() const { return GObjectsOffset; }
+    size_t GetImageSize() const { return image_.size(); }
+
+    size_t GetNameCount() const { return nameCount_; }
+    size_t GetObjectCount() const { return objectCount_; }
+    size_t GetClassCount() const { return classFullNames_.size(); }
+    size_t GetFunctionCount() const { return functionCount_; }
+
+    // What GObjectsTable should find: every "Class Package.Name", and a sample of "Function ..." names.
+    const std::vector<std::string>& GetClassFullNames() const { return classFullNames_; }
+    const std::vector<std::string>& GetFunctionFullNames() const { return functionFullNames_; }
+    // Match-time actor instances (the tail of GObjects); every one of them IsA "Actor".
+    const std::vector<uintptr_t>& GetInstances() const { return instances_; }
+    // The UProperty standing for a manifest field, e.g. to move it with WriteBytes.
+    uintptr_t GetFieldProperty(SDK::FieldId field) const { return fieldProperties_[static_cast<size_t>(field)]; }
+
+    // Places a TArray of 'elements' in the heap and returns the address of its header, like the
+    // actor-owned arrays GetTArrayItems walks (GameEvent Cars/PRIs/Balls). Call after Build().
+    uintptr_t AddTArray(const std::vector<uintptr_t>& elements);
+    // Places an FString holding 'text' (plus the terminator, counted in ArrayCount like the game
+    // does) and returns the address of its header, like APRI::PlayerName. Call after Build().
+    uintptr_t AddFString(const std::u16string& text);
+
+    // --- MemoryBackend ---
+    bool ReadBytes(uintptr_t address, void* pBuffer, size_t size) const override;
+    bool WriteBytes(uintptr_t address, const void* pBuffer, size_t size) override;
+
+    // Counted on every ReadBytes, hits and misses alike, so callers can report reads per operation.
+    uint64_t GetReadCount() const { return readCount_.load(std::memory_order_relaxed); }
+    uint64_t GetBytesRead() const { return bytesRead_.load(std::memory_order_relaxed); }
+    void ResetCounters() { readCount_ = 0; bytesRead_ = 0; }
+
+    static constexpr uintptr_t ModuleBase = 0x7FF640000000ull;
+    static constexpr uintptr_t GNamesOffset = 0x0100;
+    static constexpr uintptr_t GObjectsOffset = 0x0118;
+
+private:
+    struct Rng {
+        uint64_t State;
+        uint64_t Next();
+        uint32_t Below(uint32_t bound) { return static_cast<uint32_t>((Next() >> 32) * bound >> 32); }
+        bool Chance(double probability) { return (Next() >> 11) * (1.0 / 9007199254740992.0) < probability; }
+    };
+
+    uintptr_t Allocate(size_t size, size_t alignment = 16);
+    template<typename T>
+    void Put(uintptr_t address, const T& value);
+
+    int32_t AddName(const std::string& name);
+    uintptr_t AddObject(int32_t nameId, uintptr_t outer, uintptr_t objectClass, size_t size);
+    void LinkField(uintptr_t owner, uintptr_t field, uintptr_t& lastField);
+    void PushObjectSlot(uintptr_t object);
+
+    std::vector<uint8_t> image_;
+    std::vector<uintptr_t> objectSlots_;
+    std::vector<uintptr_t> nameSlots_;
+    Rng rng_ = { 0 };
+    double holeRatio_ = 0.0;
+
+    size_t nameCount_ = 0;
+    size_t objectCount_ = 0;
+    size_t functionCount_ = 0;
+    std::vector<std::string> classFullNames_;
+    std::vector<std::string> functionFullNames_;
+    std::vector<uintptr_t> instances_;
+    std::vector<uintptr_t> fieldProperties_;   // Indexed by FieldId
+
+    mutable std::atomic<uint64_t> readCount_{ 0 };
+    mutable std::atomic<uint64_t> bytesRead_{ 0 };
+};
+
+#endif // SYNTHETIC_HEAP_H
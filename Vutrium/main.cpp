@@ -14,6 +14,7 @@
 #include <Wbemidl.h>
 #include <TlHelp32.h>
 #include <algorithm>
+#include <ctime>
 #pragma comment(lib, "wbemuuid.lib")
 
 SOCKET g_ServerSocket = INVALID_SOCKET;
@@ -22,6 +23,7 @@ std::atomic<bool> g_ClientConnected = false;
 std::atomic<bool> g_SettingsChangedForClient = false;
 std::atomic<bool> g_ServerThreadActive = false;
 HANDLE g_hServerMainLoopThread = NULL;
+HANDLE g_hMainThread = NULL; // Kept so EjectThread can wait for MainThread (and the logger) to finish
 const int SERVER_PORT = 13337;
 const bool debugBUILD = true;
 const bool isPAIDBUILD = false;
@@ -33,12 +35,10 @@ std::atomic<bool> g_AutoBallCamForClient = false;
 std::atomic<bool> g_SpeedflipKickoffForClient = true;
 std::atomic<bool> g_PythonMonitoringForClient = false;
 std::atomic<bool> g_ClockEnabledForClient = true;
+std::atomic<bool> g_StreamBallPredictionForClient = true;
 std::string g_SelectedBotNameForClient = "Nexto";
 std::mutex g_SettingsMutex;
 
-std::chrono::steady_clock::time_point g_LastGameEventValidityCheck = std::chrono::steady_clock::now();
-constexpr float GAME_EVENT_VALIDITY_CHECK_INTERVAL = 3.0f;
-
 std::atomic<uint64_t> g_PacketsSentToClient = 0;
 std::atomic<uint64_t> g_BytesSentToClient = 0;
 std::atomic<uint64_t> g_ConnectionsEstablished = 0;
@@ -61,6 +61,14 @@ std::atomic<bool> g_SdkAndHooksInitialized = false;
 #include "includes.h"
 #include "RLSDK.h"
 #include "Logger.h"
+#include "ArenaSDF.h"
+#include "BallPredictor.h"
+#include "BridgeProtocol.h"
+#include "CameraProjection.h"
+#include "FrameWorker.h"
+#include "MatchRecorder.h"
+#include "PresentTimer.h"
+#include "ReadStats.h"
 #include <algorithm>
 
 #define UCONST_Pi 3.1415926f
@@ -129,30 +137,16 @@ SDK::FVectorData VectorCrossProduct(const SDK::FVectorData& A, const SDK::FVecto
 			A.X * B.Y - A.Y * B.X };
 }
 
-std::optional<std::tuple<ImVec2, float>> WorldToScreen(const SDK::FVectorData& WorldLocation, const SDK::FVectorData& CameraLocation,
-	const SDK::FRotatorData& CameraRotation, float FOVAngle, float ScreenWidth, float ScreenHeight) {
-	SDK::FVectorData AxisX, AxisY, AxisZ;
-	GetAxes(CameraRotation, AxisX, AxisY, AxisZ);
-
-	SDK::FVectorData Delta = VectorSubtract(WorldLocation, CameraLocation);
-
-	SDK::FVectorData Transformed;
-	Transformed.X = VectorDotProduct(Delta, AxisY);
-	Transformed.Y = VectorDotProduct(Delta, AxisZ);
-	Transformed.Z = VectorDotProduct(Delta, AxisX);
+Vec3 ToVec3(const SDK::FVectorData& v) {
+	return { v.X, v.Y, v.Z };
+}
 
-	if (Transformed.Z <= 0.1f) {
+std::optional<std::tuple<ImVec2, float>> WorldToScreen(const SDK::FVectorData& WorldLocation, const CameraProjection& Camera) {
+	CameraProjection::ScreenPoint point;
+	if (!Camera.Project(ToVec3(WorldLocation), point)) {
 		return std::nullopt;
 	}
-
-	float TanHalfFOV = tan(FOVAngle * UCONST_Pi / 360.0f);
-	float ScreenCenterX = ScreenWidth / 2.0f;
-	float ScreenCenterY = ScreenHeight / 2.0f;
-
-	float X = ScreenCenterX + Transformed.X * (ScreenCenterX / TanHalfFOV) / Transformed.Z;
-	float Y = ScreenCenterY + -Transformed.Y * (ScreenCenterX / TanHalfFOV) / Transformed.Z;
-
-	return std::make_tuple(ImVec2(X, Y), Transformed.Z);
+	return std::make_tuple(ImVec2(point.X, point.Y), point.Depth);
 }
 
 bool ClipLineSegment(ImVec2& p0, ImVec2& p1, const ImVec2& clipMin, const ImVec2& clipMax) {
@@ -191,54 +185,51 @@ bool ClipLineSegment(ImVec2& p0, ImVec2& p1, const ImVec2& clipMin, const ImVec2
 }
 
 void DrawSphereWorld(const SDK::FVectorData& Center, float Radius, int Segments, const ImU32 Color,
-	const SDK::FVectorData& CamLoc, const SDK::FRotatorData& CamRot, float FOV,
-	float ScreenWidth, float ScreenHeight)
+	const CameraProjection& Camera)
 {
 	ImDrawList* drawList = ImGui::GetForegroundDrawList();
-	std::vector<std::vector<ImVec2>> points(Segments + 1);
-
-	for (int i = 0; i <= Segments; ++i) {
-		float lat = UCONST_Pi * (-0.5f + (float)i / Segments);
-		float cosLat = cos(lat);
-
-		points[i].resize(Segments + 1);
-		for (int j = 0; j <= Segments; ++j) {
-			float lon = 2 * UCONST_Pi * (float)j / Segments;
-
-			SDK::FVectorData point3D;
-			point3D.X = Center.X + Radius * cosLat * cos(lon);
-			point3D.Y = Center.Y + Radius * cosLat * sin(lon);
-			point3D.Z = Center.Z + Radius * sin(lat);
-
-			auto screenPosOpt = WorldToScreen(point3D, CamLoc, CamRot, FOV, ScreenWidth, ScreenHeight);
-
-			if (screenPosOpt) {
-				ImVec2 screenPos = std::get<0>(*screenPosOpt);
-				if (screenPos.x >= -100 && screenPos.x <= ScreenWidth + 100 &&
-					screenPos.y >= -100 && screenPos.y <= ScreenHeight + 100) {
-					points[i][j] = screenPos;
-				}
-				else {
-					points[i][j] = ImVec2(NAN, NAN);
-				}
-			}
-			else {
-				points[i][j] = ImVec2(NAN, NAN);
+	const int rowLength = Segments + 1;
+
+	// Unit sphere only depends on the segment count, so the trig is done once.
+	static std::vector<Vec3> unitPoints;
+	static int unitSegments = 0;
+	if (unitSegments != Segments) {
+		unitPoints.resize(static_cast<size_t>(rowLength) * rowLength);
+		for (int i = 0; i <= Segments; ++i) {
+			float lat = UCONST_Pi * (-0.5f + (float)i / Segments);
+			float cosLat = cos(lat);
+			for (int j = 0; j <= Segments; ++j) {
+				float lon = 2 * UCONST_Pi * (float)j / Segments;
+				unitPoints[i * rowLength + j] = { cosLat * cos(lon), cosLat * sin(lon), sin(lat) };
 			}
 		}
+		unitSegments = Segments;
+	}
+
+	static std::vector<Vec3> worldPoints;
+	static std::vector<CameraProjection::ScreenPoint> points;
+	worldPoints.resize(unitPoints.size());
+	points.resize(unitPoints.size());
+
+	const Vec3 center = ToVec3(Center);
+	for (size_t i = 0; i < unitPoints.size(); ++i) {
+		worldPoints[i] = center + unitPoints[i] * Radius;
+	}
+	if (Camera.ProjectBatch(worldPoints.data(), worldPoints.size(), points.data()) == 0) {
+		return;
 	}
 
 	for (int i = 0; i < Segments; ++i) {
 		for (int j = 0; j < Segments; ++j) {
-			ImVec2 p1 = points[i][j];
-			ImVec2 p2 = points[i + 1][j];
-			ImVec2 p3 = points[i][j + 1];
+			const CameraProjection::ScreenPoint& p1 = points[i * rowLength + j];
+			const CameraProjection::ScreenPoint& p2 = points[(i + 1) * rowLength + j];
+			const CameraProjection::ScreenPoint& p3 = points[i * rowLength + j + 1];
 
-			if (!isnan(p1.x) && !isnan(p3.x)) {
-				drawList->AddLine(p1, p3, Color);
+			if (p1.OnScreen() && p3.OnScreen()) {
+				drawList->AddLine(ImVec2(p1.X, p1.Y), ImVec2(p3.X, p3.Y), Color);
 			}
-			if (!isnan(p1.x) && !isnan(p2.x)) {
-				drawList->AddLine(p1, p2, Color);
+			if (p1.OnScreen() && p2.OnScreen()) {
+				drawList->AddLine(ImVec2(p1.X, p1.Y), ImVec2(p2.X, p2.Y), Color);
 			}
 		}
 	}
@@ -259,8 +250,7 @@ static void HelpMarker(const char* desc)
 
 void DrawWireframeBox(const SDK::FVectorData& Center, const SDK::FRotatorData& Rotation,
 	const SDK::FVectorData& HalfExtents, const ImU32 Color,
-	const SDK::FVectorData& CamLoc, const SDK::FRotatorData& CamRot, float FOV,
-	float ScreenWidth, float ScreenHeight)
+	const CameraProjection& Camera)
 {
 	ImDrawList* drawList = ImGui::GetForegroundDrawList();
 
@@ -277,24 +267,19 @@ void DrawWireframeBox(const SDK::FVectorData& Center, const SDK::FRotatorData& R
 	corners[6] = { HalfExtents.X,  HalfExtents.Y,  HalfExtents.Z };
 	corners[7] = { -HalfExtents.X,  HalfExtents.Y,  HalfExtents.Z };
 
-	ImVec2 screenCorners[8];
+	Vec3 worldCorners[8];
 	for (int i = 0; i < 8; ++i) {
 		SDK::FVectorData rotatedOffset;
 		rotatedOffset.X = AxisX.X * corners[i].X + AxisY.X * corners[i].Y + AxisZ.X * corners[i].Z;
 		rotatedOffset.Y = AxisX.Y * corners[i].X + AxisY.Y * corners[i].Y + AxisZ.Y * corners[i].Z;
 		rotatedOffset.Z = AxisX.Z * corners[i].X + AxisY.Z * corners[i].Y + AxisZ.Z * corners[i].Z;
 
-		SDK::FVectorData worldCorner = { Center.X + rotatedOffset.X, Center.Y + rotatedOffset.Y, Center.Z + rotatedOffset.Z };
-
-		auto screenPosOpt = WorldToScreen(worldCorner, CamLoc, CamRot, FOV, ScreenWidth, ScreenHeight);
-		if (screenPosOpt) {
-			screenCorners[i] = std::get<0>(*screenPosOpt);
-		}
-		else {
-			screenCorners[i] = ImVec2(NAN, NAN);
-		}
+		worldCorners[i] = { Center.X + rotatedOffset.X, Center.Y + rotatedOffset.Y, Center.Z + rotatedOffset.Z };
 	}
 
+	CameraProjection::ScreenPoint screenCorners[8];
+	Camera.ProjectBatch(worldCorners, 8, screenCorners);
+
 	int edges[12][2] = {
 		{0, 1}, {1, 2}, {2, 3}, {3, 0},
 		{4, 5}, {5, 6}, {6, 7}, {7, 4},
@@ -302,11 +287,11 @@ void DrawWireframeBox(const SDK::FVectorData& Center, const SDK::FRotatorData& R
 	};
 
 	for (int i = 0; i < 12; ++i) {
-		ImVec2 p1 = screenCorners[edges[i][0]];
-		ImVec2 p2 = screenCorners[edges[i][1]];
+		const CameraProjection::ScreenPoint& p1 = screenCorners[edges[i][0]];
+		const CameraProjection::ScreenPoint& p2 = screenCorners[edges[i][1]];
 
-		if (!isnan(p1.x) && !isnan(p1.y) && !isnan(p2.x) && !isnan(p2.y)) {
-			drawList->AddLine(p1, p2, Color, 1.5f);
+		if (p1.InFront() && p2.InFront()) {
+			drawList->AddLine(ImVec2(p1.X, p1.Y), ImVec2(p2.X, p2.Y), Color, 1.5f);
 		}
 	}
 }
@@ -316,8 +301,7 @@ void DrawVelocityArrow3D(const SDK::FVectorData& StartPos, const SDK::FVectorDat
 	float ArrowHeadLength,
 	float ArrowHeadWidth,
 	const ImU32 Color,
-	const SDK::FVectorData& CamLoc, const SDK::FRotatorData& CamRot, float FOV,
-	float ScreenWidth, float ScreenHeight)
+	const CameraProjection& Camera)
 {
 	ImDrawList* drawList = ImGui::GetForegroundDrawList();
 
@@ -333,8 +317,8 @@ void DrawVelocityArrow3D(const SDK::FVectorData& StartPos, const SDK::FVectorDat
 		StartPos.Z + velDirection.Z * ArrowLengthScale
 	};
 
-	auto screenStartOpt = WorldToScreen(StartPos, CamLoc, CamRot, FOV, ScreenWidth, ScreenHeight);
-	auto screenEndOpt = WorldToScreen(endPos, CamLoc, CamRot, FOV, ScreenWidth, ScreenHeight);
+	auto screenStartOpt = WorldToScreen(StartPos, Camera);
+	auto screenEndOpt = WorldToScreen(endPos, Camera);
 
 	ImVec2 screenStart = screenStartOpt ? std::get<0>(*screenStartOpt) : ImVec2(NAN, NAN);
 	ImVec2 screenEnd = screenEndOpt ? std::get<0>(*screenEndOpt) : ImVec2(NAN, NAN);
@@ -371,8 +355,8 @@ void DrawVelocityArrow3D(const SDK::FVectorData& StartPos, const SDK::FVectorDat
 		arrowBasePos.Z - perp1.Z * ArrowHeadWidth / 2.0f
 	};
 
-	auto screenHead1Opt = WorldToScreen(headPoint1_3D, CamLoc, CamRot, FOV, ScreenWidth, ScreenHeight);
-	auto screenHead2Opt = WorldToScreen(headPoint2_3D, CamLoc, CamRot, FOV, ScreenWidth, ScreenHeight);
+	auto screenHead1Opt = WorldToScreen(headPoint1_3D, Camera);
+	auto screenHead2Opt = WorldToScreen(headPoint2_3D, Camera);
 
 	ImVec2 screenHead1 = screenHead1Opt ? std::get<0>(*screenHead1Opt) : ImVec2(NAN, NAN);
 	ImVec2 screenHead2 = screenHead2Opt ? std::get<0>(*screenHead2Opt) : ImVec2(NAN, NAN);
@@ -392,30 +376,25 @@ void DrawVelocityArrow3D(const SDK::FVectorData& StartPos, const SDK::FVectorDat
 }
 
 void DrawBoostCircle(const SDK::FVectorData& CarLocation, float BoostAmount,
-	const SDK::FVectorData& CamLoc, const SDK::FRotatorData& CamRot, float FOV,
-	float ScreenWidth, float ScreenHeight, const ImU32 CircleColor,
-	const MemoryManager& pm, const SDK::APRI& CarPRI = SDK::APRI(0), bool useTeamColors = false)
+	const CameraProjection& Camera, const ImU32 CircleColor,
+	int32_t TeamIndex = -1, const SDK::FColorData& TeamColor = SDK::FColorData(), bool useTeamColors = false)
 {
 	ImDrawList* drawList = ImGui::GetForegroundDrawList();
 
-	auto carScreenPosOpt = WorldToScreen(CarLocation, CamLoc, CamRot, FOV, ScreenWidth, ScreenHeight);
+	auto carScreenPosOpt = WorldToScreen(CarLocation, Camera);
 	if (!carScreenPosOpt) return;
 
 	ImVec2 carScreenPos = std::get<0>(*carScreenPosOpt);
 	float carDepth = std::get<1>(*carScreenPosOpt);
 
 	if (carDepth <= 0.1f) return;
-	if (carScreenPos.x < -50 || carScreenPos.x > ScreenWidth + 50 ||
-		carScreenPos.y < -50 || carScreenPos.y > ScreenHeight + 50) {
+	if (carScreenPos.x < -50 || carScreenPos.x > Camera.GetScreenWidth() + 50 ||
+		carScreenPos.y < -50 || carScreenPos.y > Camera.GetScreenHeight() + 50) {
 		return;
 	}
 
-	const float fovRadians = FOV * UCONST_Pi / 180.0f;
-	const float tanHalfFov = tan(fovRadians / 2.0f);
-	const float projectionScale = (ScreenWidth / 2.0f) / tanHalfFov;
-
 	const float baseWorldRadius = 60.0f;
-	float radius = (baseWorldRadius * projectionScale) / carDepth;
+	float radius = Camera.ProjectRadius(baseWorldRadius, carDepth);
 
 	const float minRadius = 10.0f;
 	const float maxRadius = 40.0f;
@@ -423,44 +402,18 @@ void DrawBoostCircle(const SDK::FVectorData& CarLocation, float BoostAmount,
 
 	ImU32 finalCircleColor = CircleColor;
 
-	if (useTeamColors && CarPRI.IsValid()) {
-		SDK::ATeamInfo teamInfo = CarPRI.GetTeamInfo(pm);
-
-		static bool logged_team_debug = false;
-		if (!logged_team_debug) {
-			logged_team_debug = true;
-			Logger::Info("Team color debug: PRI valid: " + std::to_string(CarPRI.IsValid()) +
-				", TeamInfo valid: " + std::to_string(teamInfo.IsValid()));
+	if (useTeamColors && TeamIndex >= 0) {
+		ImU32 blueTeamColor = IM_COL32(0, 100, 255, 230);  // Blue team
+		ImU32 orangeTeamColor = IM_COL32(255, 128, 0, 230); // Orange team
 
-			if (teamInfo.IsValid()) {
-				SDK::FColorData teamColor = teamInfo.GetColor(pm);
-				int32_t teamIndex = teamInfo.GetIndex(pm);
-
-				Logger::Info("Team color values: Index=" + std::to_string(teamIndex) +
-					", R=" + std::to_string(teamColor.R) +
-					", G=" + std::to_string(teamColor.G) +
-					", B=" + std::to_string(teamColor.B));
-			}
+		if (TeamIndex == 0) { // Blue team
+			finalCircleColor = blueTeamColor;
 		}
-
-		if (teamInfo.IsValid()) {
-			int32_t teamIndex = teamInfo.GetIndex(pm);
-
-			ImU32 blueTeamColor = IM_COL32(0, 100, 255, 230);  // Blue team
-			ImU32 orangeTeamColor = IM_COL32(255, 128, 0, 230); // Orange team
-
-			if (teamIndex == 0) { // Blue team
-				finalCircleColor = blueTeamColor;
-			}
-			else if (teamIndex == 1) { // Orange team
-				finalCircleColor = orangeTeamColor;
-			}
-			else {
-				SDK::FColorData teamColor = teamInfo.GetColor(pm);
-				if (teamColor.R > 0 || teamColor.G > 0 || teamColor.B > 0) {
-					finalCircleColor = IM_COL32(teamColor.R, teamColor.G, teamColor.B, 230);
-				}
-			}
+		else if (TeamIndex == 1) { // Orange team
+			finalCircleColor = orangeTeamColor;
+		}
+		else if (TeamColor.R > 0 || TeamColor.G > 0 || TeamColor.B > 0) {
+			finalCircleColor = IM_COL32(TeamColor.R, TeamColor.G, TeamColor.B, 230);
 		}
 	}
 
@@ -517,8 +470,8 @@ void DrawBoostCircle(const SDK::FVectorData& CarLocation, float BoostAmount,
 			float textPosY = carScreenPos.y - textSize.y / 2;
 
 			if (!isnan(textPosX) && !isnan(textPosY) &&
-				textPosX > -1000 && textPosX < ScreenWidth + 1000 &&
-				textPosY > -1000 && textPosY < ScreenHeight + 1000) {
+				textPosX > -1000 && textPosX < Camera.GetScreenWidth() + 1000 &&
+				textPosY > -1000 && textPosY < Camera.GetScreenHeight() + 1000) {
 
 				drawList->AddText(
 					ImVec2(textPosX, textPosY),
@@ -574,6 +527,20 @@ std::unique_ptr<RLSDK> g_pRLSDK = nullptr;
 
 SDK::FieldState g_FieldState;
 
+const char* ARENA_SDF_FILENAME = "arena_soccar.vsdf";
+ArenaSDF g_ArenaSDF;
+BallPredictor g_BallPredictor;
+FrameWorker g_FrameWorker;
+PresentTimer g_PresentTimer;
+MatchRecorder g_MatchRecorder;
+
+std::string GetModuleDirectory();
+
+std::atomic<bool> g_BatchBenchmarkRunning = false;
+std::mutex g_BatchBenchmarkMutex;
+BallPredictor::BatchBenchmark g_LastBatchBenchmark;
+bool g_BatchBenchmarkValid = false;
+
 void SetupImGuiStyle()
 {
 	ImGuiStyle& style = ImGui::GetStyle();
@@ -906,6 +873,9 @@ unsigned __stdcall EjectThread(void* pArg) {
 			Logger::Info("EjectThread: Server thread stopped.");
 		}
 
+		g_FrameWorker.Stop();
+		g_MatchRecorder.Close();
+
 		if (g_pRLSDK) {
 			g_pRLSDK.reset();
 			Logger::Info("EjectThread: RLSDK instance reset.");
@@ -932,31 +902,175 @@ unsigned __stdcall EjectThread(void* pArg) {
 		Sleep(100);
 		Logger::Info("EjectThread: Calling FreeLibraryAndExitThread.");
 		g_ShutdownSignal = true;
+		// MainThread shuts the logger down on the signal. Neither it nor the logger's writer thread
+		// may still be running when the module is unmapped.
+		if (g_hMainThread != NULL) {
+			WaitForSingleObject(g_hMainThread, 5000);
+			CloseHandle(g_hMainThread);
+			g_hMainThread = NULL;
+		}
+		Logger::Shutdown(); // Does nothing if MainThread already did it
 		FreeLibraryAndExitThread(hModule, 0);
 	}
 	return 0;
 }
 
-std::string ConstructSettingsJSON() {
-	std::string json_str = "{";
-	std::string local_selected_bot_name;
+unsigned __stdcall BatchBenchmarkThread(void* pArg) {
+	BallPredictor::BatchBenchmark result = g_BallPredictor.BenchmarkBatch();
+	{
+		std::lock_guard<std::mutex> lock(g_BatchBenchmarkMutex);
+		g_LastBatchBenchmark = result;
+		g_BatchBenchmarkValid = true;
+	}
+
+	char summary[256];
+	snprintf(summary, sizeof(summary), "BallPredictor: Batch benchmark (%d x %d steps): scalar %.0f traj/s, SIMD %s%.0f traj/s",
+		result.Count, result.Steps, result.ScalarTrajectoriesPerSecond,
+		result.SimdAvailable ? "" : "(unavailable) ", result.SimdTrajectoriesPerSecond);
+	Logger::Info(summary);
 
+	g_BatchBenchmarkRunning = false;
+	return 0;
+}
+
+std::string ConstructSettingsJSON() {
+	Bridge::ClientSettings settings;
 	{
 		std::lock_guard<std::mutex> lock(g_SettingsMutex);
-		local_selected_bot_name = g_SelectedBotNameForClient;
+		settings.SelectedBot = g_SelectedBotNameForClient;
+	}
+
+	settings.BotEnabled = g_BotEnabledForClient.load();
+	settings.AutoBallCam = g_AutoBallCamForClient.load();
+	settings.SpeedflipKickoff = g_SpeedflipKickoffForClient.load();
+	settings.Debug = g_ShowDebugDrawingInfo;
+	settings.Monitoring = g_PythonMonitoringForClient.load();
+	settings.Clock = g_ClockEnabledForClient.load();
+	settings.BallPredictionStream = g_StreamBallPredictionForClient.load();
+	return Bridge::EncodeSettings(settings);
+}
+
+bool SendToClient(const std::string& payload) {
+	size_t sent = 0;
+	while (sent < payload.length()) {
+		int result = ::send(g_ClientSocket, payload.c_str() + sent, (int)(payload.length() - sent), 0);
+		if (result == SOCKET_ERROR) {
+			Logger::Error("ServerThread: Send failed with error: " + std::to_string(WSAGetLastError()));
+			return false;
+		}
+		sent += static_cast<size_t>(result);
+	}
+
+	g_PacketsSentToClient++;
+	g_BytesSentToClient += static_cast<uint64_t>(payload.length());
+	g_LastPacketSentTime = std::chrono::steady_clock::now();
+	g_LastPacketSentTimeValid = true;
+	return true;
+}
+
+bool HandleClientMessage(const std::string& line) {
+	nlohmann::json message = nlohmann::json::parse(line, nullptr, false);
+	if (message.is_discarded() || !message.is_object() || !message.contains("type") || !message["type"].is_string()) {
+		Logger::Warning("ServerThread: Ignoring malformed client message (" + std::to_string(line.length()) + " bytes).");
+		return true;
+	}
+
+	const std::string type = message["type"].get<std::string>();
+	const int64_t id = (message.contains("id") && message["id"].is_number_integer()) ? message["id"].get<int64_t>() : 0;
+
+	if (type == Bridge::MessageType::PredictBatch) {
+		std::string error;
+		auto request = Bridge::ParsePredictBatchRequest(message, error);
+		if (!request) {
+			return SendToClient(Bridge::EncodeError(id, type, error));
+		}
+
+		static BallPredictor::BatchResult batchResult;
+		g_BallPredictor.PredictBatch(request->States, request->Steps, batchResult);
+		return SendToClient(Bridge::EncodePredictBatchResult(request->Id, request->Stride, batchResult));
+	}
+
+	return SendToClient(Bridge::EncodeError(id, type, "unknown message type"));
+}
+
+// Sends a fresh prediction whenever the ball has advanced to a new physics frame.
+// Returns false only when the send fails.
+bool PublishBallPrediction(Bridge::BallPredictionStream& stream, std::string& message) {
+	ReadScope readScope(ReadCategory::Bridge);
+	if (!g_StreamBallPredictionForClient.load(std::memory_order_relaxed) || !g_pRLSDK) return true;
+
+	SDK::AGameEvent ge = g_pRLSDK->GetCurrentGameEvent();
+	if (!ge.IsValid()) {
+		stream.Reset();
+		return true;
+	}
+
+	MemoryManager& mem = g_pRLSDK->GetMemoryManager();
+	auto balls = ge.GetBalls(mem);
+	if (balls.empty() || !balls[0].IsValid()) {
+		stream.Reset();
+		return true;
+	}
+
+	SDK::FVectorData loc = balls[0].GetLocation(mem);
+	SDK::FVectorData vel = balls[0].GetVelocity(mem);
+	SDK::FVectorData angVel = balls[0].GetAngularVelocity(mem);
+
+	BallPredictor::BallState state;
+	state.Location = { loc.X, loc.Y, loc.Z };
+	state.Velocity = { vel.X, vel.Y, vel.Z };
+	state.AngularVelocity = { angVel.X, angVel.Y, angVel.Z };
+
+	if (!stream.Update(state, g_BallPredictor, message)) {
+		return true;
 	}
+	return SendToClient(message);
+}
+
+// Drains whatever the client has sent without blocking. Returns false when the connection is gone.
+bool PollClientMessages(std::string& buffer) {
+	while (true) {
+		fd_set readSet;
+		FD_ZERO(&readSet);
+		FD_SET(g_ClientSocket, &readSet);
+		timeval timeout = { 0, 0 };
+
+		int ready = select(0, &readSet, nullptr, nullptr, &timeout);
+		if (ready == SOCKET_ERROR) {
+			Logger::Error("ServerThread: select failed: " + std::to_string(WSAGetLastError()));
+			return false;
+		}
+		if (ready == 0) break;
+
+		char chunk[4096];
+		int received = recv(g_ClientSocket, chunk, sizeof(chunk), 0);
+		if (received == 0) {
+			Logger::Info("ServerThread: Client closed the connection.");
+			return false;
+		}
+		if (received == SOCKET_ERROR) {
+			Logger::Error("ServerThread: recv failed: " + std::to_string(WSAGetLastError()));
+			return false;
+		}
+		buffer.append(chunk, static_cast<size_t>(received));
 
-	json_str += "\"bot_enabled\":" + std::string(g_BotEnabledForClient.load() ? "true" : "false") + ",";
-	json_str += "\"auto_ball_cam\":" + std::string(g_AutoBallCamForClient.load() ? "true" : "false") + ",";
-	json_str += "\"speedflip_kickoff_enabled\":" + std::string(g_SpeedflipKickoffForClient.load() ? "true" : "false") + ",";
-	json_str += "\"debug\":" + std::string(g_ShowDebugDrawingInfo ? "true" : "false") + ",";
-	json_str += "\"monitoring\":" + std::string(g_PythonMonitoringForClient.load() ? "true" : "false") + ",";
-	json_str += "\"selected_bot\":\"" + local_selected_bot_name + "\",";
-	json_str += "\"nexto_beta\":1.0,";
-	json_str += "\"clock\":" + std::string(g_ClockEnabledForClient.load() ? "true" : "false");
+		if (buffer.length() > Bridge::MaxClientMessageBytes) {
+			Logger::Error("ServerThread: Client message exceeds " + std::to_string(Bridge::MaxClientMessageBytes) + " bytes. Disconnecting client.");
+			return false;
+		}
+	}
 
-	json_str += "}\n";
-	return json_str;
+	size_t lineStart = 0;
+	size_t lineEnd;
+	while ((lineEnd = buffer.find('\n', lineStart)) != std::string::npos) {
+		std::string line = buffer.substr(lineStart, lineEnd - lineStart);
+		lineStart = lineEnd + 1;
+		if (!line.empty() && line.back() == '\r') line.pop_back();
+		if (line.empty()) continue;
+		if (!HandleClientMessage(line)) return false;
+	}
+	buffer.erase(0, lineStart);
+	return true;
 }
 
 unsigned __stdcall ServerMainLoopThread(void* pArg) {
@@ -1068,6 +1182,9 @@ unsigned __stdcall ServerMainLoopThread(void* pArg) {
 					}
 					g_LastPacketSentTime = std::chrono::steady_clock::now();
 					g_LastPacketSentTimeValid = false;
+					std::string clientReceiveBuffer;
+					Bridge::BallPredictionStream predictionStream;
+					std::string predictionMessage;
 
 					while (g_ClientConnected && g_ServerThreadActive) {
 						bool settings_changed_flag = false;
@@ -1088,22 +1205,22 @@ unsigned __stdcall ServerMainLoopThread(void* pArg) {
 
 						if (should_send_settings) {
 							std::string json_payload = ConstructSettingsJSON();
-							int sendResult = ::send(g_ClientSocket, json_payload.c_str(), (int)json_payload.length(), 0);
-							if (sendResult == SOCKET_ERROR) {
-								Logger::Error("ServerThread: Send failed with error: " + std::to_string(WSAGetLastError()));
+							if (!SendToClient(json_payload)) {
 								g_ClientConnected = false;
 							}
 							else {
-								g_PacketsSentToClient++;
-								g_BytesSentToClient += static_cast<uint64_t>(json_payload.length());
-								g_LastPacketSentTime = std::chrono::steady_clock::now();
-								g_LastPacketSentTimeValid = true;
-								{
-									std::lock_guard<std::mutex> lock(g_SettingsMutex);
-									g_SettingsChangedForClient = false;
-								}
+								std::lock_guard<std::mutex> lock(g_SettingsMutex);
+								g_SettingsChangedForClient = false;
 							}
 						}
+
+						if (g_ClientConnected && !PollClientMessages(clientReceiveBuffer)) {
+							g_ClientConnected = false;
+						}
+
+						if (g_ClientConnected && !PublishBallPrediction(predictionStream, predictionMessage)) {
+							g_ClientConnected = false;
+						}
 						Sleep(8);
 					}
 
@@ -1172,21 +1289,436 @@ unsigned __stdcall ServerMainLoopThread(void* pArg) {
 	return 0;
 }
 
-void ClampBallVelocity(SDK::FVectorData& vel, float maxSpeed)
+inline float MaxF(float a, float b) { return (a > b) ? a : b; }
+inline float MinF(float a, float b) { return (a < b) ? a : b; }
+
+// Draws the ESP layers from an already captured frame. No game memory is touched here.
+// Layers are ordered by importance; once the Present budget is spent the rest are skipped.
+void DrawOverlayFrame(const FrameModel& frame)
 {
-	float speedSq = vel.X * vel.X + vel.Y * vel.Y + vel.Z * vel.Z;
-	if (speedSq > maxSpeed * maxSpeed)
+	ImVec2 screenSize = ImGui::GetIO().DisplaySize;
+	if (screenSize.x <= 0 || screenSize.y <= 0) {
+		return;
+	}
+
+	auto budgetLeft = [&]() {
+		if (!g_PresentTimer.OverBudget()) return true;
+		g_PresentTimer.NoteSkippedLayer();
+		return false;
+	};
+
+	const CameraProjection camera(ToVec3(frame.CameraLocation), frame.CameraRotation.Pitch, frame.CameraRotation.Yaw, frame.CameraRotation.Roll,
+		frame.CameraFOV, screenSize.x, screenSize.y);
+
+	const SDK::FVectorData ballLoc = { frame.Ball.Location.X, frame.Ball.Location.Y, frame.Ball.Location.Z };
+	const SDK::FVectorData ballVel = { frame.Ball.Velocity.X, frame.Ball.Velocity.Y, frame.Ball.Velocity.Z };
+	const FrameModel::CarInfo* localCar = frame.GetLocalCar();
+
+	auto ballScreenPosOpt = WorldToScreen(ballLoc, camera);
+
+	ImVec2 ballScreenPos = ImVec2(NAN, NAN);
+	float ballTransformedZ = -1.0f;
+	bool ballOnScreen = false;
+
+	if (ballScreenPosOpt) {
+		std::tie(ballScreenPos, ballTransformedZ) = *ballScreenPosOpt;
+		ballOnScreen = ballScreenPos.x >= 0 && ballScreenPos.x <= screenSize.x &&
+			ballScreenPos.y >= 0 && ballScreenPos.y <= screenSize.y;
+	}
+
+	const float ballRadiusWorld = 91.25f;
+	const int sphereSegments = 24;
+	ImDrawList* drawList = ImGui::GetForegroundDrawList();
+
+	if (g_Draw3DSphere) {
+		DrawSphereWorld(ballLoc, ballRadiusWorld, sphereSegments, ImGui::ColorConvertFloat4ToU32(g_ColorBallSphere3D), camera);
+	}
+	else if (g_DrawBallCircle && ballScreenPosOpt && ballOnScreen)
 	{
-		float speed = std::sqrt(speedSq);
-		float scale = maxSpeed / speed;
-		vel.X *= scale;
-		vel.Y *= scale;
-		vel.Z *= scale;
+		float dynamicRadius = camera.ProjectRadius(ballRadiusWorld, ballTransformedZ);
+
+		const float minRadius = 2.0f;
+		const float maxRadius = screenSize.y;
+		dynamicRadius = (std::max)(minRadius, (std::min)(dynamicRadius, maxRadius));
+
+		drawList->AddCircle(ballScreenPos, dynamicRadius, ImGui::ColorConvertFloat4ToU32(g_ColorBallCircle2D), 16, 2.0f);
 	}
-}
 
-inline float MaxF(float a, float b) { return (a > b) ? a : b; }
-inline float MinF(float a, float b) { return (a < b) ? a : b; }
+	if (g_DrawBallPrediction && !frame.Prediction.empty() && budgetLeft()) {
+		const std::vector<BallPredictor::Slice>& predictionSlices = frame.Prediction;
+		static std::vector<CameraProjection::ScreenPoint> predictionScreenPoints;
+
+		predictionScreenPoints.resize(predictionSlices.size());
+		camera.ProjectBatch(&predictionSlices[0].State.Location, sizeof(BallPredictor::Slice),
+			predictionSlices.size(), predictionScreenPoints.data());
+
+		bool hasLastValidPos = false;
+		ImVec2 lastValidScreenPos;
+		int lastDrawnCollisionType = 0;
+
+		for (size_t sliceIndex = 0; sliceIndex < predictionSlices.size(); ++sliceIndex) {
+			const BallPredictor::Slice& slice = predictionSlices[sliceIndex];
+			const CameraProjection::ScreenPoint& screenPoint = predictionScreenPoints[sliceIndex];
+			const Vec3& currentVel = slice.State.Velocity;
+
+			if (screenPoint.InFront()) {
+				ImVec2 currentScreenPos = ImVec2(screenPoint.X, screenPoint.Y);
+				bool currentPosValid = screenPoint.OnScreen();
+
+				if (hasLastValidPos && currentPosValid) {
+					float speed = MathUtils::Length(currentVel);
+					float speedRatio = MinF(1.0f, speed / 2000.0f);
+
+					float t = static_cast<float>(slice.Step) / BallPredictor::MaxSteps;
+					int r, g, b, a;
+
+					if (slice.InGoal) {
+						r = 255; g = 20; b = 20; a = 220;
+					}
+					else {
+						r = 0;
+						g = static_cast<int>((255 - speedRatio * 100) * (1.0f - t));
+						b = static_cast<int>(128 + (255 - 128) * t + speedRatio * 100);
+						a = static_cast<int>(220 + (50 - 220) * t);
+					}
+
+					float thickness = 2.0f + speedRatio * 2.0f;
+
+					int collisionType = static_cast<int>(slice.Contact);
+					if (collisionType != 0 && collisionType != lastDrawnCollisionType) {
+						ImU32 collisionColor;
+						switch (slice.Contact) {
+							case BallPredictor::ContactType::Floor: collisionColor = IM_COL32(255, 165, 0, 220); break;
+							case BallPredictor::ContactType::Ceiling: collisionColor = IM_COL32(255, 100, 100, 220); break;
+							case BallPredictor::ContactType::Wall: collisionColor = IM_COL32(100, 255, 100, 220); break;
+							default: collisionColor = IM_COL32(255, 255, 255, 220);
+						}
+						drawList->AddCircle(currentScreenPos, 3.0f, collisionColor, 8, 1.5f);
+						lastDrawnCollisionType = collisionType;
+					}
+					drawList->AddLine(lastValidScreenPos, currentScreenPos, IM_COL32(r, g, b, a), thickness);
+				}
+
+				if (currentPosValid) {
+					lastValidScreenPos = currentScreenPos;
+					hasLastValidPos = true;
+				}
+				else {
+					hasLastValidPos = false;
+				}
+			}
+			else {
+				hasLastValidPos = false;
+			}
+		}
+	}
+
+	if (show && g_ShowDebugDrawingInfo) {
+		ImGui::Separator();
+		ImGui::Text("Camera Info (Live):");
+		ImGui::Text("  Location: X=%.1f, Y=%.1f, Z=%.1f", frame.CameraLocation.X, frame.CameraLocation.Y, frame.CameraLocation.Z);
+		ImGui::Text("  Rotation: P=%d, Y=%d, R=%d", frame.CameraRotation.Pitch, frame.CameraRotation.Yaw, frame.CameraRotation.Roll);
+		ImGui::Text("  FOV (from PRI Settings): %.1f", frame.CameraFOV);
+
+		if (ballScreenPosOpt && ballOnScreen) {
+			ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f),
+				"Ball screen pos: (%.1f, %.1f) Depth: %.1f Transformed.Z: %.1f",
+				ballScreenPos.x, ballScreenPos.y, ballTransformedZ, ballTransformedZ);
+		}
+		else if (ballScreenPosOpt) {
+			ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f),
+				"Ball off screen: (%.1f, %.1f) Depth: %.1f Transformed.Z: %.1f",
+				ballScreenPos.x, ballScreenPos.y, ballTransformedZ, ballTransformedZ);
+		}
+		else {
+			ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f),
+				"Ball projection failed (Behind camera?) Transformed.Z: %.1f", ballTransformedZ);
+		}
+	}
+
+	if (g_DrawCarHitboxes && budgetLeft()) {
+		const SDK::FVectorData octaneHalfExtents = { 118.0f / 2.0f, 84.2f / 2.0f, 36.16f / 2.0f };
+		const ImU32 hitboxColor = ImGui::ColorConvertFloat4ToU32(g_ColorCarHitbox);
+
+		for (const auto& car : frame.Cars) {
+			DrawWireframeBox(car.Location, car.Rotation, octaneHalfExtents, hitboxColor, camera);
+		}
+	}
+
+	if (g_DrawBoostPadTimers && budgetLeft()) {
+		for (const auto& timer : frame.PadTimers) {
+			SDK::FVectorData padLocation = timer.Location;
+			padLocation.Z += 100.0f;
+
+			auto screenPosOpt = WorldToScreen(padLocation, camera);
+
+			if (screenPosOpt) {
+				ImVec2 screenPos = std::get<0>(*screenPosOpt);
+
+				if (screenPos.x >= 0 && screenPos.x <= screenSize.x &&
+					screenPos.y >= 0 && screenPos.y <= screenSize.y) {
+
+				char timerText[16];
+				snprintf(timerText, sizeof(timerText), "%.1f", timer.RemainingSeconds);
+				
+				ImU32 textColor = timer.IsBigPad ? 
+					IM_COL32(255, 215, 0, 255) : 
+					IM_COL32(255, 255, 255, 255);
+				
+				float fontSize = 18.0f;
+				ImFont* font = ImGui::GetFont();
+				ImVec2 textSize = font->CalcTextSizeA(fontSize, FLT_MAX, 0.0f, timerText);
+				
+				ImGui::GetForegroundDrawList()->AddRectFilled(
+					ImVec2(screenPos.x - textSize.x/2 - 5, screenPos.y - textSize.y/2 - 3),
+					ImVec2(screenPos.x + textSize.x/2 + 5, screenPos.y + textSize.y/2 + 3),
+					IM_COL32(0, 0, 0, 200)
+				);
+				
+				ImU32 outlineColor = timer.IsBigPad ? 
+					IM_COL32(255, 215, 0, 150) :
+					IM_COL32(200, 200, 200, 150);
+				
+				ImGui::GetForegroundDrawList()->AddRect(
+					ImVec2(screenPos.x - textSize.x/2 - 5, screenPos.y - textSize.y/2 - 3),
+					ImVec2(screenPos.x + textSize.x/2 + 5, screenPos.y + textSize.y/2 + 3),
+					outlineColor, 0.0f, 0, 1.5f
+				);
+				
+				ImU32 glowColor = timer.IsBigPad ? 
+					IM_COL32(255, 215, 0, 80) :
+					IM_COL32(200, 200, 200, 80); 
+					
+				for (int i = 0; i < 4; i++) {
+					float offset = 1.0f + i * 0.5f;
+					ImGui::GetForegroundDrawList()->AddText(
+						font,
+						fontSize,
+						ImVec2(screenPos.x - textSize.x/2 - offset, screenPos.y - textSize.y/2),
+						glowColor,
+						timerText
+					);
+					ImGui::GetForegroundDrawList()->AddText(
+						font,
+						fontSize,
+						ImVec2(screenPos.x - textSize.x/2 + offset, screenPos.y - textSize.y/2),
+						glowColor,
+						timerText
+					);
+					ImGui::GetForegroundDrawList()->AddText(
+						font,
+						fontSize,
+						ImVec2(screenPos.x - textSize.x/2, screenPos.y - textSize.y/2 - offset),
+						glowColor,
+						timerText
+					);
+					ImGui::GetForegroundDrawList()->AddText(
+						font,
+						fontSize,
+						ImVec2(screenPos.x - textSize.x/2, screenPos.y - textSize.y/2 + offset),
+						glowColor,
+						timerText
+					);
+				}
+				
+				ImGui::GetForegroundDrawList()->AddText(
+					font,
+					fontSize,
+					ImVec2(screenPos.x - textSize.x/2, screenPos.y - textSize.y/2),
+					textColor, 
+					timerText
+				);
+				}
+			}
+		}
+	}
+
+	if (g_DrawTracers && localCar && budgetLeft()) {
+		const ImU32 defaultTracersColor = ImGui::ColorConvertFloat4ToU32(g_ColorTracers);
+		float tracerThickness = 2.7f;
+
+		ImVec2 tracerStartPointScreenActual = ImVec2(NAN, NAN);
+
+		std::optional<std::tuple<ImVec2, float>> localCarScreenOpt = WorldToScreen(localCar->Location, camera);
+		if (localCarScreenOpt.has_value()) {
+			tracerStartPointScreenActual = std::get<0>(localCarScreenOpt.value());
+			if (tracerStartPointScreenActual.x < 0 || tracerStartPointScreenActual.x > screenSize.x ||
+				tracerStartPointScreenActual.y < 0 || tracerStartPointScreenActual.y > screenSize.y) {
+				tracerStartPointScreenActual = ImVec2(NAN, NAN);
+			}
+		}
+
+		if (!isnan(tracerStartPointScreenActual.x) && !isnan(tracerStartPointScreenActual.y)) {
+			ImVec2 clipMin = ImVec2(0.0f, 0.0f);
+			ImVec2 clipMax = ImVec2(screenSize.x, screenSize.y);
+
+			for (const auto& opponentCar : frame.Cars) {
+				if (&opponentCar == localCar) continue;
+
+				ImU32 currentTracerColor = defaultTracersColor;
+				if (g_UseTeamColorsForTracers) {
+					if (opponentCar.TeamIndex == 0) { currentTracerColor = blueTeamColor; }
+					else if (opponentCar.TeamIndex == 1) { currentTracerColor = orangeTeamColor; }
+				}
+
+				ImVec2 p1_for_clip;
+
+				std::optional<std::tuple<ImVec2, float>> opponentScreenPosOpt = WorldToScreen(opponentCar.Location, camera);
+
+				if (opponentScreenPosOpt.has_value()) {
+					p1_for_clip = std::get<0>(opponentScreenPosOpt.value());
+				}
+				else {
+					float screen_space_dir_x, screen_space_dir_y;
+					camera.ScreenDirection(ToVec3(opponentCar.Location), screen_space_dir_x, screen_space_dir_y);
+
+					float len_sq = screen_space_dir_x * screen_space_dir_x + screen_space_dir_y * screen_space_dir_y;
+					if (len_sq < 0.0001f) {
+						screen_space_dir_x = 0.0f;
+						screen_space_dir_y = -1.0f;
+					}
+					else {
+						float len = sqrt(len_sq);
+						screen_space_dir_x /= len;
+						screen_space_dir_y /= len;
+					}
+
+					float far_distance = screenSize.x + screenSize.y;
+					p1_for_clip.x = tracerStartPointScreenActual.x + screen_space_dir_x * far_distance;
+					p1_for_clip.y = tracerStartPointScreenActual.y - screen_space_dir_y * far_distance;
+				}
+
+				ImVec2 p0_clipped = tracerStartPointScreenActual;
+				ImVec2 p1_clipped = p1_for_clip;
+
+				if (ClipLineSegment(p0_clipped, p1_clipped, clipMin, clipMax)) {
+					bool start_is_still_at_local_car_on_screen = (
+						fabs(p0_clipped.x - tracerStartPointScreenActual.x) < 1.0f &&
+						fabs(p0_clipped.y - tracerStartPointScreenActual.y) < 1.0f
+						);
+
+					if (start_is_still_at_local_car_on_screen) {
+						drawList->AddLine(p0_clipped, p1_clipped, currentTracerColor, tracerThickness);
+					}
+				}
+			}
+		}
+	}
+
+	if (g_DrawPlayerDistanceText && localCar && budgetLeft()) {
+		const ImU32 textColor = ImGui::ColorConvertFloat4ToU32(g_ColorPlayerDistanceText);
+		ImVec2 clipMin = ImVec2(0.0f, 0.0f);
+		ImVec2 clipMax = ImVec2(screenSize.x, screenSize.y);
+
+		char distBuffer[64];
+
+		for (const auto& opponentCar : frame.Cars) {
+			if (&opponentCar == localCar) continue;
+
+			SDK::FVectorData deltaVec = VectorSubtract(opponentCar.Location, localCar->Location);
+			float distanceUU = VectorSize(deltaVec);
+			float distanceMeters = distanceUU / 100.0f;
+
+			snprintf(distBuffer, sizeof(distBuffer), "%.1fm", distanceMeters);
+			ImVec2 textSize = ImGui::CalcTextSize(distBuffer);
+
+			ImVec2 textScreenPos = ImVec2(NAN, NAN);
+			bool targetIsOnScreen = false;
+
+			SDK::FVectorData opponentTextAnchorWorld = opponentCar.Location;
+			opponentTextAnchorWorld.Z += 50.0f;
+
+			std::optional<std::tuple<ImVec2, float>> opponentScreenPosOpt = WorldToScreen(opponentTextAnchorWorld, camera);
+
+			if (opponentScreenPosOpt.has_value()) {
+				ImVec2 rawScreenPos = std::get<0>(opponentScreenPosOpt.value());
+				if (rawScreenPos.x >= clipMin.x && rawScreenPos.x <= clipMax.x &&
+					rawScreenPos.y >= clipMin.y && rawScreenPos.y <= clipMax.y) {
+					textScreenPos = ImVec2(rawScreenPos.x - textSize.x, rawScreenPos.y - textSize.y);
+					targetIsOnScreen = true;
+				}
+				else {
+					textScreenPos = rawScreenPos;
+				}
+			}
+
+			if (!targetIsOnScreen) {
+				float screen_space_dir_x, screen_space_dir_y;
+				camera.ScreenDirection(ToVec3(opponentCar.Location), screen_space_dir_x, screen_space_dir_y);
+
+				float len_sq = screen_space_dir_x * screen_space_dir_x + screen_space_dir_y * screen_space_dir_y;
+				if (len_sq < 0.0001f) {
+					screen_space_dir_x = 0.0f; screen_space_dir_y = -1.0f;
+				}
+				else {
+					float len = sqrt(len_sq);
+					screen_space_dir_x /= len; screen_space_dir_y /= len;
+				}
+
+				ImVec2 offscreen_origin = ImVec2(screenSize.x / 2.0f, screenSize.y / 2.0f);
+				float far_distance = (screenSize.x + screenSize.y) / 2.0f;
+
+				ImVec2 p1_offscreen_indicator_end;
+				p1_offscreen_indicator_end.x = offscreen_origin.x + screen_space_dir_x * far_distance;
+				p1_offscreen_indicator_end.y = offscreen_origin.y - screen_space_dir_y * far_distance;
+
+				ImVec2 p0_clipped = offscreen_origin;
+				ImVec2 p1_clipped = p1_offscreen_indicator_end;
+
+				if (ClipLineSegment(p0_clipped, p1_clipped, clipMin, clipMax)) {
+					ImVec2 edgePoint = p1_clipped;
+					float padding = 5.0f;
+
+					textScreenPos.x = edgePoint.x - textSize.x / 2.0f;
+					textScreenPos.y = edgePoint.y - textSize.y / 2.0f;
+
+					if (edgePoint.x <= clipMin.x + padding * 2) textScreenPos.x = clipMin.x + padding;
+					else if (edgePoint.x >= clipMax.x - padding * 2) textScreenPos.x = clipMax.x - textSize.x - padding;
+
+					if (edgePoint.y <= clipMin.y + padding * 2) textScreenPos.y = clipMin.y + padding;
+					else if (edgePoint.y >= clipMax.y - padding * 2) textScreenPos.y = clipMax.y - textSize.y - padding;
+				}
+				else {
+					textScreenPos = ImVec2(NAN, NAN);
+				}
+			}
+
+			if (!isnan(textScreenPos.x) && !isnan(textScreenPos.y)) {
+				textScreenPos.x = (std::max)(clipMin.x, (std::min)(textScreenPos.x, clipMax.x - textSize.x));
+				textScreenPos.y = (std::max)(clipMin.y, (std::min)(textScreenPos.y, clipMax.y - textSize.y));
+				drawList->AddText(textScreenPos, textColor, distBuffer);
+			}
+		}
+	}
+
+	if (g_DrawOpponentBoost && budgetLeft()) {
+		const ImU32 boostCircleColor = ImGui::ColorConvertFloat4ToU32(g_ColorBoostCircle);
+
+		for (const auto& car : frame.Cars) {
+			if (&car == localCar || !car.HasBoost) continue;
+
+			SDK::FVectorData carLocation = car.Location;
+			carLocation.Z += 120.0f;
+
+			DrawBoostCircle(carLocation, car.BoostAmount, camera, boostCircleColor, car.TeamIndex, car.TeamColor, g_UseTeamColorsForBoost);
+		}
+	}
+
+	if (g_DrawVelocityPointers && budgetLeft()) {
+		const float arrowScale = 150.0f;
+		const float arrowHeadLength = 20.0f;
+		const float arrowHeadWidth = 10.0f;
+		const ImU32 ballArrowColor = ImGui::ColorConvertFloat4ToU32(g_ColorVelocityArrowBall);
+		const ImU32 carArrowColor = ImGui::ColorConvertFloat4ToU32(g_ColorVelocityArrowCar);
+
+		DrawVelocityArrow3D(ballLoc, ballVel, arrowScale, arrowHeadLength, arrowHeadWidth, ballArrowColor, camera);
+
+		for (const auto& car : frame.Cars) {
+			if (&car == localCar) continue;
+			DrawVelocityArrow3D(car.Location, car.Velocity, arrowScale, arrowHeadLength, arrowHeadWidth, carArrowColor, camera);
+		}
+	}
+}
 
 HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT Flags)
 {
@@ -1254,6 +1786,8 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 		}
 	}
 
+	g_PresentTimer.Begin();
+
 	if (GetAsyncKeyState(VK_INSERT) & 1) {
 		show = !show;
 	}
@@ -1343,821 +1877,18 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 		}
 	}
 
-	if ((g_DrawBallCircle || g_Draw3DSphere || g_DrawBallPrediction || g_AlwaysDrawBallCircle || g_DrawCarHitboxes || g_DrawVelocityPointers || g_DrawOpponentBoost || g_DrawTracers || g_DrawPlayerDistanceText || g_DrawBoostPadTimers)
-		&& g_SdkAndHooksInitialized.load() && g_pRLSDK)
-	{
-		SDK::AGameEvent ge = g_pRLSDK->GetCurrentGameEvent();
-		if (ge.IsValid()) {
-			try {
-				auto currentTime = std::chrono::steady_clock::now();
-				std::chrono::duration<float> elapsedSinceLastCheck = currentTime - g_LastGameEventValidityCheck;
-				bool shouldRecheckValidity = elapsedSinceLastCheck.count() >= GAME_EVENT_VALIDITY_CHECK_INTERVAL;
-
-				if (shouldRecheckValidity) {
-					g_LastGameEventValidityCheck = currentTime;
-					g_pRLSDK->UpdateCurrentGameEvent(ge.Address);
-					ge = g_pRLSDK->GetCurrentGameEvent();
-				}
-
-				auto balls = ge.GetBalls(g_pRLSDK->GetMemoryManager());
-				if (balls.empty() || !balls[0].IsValid()) {
-					throw std::runtime_error("Ball not found or invalid");
-				}
-				SDK::ABall ball = balls[0];
-				SDK::FVectorData ballLoc = ball.GetLocation(g_pRLSDK->GetMemoryManager());
-				SDK::FVectorData ballVel = ball.GetVelocity(g_pRLSDK->GetMemoryManager());
-				SDK::FVectorData ballAngVel = ball.GetAngularVelocity(g_pRLSDK->GetMemoryManager());
-
-				auto localPlayers = ge.GetLocalPlayers(g_pRLSDK->GetMemoryManager());
-				if (localPlayers.empty() || !localPlayers[0].IsValid()) {
-					throw std::runtime_error("Local player controller not found or invalid");
-				}
-				SDK::APlayerController pc = localPlayers[0];
-
-				SDK::ACamera playerCamera = pc.GetPlayerCamera(g_pRLSDK->GetMemoryManager());
-				if (!playerCamera.IsValid()) {
-					throw std::runtime_error("PlayerCamera actor not found or invalid");
-				}
-
-				SDK::APRI pri = pc.GetPRI(g_pRLSDK->GetMemoryManager());
-				SDK::FProfileCameraSettings camSettings;
-				
-				if (pri.IsValid()) {
-					auto settingsOpt = pri.GetCameraSettings(g_pRLSDK->GetMemoryManager());
-					if (settingsOpt) {
-						camSettings = *settingsOpt;
-					} else {
-						camSettings.FOV = 90.0f;
-						camSettings.Height = 100.0f;
-						camSettings.Pitch = -3.0f;
-						camSettings.Distance = 270.0f;
-						camSettings.Stiffness = 0.5f;
-						camSettings.SwivelSpeed = 2.5f;
-						camSettings.TransitionSpeed = 1.0f;
-					}
-				} else {
-					camSettings.FOV = 90.0f;
-					camSettings.Height = 100.0f;
-					camSettings.Pitch = -3.0f;
-					camSettings.Distance = 270.0f;
-					camSettings.Stiffness = 0.5f;
-					camSettings.SwivelSpeed = 2.5f;
-					camSettings.TransitionSpeed = 1.0f;
-				}
-
-				SDK::FVectorData camLocation = playerCamera.GetLocation(g_pRLSDK->GetMemoryManager());
-				SDK::FRotatorData camRotation = playerCamera.GetRotation(g_pRLSDK->GetMemoryManager());
-
-				ImVec2 screenSize = ImGui::GetIO().DisplaySize;
-				if (screenSize.x <= 0 || screenSize.y <= 0) {
-					throw std::runtime_error("Invalid screen size");
-				}
-
-				auto ballScreenPosOpt = WorldToScreen(
-					ballLoc, camLocation, camRotation, camSettings.FOV,
-					screenSize.x, screenSize.y
-				);
-
-				ImVec2 ballScreenPos = ImVec2(NAN, NAN);
-				float ballTransformedZ = -1.0f;
-				bool ballOnScreen = false;
-
-				if (ballScreenPosOpt) {
-					std::tie(ballScreenPos, ballTransformedZ) = *ballScreenPosOpt;
-					ballOnScreen = ballScreenPos.x >= 0 && ballScreenPos.x <= screenSize.x &&
-						ballScreenPos.y >= 0 && ballScreenPos.y <= screenSize.y;
-				}
-
-				const float ballRadiusWorld = 91.25f;
-				const float circleRadiusScreen = 20.0f;
-				const int sphereSegments = 24;
-				const ImU32 color = IM_COL32(255, 255, 0, 255);
-				ImDrawList* drawList = ImGui::GetForegroundDrawList();
-
-				if (g_Draw3DSphere) {
-					DrawSphereWorld(ballLoc, ballRadiusWorld, sphereSegments, ImGui::ColorConvertFloat4ToU32(g_ColorBallSphere3D),
-						camLocation, camRotation, camSettings.FOV, 
-						screenSize.x, screenSize.y);
-				}
-				else if (g_DrawBallCircle && ballScreenPosOpt && ballOnScreen)
-				{
-					const float fovRadians = camSettings.FOV * UCONST_Pi / 180.0f; 
-					const float tanHalfFov = tan(fovRadians / 2.0f);
-					const float projectionScale = (screenSize.x / 2.0f) / tanHalfFov;
-
-					float dynamicRadius = 0.0f;
-					if (ballTransformedZ > 0.1f) {
-						dynamicRadius = (ballRadiusWorld * projectionScale) / ballTransformedZ;
-					}
-
-					const float minRadius = 2.0f;
-					const float maxRadius = screenSize.y;
-					dynamicRadius = (std::max)(minRadius, (std::min)(dynamicRadius, maxRadius));
-
-					drawList->AddCircle(ballScreenPos, dynamicRadius, ImGui::ColorConvertFloat4ToU32(g_ColorBallCircle2D), 16, 2.0f);
-				}
-
-				if (g_DrawBallPrediction) {
-					const float GRAVITY_Z = -650.0f;
-					const float BALL_RADIUS = 91.25f;
-					const float COEFFICIENT_OF_RESTITUTION = 0.6f;
-					const float GROUND_FRICTION_FACTOR = 0.98f;
-					const float SPIN_DAMPING_FACTOR = 0.995f;
-
-					const float MAX_BALL_SPEED = 6000.0f;
-
-					const float FLOOR_Z_PHYSICAL = 0.0f;
-					const float CEILING_Z_PHYSICAL = 2044.0f;
-					const float WALL_X_LIMIT_PHYSICAL = 4096.0f;
-					const float WALL_Y_LIMIT_PHYSICAL = 5120.0f;
-					
-					const float GOAL_HEIGHT_PHYSICAL = 642.775f;
-					const float GOAL_WIDTH_PHYSICAL = 1786.0f;
-					const float GOAL_DEPTH_PHYSICAL = 880.0f;
-					
-					const float FLOOR_Z_EFFECTIVE = FLOOR_Z_PHYSICAL + BALL_RADIUS;
-					const float CEILING_Z_EFFECTIVE = CEILING_Z_PHYSICAL - BALL_RADIUS;
-					const float WALL_X_EFFECTIVE = WALL_X_LIMIT_PHYSICAL - BALL_RADIUS;
-					const float WALL_Y_EFFECTIVE = WALL_Y_LIMIT_PHYSICAL - BALL_RADIUS;
-
-					const float PREDICTION_TIME_SECONDS = 3.0f;
-					const float TIME_STEP = 1.0f / 120.0f;
-					const int MAX_STEPS = static_cast<int>(PREDICTION_TIME_SECONDS / TIME_STEP);
-
-					SDK::FVectorData currentPos = ballLoc;
-					SDK::FVectorData currentVel = ballVel;
-					SDK::FVectorData currentAngVel = ballAngVel;
-
-					bool hasLastValidPos = false;
-					ImVec2 lastValidScreenPos;
-					int lastCollisionType = 0;
-
-					for (int step = 0; step < MAX_STEPS; ++step) {
-						SDK::FVectorData prevPos = currentPos;
-
-						float spin_damp_step = powf(SPIN_DAMPING_FACTOR, TIME_STEP);
-						currentAngVel.X *= spin_damp_step;
-						currentAngVel.Y *= spin_damp_step;
-						currentAngVel.Z *= spin_damp_step;
-						
-						currentVel.Z += GRAVITY_Z * TIME_STEP; 
-						ClampBallVelocity(currentVel, MAX_BALL_SPEED);
-
-						currentPos.X += currentVel.X * TIME_STEP;
-						currentPos.Y += currentVel.Y * TIME_STEP;
-						currentPos.Z += currentVel.Z * TIME_STEP;
-
-						lastCollisionType = 0;
-						bool collidedThisStep = false;
-
-						if (currentPos.Z <= FLOOR_Z_EFFECTIVE) {
-							currentPos.Z = FLOOR_Z_EFFECTIVE;
-							currentVel.Z *= -COEFFICIENT_OF_RESTITUTION;
-							currentVel.X *= GROUND_FRICTION_FACTOR;
-							currentVel.Y *= GROUND_FRICTION_FACTOR;
-
-
-							currentAngVel.X *= 0.3f;
-							currentAngVel.Y *= 0.3f;
-							
-							lastCollisionType = 1;
-							collidedThisStep = true;
-						}
-						else if (currentPos.Z >= CEILING_Z_EFFECTIVE) {
-							currentPos.Z = CEILING_Z_EFFECTIVE;
-							currentVel.Z *= -COEFFICIENT_OF_RESTITUTION;
-							lastCollisionType = 2; 
-							collidedThisStep = true;
-						}
-
-						if (std::abs(currentPos.X) >= WALL_X_EFFECTIVE) {
-							currentPos.X = (currentPos.X > 0 ? 1.f : -1.f) * WALL_X_EFFECTIVE;
-							currentVel.X *= -COEFFICIENT_OF_RESTITUTION;
-							lastCollisionType = 3;
-							collidedThisStep = true;
-						}
-						if (std::abs(currentPos.Y) >= WALL_Y_EFFECTIVE) {
-							bool inGoalAreaX = std::abs(currentPos.X) < (GOAL_WIDTH_PHYSICAL / 2.0f - BALL_RADIUS);
-							bool inGoalAreaZ = currentPos.Z < (GOAL_HEIGHT_PHYSICAL - BALL_RADIUS);
-
-							if (inGoalAreaX && inGoalAreaZ) {
-								float goalBackPlaneY = (currentPos.Y > 0) ?
-									(WALL_Y_LIMIT_PHYSICAL + GOAL_DEPTH_PHYSICAL - BALL_RADIUS) :
-									-(WALL_Y_LIMIT_PHYSICAL + GOAL_DEPTH_PHYSICAL - BALL_RADIUS);
-								
-								if ((currentPos.Y > 0 && currentPos.Y >= goalBackPlaneY && currentVel.Y > 0) ||
-									(currentPos.Y < 0 && currentPos.Y <= goalBackPlaneY && currentVel.Y < 0)) 
-								{
-									currentPos.Y = goalBackPlaneY;
-									currentVel.Y *= -COEFFICIENT_OF_RESTITUTION;
-									lastCollisionType = 3;
-									collidedThisStep = true;
-								}
-							}
-							else {
-								currentPos.Y = (currentPos.Y > 0 ? 1.f : -1.f) * WALL_Y_EFFECTIVE;
-								currentVel.Y *= -COEFFICIENT_OF_RESTITUTION;
-								lastCollisionType = 3;
-								collidedThisStep = true;
-							}
-						}
-
-
-						auto currentScreenPosOpt = WorldToScreen(currentPos, camLocation, camRotation, camSettings.FOV, screenSize.x, screenSize.y); 
-
-						if (currentScreenPosOpt) {
-							ImVec2 currentScreenPos = std::get<0>(*currentScreenPosOpt);
-							bool currentPosValid = !isnan(currentScreenPos.x) && !isnan(currentScreenPos.y) &&
-								currentScreenPos.x >= -100 && currentScreenPos.x <= screenSize.x + 100 &&
-								currentScreenPos.y >= -100 && currentScreenPos.y <= screenSize.y + 100;
-
-							if (hasLastValidPos && currentPosValid) {
-								float speed = std::sqrt(currentVel.X * currentVel.X + 
-									currentVel.Y * currentVel.Y +
-									currentVel.Z * currentVel.Z);
-								float speedRatio = MinF(1.0f, speed / 2000.0f);
-
-								bool isInGoal = std::abs(currentPos.Y) > WALL_Y_LIMIT_PHYSICAL && 
-									std::abs(currentPos.X) < (GOAL_WIDTH_PHYSICAL / 2.f - BALL_RADIUS) &&
-									currentPos.Z < (GOAL_HEIGHT_PHYSICAL - BALL_RADIUS);
-
-								float t = static_cast<float>(step) / MAX_STEPS;
-								int r, g, b, a;
-
-								if (isInGoal) {
-									r = 255; g = 20; b = 20; a = 220;
-								}
-								else {
-									r = static_cast<int>(0 + (0 - 0) * t);                           
-									g = static_cast<int>((255 - speedRatio * 100) * (1.0f - t));     
-									b = static_cast<int>(128 + (255 - 128) * t + speedRatio * 100);  
-									a = static_cast<int>(220 + (50 - 220) * t);                      
-								}
-								
-
-								float thickness = 2.0f + speedRatio * 2.0f;
-
-								static int lastDrawnCollisionType = 0;
-								
-								if (collidedThisStep && lastCollisionType != lastDrawnCollisionType) {
-									ImU32 collisionColor;
-									switch (lastCollisionType) {
-										case 1: collisionColor = IM_COL32(255, 165, 0, 220); break; 
-										case 2: collisionColor = IM_COL32(255, 100, 100, 220); break; 
-										case 3: collisionColor = IM_COL32(100, 255, 100, 220); break; 
-										default: collisionColor = IM_COL32(255, 255, 255, 220); 
-									}
-									drawList->AddCircle(currentScreenPos, 3.0f, collisionColor, 8, 1.5f); 
-									lastDrawnCollisionType = lastCollisionType;
-								}
-								drawList->AddLine(lastValidScreenPos, currentScreenPos, IM_COL32(r, g, b, a), thickness); 
-							}
-
-							if (currentPosValid) {
-								lastValidScreenPos = currentScreenPos;
-								hasLastValidPos = true;
-							}
-							else {
-								hasLastValidPos = false;
-							}
-						}
-						else {
-							hasLastValidPos = false;
-						}
-					}
-				}
-
-				if (show && g_ShowDebugDrawingInfo) { 
-					ImGui::Separator(); 
-					ImGui::Text("Camera Info (Live):");
-					ImGui::Text("  Location: X=%.1f, Y=%.1f, Z=%.1f", camLocation.X, camLocation.Y, camLocation.Z);
-					ImGui::Text("  Rotation: P=%d, Y=%d, R=%d", camRotation.Pitch, camRotation.Yaw, camRotation.Roll);
-					ImGui::Text("  FOV (from PRI Settings): %.1f", camSettings.FOV);
-
-					if (ballScreenPosOpt && ballOnScreen) {
-						ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f),
-							"Ball screen pos: (%.1f, %.1f) Depth: %.1f Transformed.Z: %.1f",
-							ballScreenPos.x, ballScreenPos.y, ballTransformedZ, ballTransformedZ);
-					}
-					else if (ballScreenPosOpt) {
-						ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f),
-							"Ball off screen: (%.1f, %.1f) Depth: %.1f Transformed.Z: %.1f",
-							ballScreenPos.x, ballScreenPos.y, ballTransformedZ, ballTransformedZ);
-					}
-					else {
-						ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f),
-							"Ball projection failed (Behind camera?) Transformed.Z: %.1f", ballTransformedZ);
-					}
-				}
-
-				if (g_DrawCarHitboxes) {
-					auto cars = ge.GetCars(g_pRLSDK->GetMemoryManager());
-					const SDK::FVectorData octaneHalfExtents = { 118.0f / 2.0f, 84.2f / 2.0f, 36.16f / 2.0f }; 
-					const ImU32 hitboxColor = ImGui::ColorConvertFloat4ToU32(g_ColorCarHitbox); 
-
-					for (const auto& car : cars) {
-						if (!car.IsValid()) continue;
-
-						SDK::FVectorData carLocation = car.GetLocation(g_pRLSDK->GetMemoryManager());
-						SDK::FRotatorData carRotation = car.GetRotation(g_pRLSDK->GetMemoryManager());
-						DrawWireframeBox(carLocation, carRotation, octaneHalfExtents, hitboxColor,
-							camLocation, camRotation, camSettings.FOV, screenSize.x, screenSize.y);
-					}
-				}
-
-				if (g_DrawBoostPadTimers && g_SdkAndHooksInitialized.load() && g_pRLSDK) {
-					for (const auto& pad : g_FieldState.BoostPads) {
-						if (!pad.IsActive) {
-							auto remaining = pad.GetRemainingSeconds();
-							if (remaining) {
-								SDK::FVectorData padLocation;
-								padLocation.X = pad.Location.X;
-								padLocation.Y = pad.Location.Y;
-								padLocation.Z = pad.Location.Z + 100.0f;
-								
-								auto screenPosOpt = WorldToScreen(padLocation, camLocation, camRotation, 
-									camSettings.FOV, screenSize.x, screenSize.y);
-								
-								if (screenPosOpt) {
-									ImVec2 screenPos = std::get<0>(*screenPosOpt);
-									
-									if (screenPos.x >= 0 && screenPos.x <= screenSize.x &&
-										screenPos.y >= 0 && screenPos.y <= screenSize.y) {
-										
-										char timerText[16];
-										snprintf(timerText, sizeof(timerText), "%.1f", *remaining);
-										
-										ImU32 textColor = pad.IsBigPad ? 
-											IM_COL32(255, 215, 0, 255) : 
-											IM_COL32(255, 255, 255, 255);
-										
-										float fontSize = 18.0f;
-										ImFont* font = ImGui::GetFont();
-										ImVec2 textSize = font->CalcTextSizeA(fontSize, FLT_MAX, 0.0f, timerText);
-										
-										ImGui::GetForegroundDrawList()->AddRectFilled(
-											ImVec2(screenPos.x - textSize.x/2 - 5, screenPos.y - textSize.y/2 - 3),
-											ImVec2(screenPos.x + textSize.x/2 + 5, screenPos.y + textSize.y/2 + 3),
-											IM_COL32(0, 0, 0, 200)
-										);
-										
-										ImU32 outlineColor = pad.IsBigPad ? 
-											IM_COL32(255, 215, 0, 150) :
-											IM_COL32(200, 200, 200, 150);
-										
-										ImGui::GetForegroundDrawList()->AddRect(
-											ImVec2(screenPos.x - textSize.x/2 - 5, screenPos.y - textSize.y/2 - 3),
-											ImVec2(screenPos.x + textSize.x/2 + 5, screenPos.y + textSize.y/2 + 3),
-											outlineColor, 0.0f, 0, 1.5f
-										);
-										
-										ImU32 glowColor = pad.IsBigPad ? 
-											IM_COL32(255, 215, 0, 80) :
-											IM_COL32(200, 200, 200, 80); 
-											
-										for (int i = 0; i < 4; i++) {
-											float offset = 1.0f + i * 0.5f;
-											ImGui::GetForegroundDrawList()->AddText(
-												font,
-												fontSize,
-												ImVec2(screenPos.x - textSize.x/2 - offset, screenPos.y - textSize.y/2),
-												glowColor,
-												timerText
-											);
-											ImGui::GetForegroundDrawList()->AddText(
-												font,
-												fontSize,
-												ImVec2(screenPos.x - textSize.x/2 + offset, screenPos.y - textSize.y/2),
-												glowColor,
-												timerText
-											);
-											ImGui::GetForegroundDrawList()->AddText(
-												font,
-												fontSize,
-												ImVec2(screenPos.x - textSize.x/2, screenPos.y - textSize.y/2 - offset),
-												glowColor,
-												timerText
-											);
-											ImGui::GetForegroundDrawList()->AddText(
-												font,
-												fontSize,
-												ImVec2(screenPos.x - textSize.x/2, screenPos.y - textSize.y/2 + offset),
-												glowColor,
-												timerText
-											);
-										}
-										
-										ImGui::GetForegroundDrawList()->AddText(
-											font,
-											fontSize,
-											ImVec2(screenPos.x - textSize.x/2, screenPos.y - textSize.y/2),
-											textColor, 
-											timerText
-										);
-									}
-								}
-							}
-						}
-					}
-				}
-
-				if (g_DrawTracers) {
-					auto allCars = ge.GetCars(g_pRLSDK->GetMemoryManager());
-					auto localPlayerControllers = ge.GetLocalPlayers(g_pRLSDK->GetMemoryManager());
-
-					const ImU32 defaultTracersColor = ImGui::ColorConvertFloat4ToU32(g_ColorTracers);
-					float tracerThickness = 2.7f; 
-
-					SDK::ACar localPlayerActualCar(0);
-					uintptr_t localPlayerPRIAddress = 0;
-
-					if (!localPlayerControllers.empty()) {
-						SDK::APlayerController pc = localPlayerControllers[0];
-						if (pc.IsValid()) {
-							SDK::APRI localPRI = pc.GetPRI(g_pRLSDK->GetMemoryManager());
-							if (localPRI.IsValid()) {
-								localPlayerPRIAddress = localPRI.Address;
-							}
-						}
-					}
-
-					if (localPlayerPRIAddress == 0 && !allCars.empty()) {
-						localPlayerActualCar = allCars[0];
-					} else if (localPlayerPRIAddress != 0) {
-						for (const auto& carInstance : allCars) {
-							if (carInstance.IsValid()) {
-								SDK::APRI carInstancePRI = carInstance.GetPRI(g_pRLSDK->GetMemoryManager());
-								if (carInstancePRI.IsValid() && carInstancePRI.Address == localPlayerPRIAddress) {
-									localPlayerActualCar = carInstance;
-									break;
-								}
-							}
-						}
-					}
-
-					ImVec2 tracerStartPointScreenActual = ImVec2(NAN, NAN);
-
-					if (localPlayerActualCar.IsValid()) {
-						SDK::FVectorData localCarWorldLocation = localPlayerActualCar.GetLocation(g_pRLSDK->GetMemoryManager());
-						float fovForW2S = camSettings.FOV;
-
-						std::optional<std::tuple<ImVec2, float>> localCarScreenOpt = WorldToScreen(
-							localCarWorldLocation, camLocation, camRotation, fovForW2S, screenSize.x, screenSize.y);
-
-						if (localCarScreenOpt.has_value()) {
-							tracerStartPointScreenActual = std::get<0>(localCarScreenOpt.value());
-							if (tracerStartPointScreenActual.x < 0 || tracerStartPointScreenActual.x > screenSize.x ||
-								tracerStartPointScreenActual.y < 0 || tracerStartPointScreenActual.y > screenSize.y) {
-								tracerStartPointScreenActual = ImVec2(NAN, NAN);
-							}
-						}
-					}
-
-					if (!isnan(tracerStartPointScreenActual.x) && !isnan(tracerStartPointScreenActual.y)) {
-						ImDrawList* drawList = ImGui::GetForegroundDrawList();
-						float fovForW2S = camSettings.FOV;
-						ImVec2 clipMin = ImVec2(0.0f, 0.0f);
-						ImVec2 clipMax = ImVec2(screenSize.x, screenSize.y);
-
-						SDK::FVectorData camAxisX, camAxisY, camAxisZ;
-						GetAxes(camRotation, camAxisX, camAxisY, camAxisZ);
-
-						for (const auto& opponentCar : allCars) {
-							if (!opponentCar.IsValid()) continue;
-							if (localPlayerActualCar.IsValid() && opponentCar.Address == localPlayerActualCar.Address) continue;
-
-							SDK::FVectorData opponentCarWorldLocation = opponentCar.GetLocation(g_pRLSDK->GetMemoryManager());
-							ImU32 currentTracerColor = defaultTracersColor;
-
-							if (g_UseTeamColorsForTracers) {
-								SDK::APRI opponentCarPRI = opponentCar.GetPRI(g_pRLSDK->GetMemoryManager());
-								if (opponentCarPRI.IsValid()) {
-									SDK::ATeamInfo teamInfo = opponentCarPRI.GetTeamInfo(g_pRLSDK->GetMemoryManager());
-									if (teamInfo.IsValid()) {
-										int32_t teamIndex = teamInfo.GetIndex(g_pRLSDK->GetMemoryManager());
-										if (teamIndex == 0) { currentTracerColor = blueTeamColor; }
-										else if (teamIndex == 1) { currentTracerColor = orangeTeamColor; }
-									}
-								}
-							}
-
-							ImVec2 p1_for_clip;
-							bool targetConsideredInFront = false;
-
-							std::optional<std::tuple<ImVec2, float>> opponentScreenPosOpt = WorldToScreen(
-								opponentCarWorldLocation, camLocation, camRotation, fovForW2S, screenSize.x, screenSize.y);
-
-							if (opponentScreenPosOpt.has_value()) {
-								p1_for_clip = std::get<0>(opponentScreenPosOpt.value());
-								targetConsideredInFront = true;
-							}
-							else {
-								SDK::FVectorData world_dir_to_target = VectorSubtract(opponentCarWorldLocation, camLocation);
-
-								float screen_space_dir_x = VectorDotProduct(world_dir_to_target, camAxisY);
-								float screen_space_dir_y = VectorDotProduct(world_dir_to_target, camAxisZ);
-
-								float len_sq = screen_space_dir_x * screen_space_dir_x + screen_space_dir_y * screen_space_dir_y;
-								if (len_sq < 0.0001f) {
-									screen_space_dir_x = 0.0f;
-									screen_space_dir_y = -1.0f; 
-								}
-								else {
-									float len = sqrt(len_sq);
-									screen_space_dir_x /= len;
-									screen_space_dir_y /= len;
-								}
-
-								float far_distance = screenSize.x + screenSize.y; 
-								p1_for_clip.x = tracerStartPointScreenActual.x + screen_space_dir_x * far_distance;
-								p1_for_clip.y = tracerStartPointScreenActual.y - screen_space_dir_y * far_distance;
-								targetConsideredInFront = false;
-							}
-
-							ImVec2 p0_clipped = tracerStartPointScreenActual;
-							ImVec2 p1_clipped = p1_for_clip;                
-
-							if (ClipLineSegment(p0_clipped, p1_clipped, clipMin, clipMax)) {
-								bool start_is_still_at_local_car_on_screen = (
-									fabs(p0_clipped.x - tracerStartPointScreenActual.x) < 1.0f &&
-									fabs(p0_clipped.y - tracerStartPointScreenActual.y) < 1.0f
-									);
-
-								if (start_is_still_at_local_car_on_screen) {
-									drawList->AddLine(p0_clipped, p1_clipped, currentTracerColor, tracerThickness);
-								}
-							}
-						}
-					}
-				}
-
-				if (g_DrawPlayerDistanceText) {
-					auto allCars = ge.GetCars(g_pRLSDK->GetMemoryManager());
-					auto localPlayerControllers = ge.GetLocalPlayers(g_pRLSDK->GetMemoryManager());
-
-					const ImU32 textColor = ImGui::ColorConvertFloat4ToU32(g_ColorPlayerDistanceText);
-
-					SDK::ACar localPlayerActualCar(0);
-					uintptr_t localPlayerPRIAddress = 0;
-					SDK::FVectorData localPlayerCarWorldLocation = { 0,0,0 }; 
-					if (!localPlayerControllers.empty()) {
-						SDK::APlayerController pc = localPlayerControllers[0];
-						if (pc.IsValid()) {
-							SDK::APRI localPRI = pc.GetPRI(g_pRLSDK->GetMemoryManager());
-							if (localPRI.IsValid()) {
-								localPlayerPRIAddress = localPRI.Address;
-							}
-						}
-					}
-
-					if (localPlayerPRIAddress == 0 && !allCars.empty()) {
-						localPlayerActualCar = allCars[0];
-						localPlayerCarWorldLocation = localPlayerActualCar.GetLocation(g_pRLSDK->GetMemoryManager());
-					} else if (localPlayerPRIAddress != 0) {
-						for (const auto& carInstance : allCars) {
-							if (carInstance.IsValid()) {
-								SDK::APRI carInstancePRI = carInstance.GetPRI(g_pRLSDK->GetMemoryManager());
-								if (carInstancePRI.IsValid() && carInstancePRI.Address == localPlayerPRIAddress) {
-									localPlayerActualCar = carInstance;
-									localPlayerCarWorldLocation = localPlayerActualCar.GetLocation(g_pRLSDK->GetMemoryManager());
-									break;
-								}
-							}
-						}
-					}
-
-					if (localPlayerActualCar.IsValid()) {
-						ImDrawList* drawList = ImGui::GetForegroundDrawList();
-						float fovForW2S = camSettings.FOV;
-						ImVec2 clipMin = ImVec2(0.0f, 0.0f);
-						ImVec2 clipMax = ImVec2(screenSize.x, screenSize.y);
-
-						SDK::FVectorData camAxisX, camAxisY, camAxisZ; 
-						GetAxes(camRotation, camAxisX, camAxisY, camAxisZ);
-
-						char distBuffer[64];
-
-						for (const auto& opponentCar : allCars) {
-							if (!opponentCar.IsValid()) continue;
-							if (opponentCar.Address == localPlayerActualCar.Address) continue; 
-
-							SDK::FVectorData opponentCarWorldLocation = opponentCar.GetLocation(g_pRLSDK->GetMemoryManager());
-
-							SDK::FVectorData deltaVec = VectorSubtract(opponentCarWorldLocation, localPlayerCarWorldLocation);
-							float distanceUU = VectorSize(deltaVec);
-							float distanceMeters = distanceUU / 100.0f; 
-
-							snprintf(distBuffer, sizeof(distBuffer), "%.1fm", distanceMeters);
-							ImVec2 textSize = ImGui::CalcTextSize(distBuffer);
-
-							ImVec2 textScreenPos = ImVec2(NAN, NAN);
-							bool targetIsOnScreen = false;
-
-							SDK::FVectorData opponentTextAnchorWorld = opponentCarWorldLocation;
-							opponentTextAnchorWorld.Z += 50.0f; 
-
-							std::optional<std::tuple<ImVec2, float>> opponentScreenPosOpt = WorldToScreen(
-								opponentTextAnchorWorld, 
-								camLocation, camRotation, fovForW2S, screenSize.x, screenSize.y);
-
-							if (opponentScreenPosOpt.has_value()) {
-								ImVec2 rawScreenPos = std::get<0>(opponentScreenPosOpt.value());
-								if (rawScreenPos.x >= clipMin.x && rawScreenPos.x <= clipMax.x &&
-									rawScreenPos.y >= clipMin.y && rawScreenPos.y <= clipMax.y) {
-									textScreenPos = ImVec2(rawScreenPos.x - textSize.x, rawScreenPos.y - textSize.y);
-									targetIsOnScreen = true;
-								}
-								else {
-									textScreenPos = rawScreenPos;
-								}
-							}
-
-							if (!targetIsOnScreen) {
-								SDK::FVectorData world_dir_to_target_center = VectorSubtract(opponentCarWorldLocation, camLocation);
-
-								float screen_space_dir_x = VectorDotProduct(world_dir_to_target_center, camAxisY);
-								float screen_space_dir_y = VectorDotProduct(world_dir_to_target_center, camAxisZ);
+	const bool overlayEnabled = g_DrawBallCircle || g_Draw3DSphere || g_DrawBallPrediction || g_AlwaysDrawBallCircle || g_DrawCarHitboxes || g_DrawVelocityPointers || g_DrawOpponentBoost || g_DrawTracers || g_DrawPlayerDistanceText || g_DrawBoostPadTimers;
+	g_FrameWorker.SetEnabled(overlayEnabled || show || g_MatchRecorder.IsRecording());
+	g_FrameWorker.SetPredictionEnabled(g_DrawBallPrediction);
 
-								float len_sq = screen_space_dir_x * screen_space_dir_x + screen_space_dir_y * screen_space_dir_y;
-								if (len_sq < 0.0001f) {
-									screen_space_dir_x = 0.0f; screen_space_dir_y = -1.0f;
-								}
-								else {
-									float len = sqrt(len_sq);
-									screen_space_dir_x /= len; screen_space_dir_y /= len;
-								}
-
-								ImVec2 offscreen_origin = ImVec2(screenSize.x / 2.0f, screenSize.y / 2.0f);
-								float far_distance = (screenSize.x + screenSize.y) / 2.0f;
-
-								ImVec2 p1_offscreen_indicator_end;
-								p1_offscreen_indicator_end.x = offscreen_origin.x + screen_space_dir_x * far_distance;
-								p1_offscreen_indicator_end.y = offscreen_origin.y - screen_space_dir_y * far_distance;
-
-								ImVec2 p0_clipped = offscreen_origin;
-								ImVec2 p1_clipped = p1_offscreen_indicator_end;
-
-								if (ClipLineSegment(p0_clipped, p1_clipped, clipMin, clipMax)) {
-									ImVec2 edgePoint = p1_clipped;
-									float padding = 5.0f;
-
-
-									textScreenPos.x = edgePoint.x - textSize.x / 2.0f;
-									textScreenPos.y = edgePoint.y - textSize.y / 2.0f;
-
-									if (edgePoint.x <= clipMin.x + padding * 2) textScreenPos.x = clipMin.x + padding;
-									else if (edgePoint.x >= clipMax.x - padding * 2) textScreenPos.x = clipMax.x - textSize.x - padding;
-
-									if (edgePoint.y <= clipMin.y + padding * 2) textScreenPos.y = clipMin.y + padding; 
-									else if (edgePoint.y >= clipMax.y - padding * 2) textScreenPos.y = clipMax.y - textSize.y - padding; 
-
-								}
-								else {
-									textScreenPos = ImVec2(NAN, NAN); 
-								}
-							}
-
-							if (!isnan(textScreenPos.x) && !isnan(textScreenPos.y)) {
-								textScreenPos.x = (std::max)(clipMin.x, (std::min)(textScreenPos.x, clipMax.x - textSize.x));
-								textScreenPos.y = (std::max)(clipMin.y, (std::min)(textScreenPos.y, clipMax.y - textSize.y));
-								drawList->AddText(textScreenPos, textColor, distBuffer);
-							}
-						}
-					}
-				}
-
-				if (g_DrawOpponentBoost) {
-					auto cars = ge.GetCars(g_pRLSDK->GetMemoryManager());
-					auto localPlayers = ge.GetLocalPlayers(g_pRLSDK->GetMemoryManager());
-					const ImU32 boostCircleColor = ImGui::ColorConvertFloat4ToU32(g_ColorBoostCircle);
-
-					uintptr_t localPlayerPRIAddr = 0;
-					SDK::ACar localPlayerCar(0);
-					
-					if (!localPlayers.empty() && localPlayers[0].IsValid()) {
-						SDK::APlayerController pc = localPlayers[0];
-						SDK::APRI localPRI = pc.GetPRI(g_pRLSDK->GetMemoryManager());
-						if (localPRI.IsValid()) {
-							localPlayerPRIAddr = localPRI.Address;
-						}
-					}
-
-					if (localPlayerPRIAddr == 0 && !cars.empty()) {
-						localPlayerCar = cars[0];
-					}
-
-					for (const auto& car : cars) {
-						if (!car.IsValid()) continue;
-
-						if (localPlayerPRIAddr != 0) {
-							SDK::APRI carPRI = car.GetPRI(g_pRLSDK->GetMemoryManager());
-							if (carPRI.IsValid() && carPRI.Address == localPlayerPRIAddr) continue;
-						} else if (localPlayerCar.IsValid() && car.Address == localPlayerCar.Address) {
-							continue; 
-						}
-
-						SDK::UBoostComponent boostComp = car.GetBoostComponent(g_pRLSDK->GetMemoryManager());
-						if (!boostComp.IsValid()) continue;
-
-						float boostAmount = boostComp.GetAmount(g_pRLSDK->GetMemoryManager());
-						SDK::FVectorData carLocation = car.GetLocation(g_pRLSDK->GetMemoryManager());
-
-						carLocation.Z += 120.0f;
-
-						SDK::APRI carPRI = car.GetPRI(g_pRLSDK->GetMemoryManager());
-
-						DrawBoostCircle(carLocation, boostAmount, camLocation, camRotation, camSettings.FOV,
-							screenSize.x, screenSize.y, boostCircleColor, g_pRLSDK->GetMemoryManager(), carPRI, g_UseTeamColorsForBoost);
-					}
-				}
-
-				if (g_DrawVelocityPointers) {
-					const float arrowScale = 150.0f;
-					const float arrowHeadLength = 20.0f;
-					const float arrowHeadWidth = 10.0f;
-					const ImU32 ballArrowColor = ImGui::ColorConvertFloat4ToU32(g_ColorVelocityArrowBall);
-					const ImU32 carArrowColor = ImGui::ColorConvertFloat4ToU32(g_ColorVelocityArrowCar);
-
-					if (ball.IsValid()) { 
-						DrawVelocityArrow3D(ballLoc, ballVel, arrowScale, arrowHeadLength, arrowHeadWidth, ballArrowColor,
-							camLocation, camRotation, camSettings.FOV, screenSize.x, screenSize.y);
-					}
-
-					auto cars = ge.GetCars(g_pRLSDK->GetMemoryManager()); 
-					
-
-					uintptr_t localPlayerPRIAddr = 0;
-					SDK::ACar localPlayerCar(0);
-					
-					if (!localPlayers.empty() && localPlayers[0].IsValid()) {
-						SDK::APRI localPRI = localPlayers[0].GetPRI(g_pRLSDK->GetMemoryManager());
-						if (localPRI.IsValid()) {
-							localPlayerPRIAddr = localPRI.Address;
-						}
-					}
-					
-					if (localPlayerPRIAddr == 0 && !cars.empty()) {
-						localPlayerCar = cars[0];
-					}
-					
-					for (const auto& car : cars) {
-						if (!car.IsValid()) continue;
-						
-						if (localPlayerPRIAddr != 0) {
-							SDK::APRI carPRI = car.GetPRI(g_pRLSDK->GetMemoryManager());
-							if (carPRI.IsValid() && carPRI.Address == localPlayerPRIAddr) continue;
-						} else if (localPlayerCar.IsValid() && car.Address == localPlayerCar.Address) {
-							continue;
-						}
-						
-						SDK::FVectorData carLocation = car.GetLocation(g_pRLSDK->GetMemoryManager());
-						SDK::FVectorData carVelocity = car.GetVelocity(g_pRLSDK->GetMemoryManager());
-						DrawVelocityArrow3D(carLocation, carVelocity, arrowScale, arrowHeadLength, arrowHeadWidth, carArrowColor,
-							camLocation, camRotation, camSettings.FOV, screenSize.x, screenSize.y);
-					}
-				}
-
-				if (show && g_ShowDebugDrawingInfo) {
-					ImGui::Separator();
-					ImGui::Text("Camera Info (Live):");
-					ImGui::Text("  Location: X=%.1f, Y=%.1f, Z=%.1f", camLocation.X, camLocation.Y, camLocation.Z);
-					ImGui::Text("  Rotation: P=%d, Y=%d, R=%d", camRotation.Pitch, camRotation.Yaw, camRotation.Roll);
-					ImGui::Text("  FOV (from PRI Settings): %.1f", camSettings.FOV);
-
-					if (ballScreenPosOpt && ballOnScreen) {
-						ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f),
-							"Ball screen pos: (%.1f, %.1f) Depth: %.1f Transformed.Z: %.1f",
-							ballScreenPos.x, ballScreenPos.y, ballTransformedZ, ballTransformedZ);
-					}
-					else if (ballScreenPosOpt) {
-						ImGui::TextColored(ImVec4(1.0f, 0.5f, 0.0f, 1.0f), 
-							"Ball off screen: (%.1f, %.1f) Depth: %.1f Transformed.Z: %.1f",
-							ballScreenPos.x, ballScreenPos.y, ballTransformedZ, ballTransformedZ);
-					}
-					else {
-						ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f),
-							"Ball projection failed (Behind camera?) Transformed.Z: %.1f", ballTransformedZ);
-					}
-				}
-
-			}
-			catch (const std::exception& e) {
-				if (show) { 
-					Logger::Error("Ball ESP Drawing Exception: " + std::string(e.what()));
-					ImGui::Separator(); 
-					ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Ball ESP Error: %s", e.what());
-				}
-				else { 
-					
-				}
-			}
-			catch (...) { 
-				if (show) {
-					Logger::Error("Ball ESP Drawing: Unknown exception occurred.");
-					ImGui::Separator();
-					ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Ball ESP Error: Unknown exception");
-				}
-			}
+	if (overlayEnabled && g_SdkAndHooksInitialized.load()) {
+		std::shared_ptr<const FrameModel> frame = g_FrameWorker.GetLatest();
+		if (frame->CanDraw()) {
+			DrawOverlayFrame(*frame);
+		}
+		else if (show && frame->InMatch() && !frame->Error.empty()) {
+			ImGui::Separator();
+			ImGui::TextColored(ImVec4(1.0f, 0.0f, 0.0f, 1.0f), "Ball ESP Error: %s", frame->Error.c_str());
 		}
 	}
 
@@ -2180,26 +1911,82 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 				}
 				ImGui::Separator();
 
+				ImGui::Text("Render Thread Budget:");
+				ImGui::Text("  Present Hook: %.0f us (avg %.0f us, max %.0f us) / budget %.0f us",
+					g_PresentTimer.GetLastMicroseconds(), g_PresentTimer.GetAverageMicroseconds(),
+					g_PresentTimer.GetWindowMaxMicroseconds(), PresentTimer::BudgetMicroseconds);
+				ImGui::Text("  Frames Over Budget: %llu / %llu", g_PresentTimer.GetOverBudgetFrames(), g_PresentTimer.GetFrames());
+				ImGui::Text("  Overlay Layers Skipped: %llu", g_PresentTimer.GetSkippedLayers());
+				ImGui::Text("  Log Messages Dropped: %llu", Logger::GetDroppedCount());
+				if (g_pRLSDK) {
+					const ObjectDiscovery& discovery = g_pRLSDK->GetObjectDiscovery();
+					ImGui::Text("  Object Discovery: %d objects, %zu tracked, %zu blocks changed, last pass %.0f us%s",
+						discovery.GetObjectCount(), g_pRLSDK->GetGObjectsTable().GetTrackedObjectCount(), discovery.GetChangedChunks(),
+						discovery.GetLastPassMicroseconds(),
+						discovery.IsRunning() ? "" : " (stopped)");
+				}
+
+				std::shared_ptr<const FrameModel> frame_debug = g_FrameWorker.GetLatest();
+				if (frame_debug->Sequence != 0) {
+					auto frameAge = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - frame_debug->CapturedAt);
+					ImGui::Text("  Frame Model: #%llu, captured %lld ms ago in %.0f us, %zu links cached", frame_debug->Sequence, frameAge.count(), frame_debug->BuildMicroseconds, frame_debug->CachedLinks);
+				}
+				else {
+					ImGui::Text("  Frame Model: not captured yet");
+				}
+				ImGui::Separator();
+
+				if constexpr (ReadStats::Enabled) {
+					// Rates over the last full second; Collect() locks, so it is not called every frame.
+					static ReadStats::Snapshot readStatsPrevious;
+					static ReadStats::Snapshot readStatsRate;
+					static auto readStatsSampledAt = std::chrono::steady_clock::now();
+					auto readStatsNow = std::chrono::steady_clock::now();
+					std::chrono::duration<double> sinceSample = readStatsNow - readStatsSampledAt;
+					if (sinceSample.count() >= 1.0) {
+						ReadStats::Snapshot current = ReadStats::Collect();
+						readStatsRate = current.Since(readStatsPrevious);
+						for (ReadStats::Counters& counters : readStatsRate.Categories) {
+							counters.Calls = static_cast<uint64_t>(counters.Calls / sinceSample.count());
+							counters.Bytes = static_cast<uint64_t>(counters.Bytes / sinceSample.count());
+							counters.Failures = static_cast<uint64_t>(counters.Failures / sinceSample.count());
+							counters.Nanoseconds = static_cast<uint64_t>(counters.Nanoseconds / sinceSample.count());
+						}
+						readStatsPrevious = current;
+						readStatsSampledAt = readStatsNow;
+					}
+
+					ImGui::Text("Memory Reads (per second):");
+					ImGui::Columns(5, "##ReadStats", false);
+					ImGui::Text("Category"); ImGui::NextColumn();
+					ImGui::Text("Calls"); ImGui::NextColumn();
+					ImGui::Text("KB"); ImGui::NextColumn();
+					ImGui::Text("Avg us"); ImGui::NextColumn();
+					ImGui::Text("Failed"); ImGui::NextColumn();
+					for (size_t c = 0; c < ReadStats::CategoryCount; ++c) {
+						const ReadStats::Counters& counters = readStatsRate.Categories[c];
+						if (counters.Calls == 0) continue;
+						ImGui::Text("  %s", ReadStats::CategoryName(static_cast<ReadCategory>(c))); ImGui::NextColumn();
+						ImGui::Text("%llu", counters.Calls); ImGui::NextColumn();
+						ImGui::Text("%.1f", counters.Bytes / 1024.0); ImGui::NextColumn();
+						ImGui::Text("%.2f", counters.Nanoseconds / 1000.0 / counters.Calls); ImGui::NextColumn();
+						ImGui::Text("%llu", counters.Failures); ImGui::NextColumn();
+					}
+					ImGui::Columns(1);
+					ImGui::Separator();
+				}
+
 				ImGui::Text("Game Info:"); 
 				if (g_SdkAndHooksInitialized && g_pRLSDK) {
-					SDK::AGameEvent ge_debug = g_pRLSDK->GetCurrentGameEvent(); 
-					if (ge_debug.IsValid()) {
-						ImGui::Text("GameEvent Found: %s", Logger::to_hex(ge_debug.Address).c_str());
+					if (frame_debug->InMatch()) {
+						ImGui::Text("GameEvent Found: %s", Logger::to_hex(frame_debug->GameEventAddress).c_str());
 						ImGui::Separator();
 						ImGui::Text("Ball Info:");
 
-						auto balls_debug = ge_debug.GetBalls(g_pRLSDK->GetMemoryManager());
-						if (!balls_debug.empty()) {
-							SDK::ABall ball_debug = balls_debug[0];
-							if (ball_debug.IsValid()) {
-								SDK::FVectorData ballLoc_debug = ball_debug.GetLocation(g_pRLSDK->GetMemoryManager());
-								SDK::FVectorData ballVel_debug = ball_debug.GetVelocity(g_pRLSDK->GetMemoryManager());
-								ImGui::Text("  Ball Loc: X=%.1f, Y=%.1f, Z=%.1f", ballLoc_debug.X, ballLoc_debug.Y, ballLoc_debug.Z);
-								ImGui::Text("  Ball Vel: X=%.1f, Y=%.1f, Z=%.1f", ballVel_debug.X, ballVel_debug.Y, ballVel_debug.Z);
-							}
-							else {
-								ImGui::Text("  Ball object pointer invalid.");
-							}
+						if (frame_debug->HasBall) {
+							const BallPredictor::BallState& ball_debug = frame_debug->Ball;
+							ImGui::Text("  Ball Loc: X=%.1f, Y=%.1f, Z=%.1f", ball_debug.Location.X, ball_debug.Location.Y, ball_debug.Location.Z);
+							ImGui::Text("  Ball Vel: X=%.1f, Y=%.1f, Z=%.1f", ball_debug.Velocity.X, ball_debug.Velocity.Y, ball_debug.Velocity.Z);
 						}
 						else {
 							ImGui::Text("  No balls found in GameEvent array.");
@@ -2207,24 +1994,14 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 
 						ImGui::Separator();
 						ImGui::Text("Car Info:");
-						auto cars_debug = ge_debug.GetCars(g_pRLSDK->GetMemoryManager());
-						if (!cars_debug.empty()) {
-							for (size_t i = 0; i < cars_debug.size(); ++i) {
-								SDK::ACar car_debug = cars_debug[i];
-								if (car_debug.IsValid()) {
-									std::wstring playerName_debug = L"";
-									SDK::APRI pri_debug = car_debug.GetPRI(g_pRLSDK->GetMemoryManager());
-									if (pri_debug.IsValid()) {
-										playerName_debug = pri_debug.GetPlayerName(g_pRLSDK->GetMemoryManager());
-									}
-									std::string nameStr_debug = (playerName_debug.empty() ? "Car[" + std::to_string(i) + "]" : std::string(playerName_debug.begin(), playerName_debug.end()));
-
-									SDK::FVectorData carLoc_debug = car_debug.GetLocation(g_pRLSDK->GetMemoryManager());
-									SDK::FVectorData carVel_debug = car_debug.GetVelocity(g_pRLSDK->GetMemoryManager());
-									ImGui::Text("  %s:", nameStr_debug.c_str());
-									ImGui::Text("    Loc: X=%.1f, Y=%.1f, Z=%.1f", carLoc_debug.X, carLoc_debug.Y, carLoc_debug.Z);
-									ImGui::Text("    Vel: X=%.1f, Y=%.1f, Z=%.1f", carVel_debug.X, carVel_debug.Y, carVel_debug.Z);
-								}
+						if (!frame_debug->Cars.empty()) {
+							for (size_t i = 0; i < frame_debug->Cars.size(); ++i) {
+								const FrameModel::CarInfo& car_debug = frame_debug->Cars[i];
+								std::string nameStr_debug = car_debug.Name.empty() ? "Car[" + std::to_string(i) + "]" : car_debug.Name;
+
+								ImGui::Text("  %s:", nameStr_debug.c_str());
+								ImGui::Text("    Loc: X=%.1f, Y=%.1f, Z=%.1f", car_debug.Location.X, car_debug.Location.Y, car_debug.Location.Z);
+								ImGui::Text("    Vel: X=%.1f, Y=%.1f, Z=%.1f", car_debug.Velocity.X, car_debug.Velocity.Y, car_debug.Velocity.Z);
 							}
 						}
 						else {
@@ -2371,6 +2148,13 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 				}
 				ImGui::SameLine(); HelpMarker("Toggles speedflip kickoff in the Client.");
 
+				bool tempStreamBallPrediction = g_StreamBallPredictionForClient.load();
+				if (ImGui::Checkbox("Stream Ball Prediction", &tempStreamBallPrediction)) {
+					g_StreamBallPredictionForClient.store(tempStreamBallPrediction);
+					g_SettingsChangedForClient = true;
+				}
+				ImGui::SameLine(); HelpMarker("Sends the predicted ball path (and bounce/goal events) to the Client every physics tick, so it can skip its own prediction.");
+
 				ImGui::Separator();
 
 				bool tempPythonMonitoring = false;
@@ -2429,6 +2213,70 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 				}
 				ImGui::SameLine();
 				ImGui::TextDisabled("(Unloads the DLL)");
+				ImGui::Separator();
+
+				ImGui::Text("Ball Prediction:");
+				ImGui::Text("  Arena SDF: %s", g_BallPredictor.IsUsingSDF() ? "Loaded" : "Not loaded (plane fallback)");
+				ImGui::Text("  AVX2 Batch Kernel: %s", BallPredictor::IsSimdAvailable() ? "Available" : "Unavailable (scalar fallback)");
+
+				if (g_BatchBenchmarkRunning.load()) {
+					ImGui::TextDisabled("Benchmark running...");
+				}
+				else if (ImGui::Button("Benchmark Batch Predictor")) {
+					g_BatchBenchmarkRunning = true;
+					uintptr_t hThread = _beginthreadex(NULL, 0, BatchBenchmarkThread, NULL, 0, NULL);
+					if (hThread != 0) {
+						CloseHandle(reinterpret_cast<HANDLE>(hThread));
+					}
+					else {
+						g_BatchBenchmarkRunning = false;
+						Logger::Error("Failed to create BatchBenchmarkThread!");
+					}
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(g_BatchBenchmarkMutex);
+					if (g_BatchBenchmarkValid) {
+						ImGui::Text("  Last Run: %d trajectories x %d steps", g_LastBatchBenchmark.Count, g_LastBatchBenchmark.Steps);
+						ImGui::Text("  Scalar: %.0f traj/s", g_LastBatchBenchmark.ScalarTrajectoriesPerSecond);
+						if (g_LastBatchBenchmark.SimdAvailable) {
+							ImGui::Text("  SIMD: %.0f traj/s (%.1fx)", g_LastBatchBenchmark.SimdTrajectoriesPerSecond,
+								g_LastBatchBenchmark.ScalarTrajectoriesPerSecond > 0.0 ? g_LastBatchBenchmark.SimdTrajectoriesPerSecond / g_LastBatchBenchmark.ScalarTrajectoriesPerSecond : 0.0);
+						}
+					}
+				}
+				ImGui::Separator();
+
+				ImGui::Text("Match Recording:");
+				if (g_MatchRecorder.IsRecording()) {
+					ImGui::Text("  File: %s", g_MatchRecorder.GetPath().c_str());
+					ImGui::Text("  %llu ticks, %.1f MB", static_cast<unsigned long long>(g_MatchRecorder.GetTickCount()),
+						g_MatchRecorder.GetBytesWritten() / (1024.0 * 1024.0));
+					if (ImGui::Button("Stop Recording")) {
+						g_FrameWorker.SetRecorder(nullptr);
+						g_MatchRecorder.Close();
+					}
+				}
+				else {
+					if (ImGui::Button("Start Recording")) {
+						std::time_t now = std::time(nullptr);
+						char fileName[64];
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+						std::strftime(fileName, sizeof(fileName), "match_%Y%m%d_%H%M%S.vrec", std::localtime(&now));
+						const double tickRate = 1000000.0 / static_cast<double>(FrameWorker::DefaultPeriod.count());
+						if (g_MatchRecorder.Open(GetModuleDirectory() + fileName, tickRate)) {
+							g_FrameWorker.SetRecorder(&g_MatchRecorder);
+						}
+					}
+					ImGui::SameLine();
+					ImGui::TextDisabled("(Samples every FrameWorker tick while in a match)");
+					std::string recorderError = g_MatchRecorder.GetError();
+					if (!recorderError.empty()) {
+						ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "  %s", recorderError.c_str());
+					}
+				}
 
 				ImGui::EndTabItem();
 			}
@@ -2462,9 +2310,37 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 		}
 	}
 
+	g_PresentTimer.End();
 	return oPresent(pSwapChain, SyncInterval, Flags);
 }
 
+std::string GetModuleDirectory() {
+	char modulePath[MAX_PATH] = { 0 };
+	DWORD length = GetModuleFileNameA(g_hModule, modulePath, MAX_PATH);
+	if (length == 0 || length >= MAX_PATH) return "";
+	std::string path(modulePath, length);
+	size_t slash = path.find_last_of("\\/");
+	return slash == std::string::npos ? "" : path.substr(0, slash + 1);
+}
+
+void LoadArenaSDF() {
+	std::string sdfPath = GetModuleDirectory() + ARENA_SDF_FILENAME;
+	if (g_ArenaSDF.LoadFromFile(sdfPath)) {
+		Logger::Info("LoadArenaSDF: Loaded arena SDF from " + sdfPath + " (" + std::to_string(g_ArenaSDF.GetCellCount()) + " cells).");
+	}
+	else {
+		Logger::Warning("LoadArenaSDF: " + sdfPath + " missing or invalid. Baking from the analytic arena model...");
+		g_ArenaSDF.BuildSoccar();
+		if (g_ArenaSDF.SaveToFile(sdfPath)) {
+			Logger::Info("LoadArenaSDF: Baked arena SDF written to " + sdfPath);
+		}
+		else {
+			Logger::Warning("LoadArenaSDF: Could not write " + sdfPath + ", using the in-memory grid for this session.");
+		}
+	}
+	g_BallPredictor.SetArena(&g_ArenaSDF);
+}
+
 bool InitializeSDKAndHooks() {
 	Logger::Info("InitializeSDKAndHooks: Attempting Kiero D3D11 init (this also initializes MinHook)...");
 	if (kiero::init(kiero::RenderType::D3D11) != kiero::Status::Success) {
@@ -2494,30 +2370,11 @@ bool InitializeSDKAndHooks() {
 					Logger::Info("[EVENT] Key: " + keyData->KeyName + " Type: " + std::to_string(static_cast<int>(keyData->EventType)));
 				}
 				});
-			g_pRLSDK->Subscribe(EventType::OnBoostPadStateChanged, [](const EventData& data) {
-				if (const auto* boostData = dynamic_cast<const EventBoostPadChangedData*>(&data)) {
-					Logger::Info("[EVENT] Boost Pad " + Logger::to_hex(boostData->BoostPickupAddress) + " Active: " + (boostData->IsNowActive ? "true" : "false"));
-					
-					if (g_pRLSDK) {
-						auto* pad = g_FieldState.FindPadByActorAddress(boostData->BoostPickupAddress);
-						if (pad) {
-							if (boostData->IsNowActive) {
-								pad->Reset();
-							} else {
-								pad->MarkInactive();
-							}
-						}
-					}
-				}
-			});
-			
-			g_pRLSDK->Subscribe(EventType::OnResetPickups, [](const EventData& data) {
-				Logger::Info("[EVENT] Reset Pickups");
-				g_FieldState.ResetBoostPads();
-			});
-			
+			// Boost pad state is polled by the FrameWorker's BoostPadTracker; the pickup hooks are disabled.
 			g_FieldState.ResetBoostPads();
 			Logger::Info("InitializeSDKAndHooks: FieldState initialized with boost pads.");
+
+			LoadArenaSDF();
 		}
 		else {
 			throw std::runtime_error("RLSDK pointer is null after construction (should not happen).");
@@ -2543,6 +2400,7 @@ bool InitializeSDKAndHooks() {
 	if (kiero::bind(8, (void**)&oPresent, hkPresent) == kiero::Status::Success) {
 		Logger::Info("InitializeSDKAndHooks: Kiero Present Hooked successfully.");
 		init_hook = true;
+		g_FrameWorker.Start(g_pRLSDK.get(), &g_BallPredictor, &g_FieldState);
 		g_SdkAndHooksInitialized.store(true);
 		return true;
 	}
@@ -2566,6 +2424,9 @@ DWORD WINAPI MainThread(LPVOID lpReserved)
 	else {
 		OutputDebugStringA("MainThread: Logger::Initialize() SUCCEEDED.\n");
 		Logger::Info("MainThread: Starting System initialization..."); 
+		if (!Logger::OpenBinaryLog(GetModuleDirectory() + "vutrium.vlog")) {
+			Logger::Warning("MainThread: Could not open binary log vutrium.vlog; logging to the console only.");
+		}
 	}
 
 	Logger::Info("MainThread: Starting server thread...");
@@ -2594,10 +2455,8 @@ BOOL WINAPI DllMain(HMODULE hMod, DWORD dwReason, LPVOID lpReserved)
 	case DLL_PROCESS_ATTACH:
 		DisableThreadLibraryCalls(hMod);
 		g_hModule = hMod;
-		if (HANDLE hThread = CreateThread(nullptr, 0, MainThread, hMod, 0, nullptr)) {
-			CloseHandle(hThread); 
-		}
-		else {
+		g_hMainThread = CreateThread(nullptr, 0, MainThread, hMod, 0, nullptr);
+		if (g_hMainThread == NULL) {
 			MessageBoxA(NULL, "Failed to create initialization thread!", "DLL Attach Error", MB_OK | MB_ICONERROR);
 			return FALSE;
 		}
@@ -2618,8 +2477,12 @@ BOOL WINAPI DllMain(HMODULE hMod, DWORD dwReason, LPVOID lpReserved)
 		}
 
 		if (g_pRLSDK) {
-			g_pRLSDK.reset(); 
-			Logger::Info("DLL_PROCESS_DETACH: RLSDK instance reset.");
+			// EjectThread frees the SDK after stopping the frame worker and the recorder. Still having it
+			// here means the process is exiting (or the DLL was unloaded without ejecting): the frame
+			// worker may still be using it, and nothing can be joined under the loader lock, so leak it.
+			g_pRLSDK->GetObjectDiscovery().RequestStop();
+			(void)g_pRLSDK.release();
+			Logger::Info("DLL_PROCESS_DETACH: RLSDK instance left to the process exit.");
 		}
 
 		if (g_ClientSocket != INVALID_SOCKET) {
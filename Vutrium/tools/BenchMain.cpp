@@ -0,0 +1,592 @@
+// Microbenchmarks for the SDK and overlay hot paths, run headless against a SyntheticHeap.
+// Not part of the DLL project; build it on its own, e.g. on Linux from this directory:
+//
+//   g++ -std=c++17 -O2 -pthread -I.. -I<nlohmann include dir> BenchMain.cpp ../SyntheticHeap.cpp ../MemoryManager.cpp ../GNameTable.cpp ../GObjectsTable.cpp ../Objects.cpp ../FieldState.cpp ../Logger.cpp ../EventManager.cpp ../BallPredictor.cpp ../ArenaSDF.cpp ../BridgeProtocol.cpp ../CameraProjection.cpp ../PointerCache.cpp ../ReadStats.cpp ../BinaryLog.cpp ../FieldOffsetResolver.cpp -o vutrium_bench
+//
+// Usage: vutrium_bench [--filter <substring>] [--min-time <seconds>] [--names <count>]
+//                      [--objects <count>] [--seed <n>] [--skip-init]
+//
+// Every case reports ns/op, heap allocations/op (operator new calls) and reads/op. A read is one
+// MemoryManager::ReadBytes reaching the backend, i.e. one ReadProcessMemory syscall in game.
+// The SDK cases share one heap at RL's scale (500k names, 1M objects by default); the
+// GObjectsTable::Initialize cases build their own at several sizes and check what they mapped,
+// then time Refresh() and ResolveFieldOffsets() on the result.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+#include "ArenaSDF.h"
+#include "BallPredictor.h"
+#include "BridgeProtocol.h"
+#include "CameraProjection.h"
+#include "EventData.h"
+#include "EventManager.h"
+#include "FieldOffsetResolver.h"
+#include "GNameTable.h"
+#include "GObjectsTable.h"
+#include "MemoryManager.h"
+#include "PointerCache.h"
+#include "SyntheticHeap.h"
+
+namespace {
+    std::atomic<uint64_t> g_Allocations{ 0 };
+    volatile uint64_t g_Sink = 0; // Results are folded in here so the optimizer can't drop the work
+}
+
+void* operator new(std::size_t size) {
+    g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size != 0 ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+    double SecondsSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Runs each case with a growing op count until it takes at least MinSeconds (or hits its
+    // op limit), then prints the per-op figures of that last batch.
+    class Bench {
+    public:
+        std::string Filter;
+        double MinSeconds = 0.25;
+        SyntheticHeap* Heap = nullptr; // Where reads are counted; null for cases that don't read
+        size_t BytesPerOp = 0;         // Input bytes per op; when set, throughput is printed too
+        bool Failed = false;
+
+        bool Selected(const std::string& name) const {
+            return Filter.empty() || name.find(Filter) != std::string::npos;
+        }
+
+        void PrintHeader() const {
+            std::printf("%-52s %10s %12s %10s %10s\n", "case", "ops", "ns/op", "allocs/op", "reads/op");
+        }
+
+        // 'op(i)' performs operation number i. Expensive one-shot cases pass maxOps = 1 and
+        // skip the warm-up call.
+        template<typename Op>
+        void Case(const std::string& name, Op&& op, uint64_t maxOps = UINT64_MAX, bool warmUp = true) {
+            if (!Selected(name)) return;
+            if (warmUp) op(0);
+
+            uint64_t ops = 1;
+            for (;;) {
+                if (Heap) Heap->ResetCounters();
+                const uint64_t allocationsBefore = g_Allocations.load(std::memory_order_relaxed);
+                const auto start = std::chrono::steady_clock::now();
+                for (uint64_t i = 0; i < ops; ++i) op(i);
+                const double seconds = SecondsSince(start);
+                const uint64_t allocations = g_Allocations.load(std::memory_order_relaxed) - allocationsBefore;
+                const uint64_t reads = Heap ? Heap->GetReadCount() : 0;
+
+                if (seconds >= MinSeconds || ops >= maxOps) {
+                    const double perOp = 1.0 / static_cast<double>(ops);
+                    std::printf("%-52s %10llu %12.1f %10.2f %10.2f", name.c_str(), static_cast<unsigned long long>(ops),
+                                seconds * 1e9 * perOp, allocations * perOp, reads * perOp);
+                    if (BytesPerOp != 0) {
+                        std::printf(" %10.1f MB/s", static_cast<double>(BytesPerOp) * ops / seconds / 1e6);
+                    }
+                    std::printf("\n");
+                    std::fflush(stdout);
+                    return;
+                }
+                const double scale = seconds > 0.0 ? MinSeconds / seconds * 1.2 : 10.0;
+                ops = (std::min)(maxOps, static_cast<uint64_t>(static_cast<double>(ops) * (std::min)(10.0, (std::max)(2.0, scale))));
+            }
+        }
+    };
+
+    int Usage() {
+        std::fprintf(stderr, "usage: vutrium_bench [--filter <substring>] [--min-time <seconds>] [--names <count>] "
+                             "[--objects <count>] [--seed <n>] [--skip-init]\n");
+        return 2;
+    }
+
+    // Objects cycled through by the per-object cases, spread over the whole table.
+    constexpr size_t SampleSize = 4096;
+
+    template<typename T>
+    std::vector<T> Sample(const std::vector<T>& source, size_t count) {
+        std::vector<T> sample;
+        const size_t step = (std::max)(static_cast<size_t>(1), source.size() / count);
+        for (size_t i = 0; i < source.size() && sample.size() < count; i += step) sample.push_back(source[i]);
+        return sample;
+    }
+
+    void RunSdkCases(Bench& bench, const SyntheticHeap::Config& config) {
+        SyntheticHeap heap;
+        if (!heap.Build(config)) {
+            std::fprintf(stderr, "Invalid heap size (names 58..500000, objects >= 1000)\n");
+            bench.Failed = true;
+            return;
+        }
+        MemoryManager pm(heap);
+        GNameTable gnames;
+        if (!gnames.Initialize(pm, heap.GetModuleBase(), heap.GetGNamesOffset())) {
+            std::fprintf(stderr, "GNameTable::Initialize failed\n");
+            bench.Failed = true;
+            return;
+        }
+        bench.Heap = &heap;
+
+        // Throughput is over the UTF-16 name data; the generated names are ASCII, so that's twice
+        // their UTF-8 length.
+        size_t nameBytes = 0;
+        for (size_t id = 0; id < heap.GetNameCount(); ++id) {
+            nameBytes += gnames.GetNameView(static_cast<int32_t>(id)).size() * sizeof(char16_t);
+        }
+        GNameTable reloaded;
+        bench.BytesPerOp = nameBytes;
+        bench.Case("GNameTable::Initialize (" + std::to_string(heap.GetNameCount() / 1000) + "k names)", [&](uint64_t) {
+            g_Sink += reloaded.Initialize(pm, heap.GetModuleBase(), heap.GetGNamesOffset());
+        }, 20, false);
+        bench.BytesPerOp = 0;
+        if (reloaded.IsInitialized() && reloaded.GetNameCount() != gnames.GetNameCount()) {
+            std::fprintf(stderr, "GNameTable::Initialize: reload found %zu names, expected %zu\n",
+                         reloaded.GetNameCount(), gnames.GetNameCount());
+            bench.Failed = true;
+        }
+
+        std::vector<int32_t> nameIds;
+        for (size_t i = 0; i < SampleSize; ++i) nameIds.push_back(static_cast<int32_t>((i * 2654435761u) % heap.GetNameCount()));
+        bench.Case("GNameTable::GetName", [&](uint64_t i) {
+            g_Sink += gnames.GetName(nameIds[i % nameIds.size()]).size();
+        });
+
+        const std::vector<uintptr_t> actors = Sample(heap.GetInstances(), SampleSize);
+        bench.Case("UObject::GetFullName (actor)", [&](uint64_t i) {
+            g_Sink += SDK::UObject(actors[i % actors.size()]).GetFullName(pm, gnames).size();
+        });
+        bench.Case("UObject::IsA (hit, Actor)", [&](uint64_t i) {
+            g_Sink += SDK::UObject(actors[i % actors.size()]).IsA(pm, gnames, "Actor");
+        });
+        bench.Case("UObject::IsA (miss, walks to Object)", [&](uint64_t i) {
+            g_Sink += SDK::UObject(actors[i % actors.size()]).IsA(pm, gnames, "NotAClass");
+        });
+
+        for (size_t count : { 8, 64, 1024 }) {
+            const uintptr_t array = heap.AddTArray(std::vector<uintptr_t>(actors.begin(), actors.begin() + (std::min)(count, actors.size())));
+            bench.Case("GetTArrayItems<UObject> (" + std::to_string(count) + ")", [&](uint64_t) {
+                g_Sink += SDK::GetTArrayItems<SDK::UObject>(pm, array).size();
+            });
+            size_t iterated = 0;
+            bench.Case("TArrayView<UObject> (" + std::to_string(count) + ")", [&](uint64_t) {
+                iterated = 0;
+                for (SDK::UObject object : SDK::TArrayView<SDK::UObject>(pm, array)) {
+                    g_Sink += object.Address;
+                    ++iterated;
+                }
+            });
+            if (bench.Selected("TArrayView<UObject> (" + std::to_string(count) + ")") && iterated != (std::min)(count, actors.size())) {
+                std::fprintf(stderr, "TArrayView<UObject> (%zu): iterated %zu elements\n", count, iterated);
+                bench.Failed = true;
+            }
+        }
+
+        // A frame's worth of links (eight cars with a handful of pointers each), followed through
+        // the Outer field, which every instance has.
+        const std::vector<uintptr_t> owners(actors.begin(), actors.begin() + (std::min)(static_cast<size_t>(64), actors.size()));
+        bench.Case("Read links directly (64 links)", [&](uint64_t) {
+            for (uintptr_t owner : owners) {
+                g_Sink += pm.Read<uintptr_t>(owner + SDK::UObject::Offset_Outer).value_or(0);
+            }
+        });
+        SDK::PointerCache links;
+        bench.Case("PointerCache::Resolve (64 links)", [&](uint64_t) {
+            links.BeginFrame(pm, heap.GetModuleBase());
+            for (uintptr_t owner : owners) {
+                g_Sink += links.Resolve(pm, owner, SDK::UObject::Offset_Outer);
+            }
+        });
+        for (uintptr_t owner : owners) {
+            if (links.Resolve(pm, owner, SDK::UObject::Offset_Outer) != pm.Read<uintptr_t>(owner + SDK::UObject::Offset_Outer).value_or(0)) {
+                std::fprintf(stderr, "PointerCache: cached link doesn't match memory\n");
+                bench.Failed = true;
+                break;
+            }
+        }
+
+        // Eight cars' motion as the FrameWorker reads it: four getters each, or one snapshot per
+        // car with all of them in one scatter read.
+        const std::vector<uintptr_t> cars(actors.begin(), actors.begin() + (std::min)(static_cast<size_t>(8), actors.size()));
+        for (size_t i = 0; i < cars.size(); ++i) {
+            const SDK::FVectorData location{ 100.0f * i, -200.0f, 17.0f };
+            heap.WriteBytes(cars[i] + SDK::AActor::Location::Offset(), &location, sizeof(location));
+        }
+        bench.Case("AActor getters (8 actors x 4 fields)", [&](uint64_t) {
+            for (uintptr_t car : cars) {
+                const SDK::AActor actor(car);
+                g_Sink += static_cast<uint64_t>(actor.GetLocation(pm).X + actor.GetRotation(pm).Yaw
+                                                + actor.GetVelocity(pm).X + actor.GetAngularVelocity(pm).X);
+            }
+        });
+        std::vector<SDK::ActorMotionSnapshot> motion(cars.size());
+        std::vector<MemoryManager::ScatterRead> motionReads;
+        bench.Case("ReadFieldSnapshots<ActorMotion> (8 actors)", [&](uint64_t) {
+            g_Sink += SDK::ReadFieldSnapshots(pm, cars.data(), motion.data(), cars.size(), motionReads);
+            for (const auto& snapshot : motion) {
+                g_Sink += static_cast<uint64_t>(snapshot.Get<SDK::AActor::Location>().X);
+            }
+        });
+        SDK::ReadFieldSnapshots(pm, cars.data(), motion.data(), cars.size(), motionReads);
+        for (size_t i = 0; i < cars.size(); ++i) {
+            if (!motion[i].IsValid() || motion[i].Get<SDK::AActor::Location>().X != SDK::AActor(cars[i]).GetLocation(pm).X) {
+                std::fprintf(stderr, "ActorMotionSnapshot: snapshot doesn't match the getters\n");
+                bench.Failed = true;
+                break;
+            }
+        }
+        size_t visited = 0;
+        motion[0].ForEach([&](const SDK::FieldInfo& field, const auto&) { visited += field.Owner != nullptr; });
+        if (visited != 4 || std::strcmp(SDK::GetFieldInfo(SDK::AActor::Velocity::Id).Property, "Velocity") != 0) {
+            std::fprintf(stderr, "ActorMotionSnapshot: field manifest doesn't match the snapshot\n");
+            bench.Failed = true;
+        }
+
+        const uintptr_t asciiName = heap.AddFString(u"xX_SomeRocketLeaguePlayer_Xx");
+        const std::u16string mixedText = u"Zo\u00EB \u30ED\u30B1\u30C3\u30C8 \U0001F680 Player";
+        const uintptr_t mixedName = heap.AddFString(mixedText);
+        bench.Case("GetFString + narrow (28 chars)", [&](uint64_t) {
+            std::wstring name = SDK::GetFString(pm, asciiName);
+            std::string narrow(name.begin(), name.end());
+            g_Sink += narrow.size();
+        });
+        SDK::FStringCache nameCache;
+        bench.Case("FStringCache::Get hit (28 chars)", [&](uint64_t) {
+            g_Sink += nameCache.Get(pm, asciiName).size();
+        });
+        bench.Case("FStringCache::Get miss (28 chars)", [&](uint64_t) {
+            nameCache.Clear();
+            g_Sink += nameCache.Get(pm, asciiName).size();
+        });
+        char utf8[SDK::MaxFStringUtf8Bytes];
+        const std::u16string asciiText(SDK::MaxFStringChars, u'a');
+        bench.BytesPerOp = asciiText.size() * sizeof(char16_t);
+        bench.Case("Utf16ToUtf8 (256 ASCII)", [&](uint64_t) {
+            g_Sink += SDK::Utf16ToUtf8(asciiText.data(), asciiText.size(), utf8, sizeof(utf8));
+        });
+        bench.BytesPerOp = mixedText.size() * sizeof(char16_t);
+        bench.Case("Utf16ToUtf8 (mixed)", [&](uint64_t) {
+            g_Sink += SDK::Utf16ToUtf8(mixedText.data(), mixedText.size(), utf8, sizeof(utf8));
+        });
+        bench.BytesPerOp = 0;
+        nameCache.Clear();
+        if (nameCache.Get(pm, asciiName) != "xX_SomeRocketLeaguePlayer_Xx"
+            || nameCache.Get(pm, mixedName) != u8"Zo\u00EB \u30ED\u30B1\u30C3\u30C8 \U0001F680 Player") {
+            std::fprintf(stderr, "FStringCache: converted names don't match\n");
+            bench.Failed = true;
+        }
+        bench.Heap = nullptr;
+    }
+
+    void RunOverlayCases(Bench& bench) {
+        EventManager events;
+        uint64_t delivered = 0;
+        const EventPlayerTickData tick(0x1000, 1.0f / 120.0f);
+        size_t subscribed = 0;
+        for (size_t subscribers : { 1, 8, 64 }) {
+            for (; subscribed < subscribers; ++subscribed) {
+                events.Subscribe("OnPlayerTick", [&delivered](const EventData&) { ++delivered; });
+            }
+            bench.Case("EventManager::Fire (" + std::to_string(subscribers) + " subscribers)", [&](uint64_t) {
+                events.Fire("OnPlayerTick", tick);
+            });
+        }
+        g_Sink += delivered;
+
+        Bridge::ClientSettings settings;
+        settings.BotEnabled = true;
+        settings.SelectedBot = "Nexto";
+        settings.BallPredictionStream = true;
+        bench.Case("ConstructSettingsJSON", [&](uint64_t i) {
+            settings.Debug = (i & 1) != 0;
+            g_Sink += Bridge::EncodeSettings(settings).size();
+        });
+
+        // A state is 6 or 9 numbers; anything in between would leave the angular velocity half set.
+        const nlohmann::json batchRequest = {
+            { "type", "predict_batch" }, { "id", 7 }, { "steps", 120 }, { "stride", 2 },
+            { "states", { { 0.0, 0.0, 92.75, 1200.0, 1800.0, 900.0 }, { 0.0, 0.0, 92.75, 1200.0, 1800.0, 900.0, 1.0, -2.0, 0.5 } } },
+        };
+        std::string parseError;
+        bench.Case("ParsePredictBatchRequest (2 states)", [&](uint64_t) {
+            g_Sink += Bridge::ParsePredictBatchRequest(batchRequest, parseError).has_value();
+        });
+        nlohmann::json partialState = batchRequest;
+        partialState["states"][0] = { 0.0, 0.0, 92.75, 1200.0, 1800.0, 900.0, 1.0 };
+        if (!Bridge::ParsePredictBatchRequest(batchRequest, parseError) || Bridge::ParsePredictBatchRequest(partialState, parseError)) {
+            std::fprintf(stderr, "ParsePredictBatchRequest: a 6- or 9-value state was rejected, or a 7-value one accepted\n");
+            bench.Failed = true;
+        }
+
+        ArenaSDF arena;
+        arena.BuildSoccar();
+        BallPredictor predictor;
+        predictor.SetArena(&arena);
+        BallPredictor::BallState ball;
+        ball.Location = { 0.0f, 0.0f, 92.75f };
+        ball.Velocity = { 1200.0f, 1800.0f, 900.0f };
+        ball.AngularVelocity = { 1.0f, -2.0f, 0.5f };
+        std::vector<BallPredictor::Slice> slices;
+        bench.Case("BallPredictor::Predict (" + std::to_string(BallPredictor::MaxSteps) + " steps)", [&](uint64_t) {
+            predictor.Predict(ball, slices);
+            g_Sink += slices.size();
+        });
+        if (slices.empty()) predictor.Predict(ball, slices);
+
+        // WorldToScreen in main.cpp is Project plus an ImVec2 wrap; ProjectBatch is what the
+        // prediction path uses per frame.
+        const CameraProjection camera({ -3000.0f, -4000.0f, 800.0f }, -2500, 10000, 0, 110.0f, 1920.0f, 1080.0f);
+        CameraProjection::ScreenPoint point;
+        bench.Case("WorldToScreen (CameraProjection::Project)", [&](uint64_t i) {
+            g_Sink += camera.Project(slices[i % slices.size()].State.Location, point);
+        });
+        std::vector<CameraProjection::ScreenPoint> points(slices.size());
+        bench.Case("CameraProjection::ProjectBatch (" + std::to_string(slices.size()) + " pts)", [&](uint64_t) {
+            g_Sink += camera.ProjectBatch(&slices[0].State.Location, sizeof(BallPredictor::Slice), slices.size(), points.data());
+        });
+    }
+
+    // Incremental GObjects tracking on an initialized table: the first Refresh() resolves every
+    // slot, later ones only diff. The churn case swaps pointers between slots the way the GC
+    // frees and the next spawn reuses them, so each op sees removals and additions.
+    void RunRefreshCases(Bench& bench, SyntheticHeap& heap, MemoryManager& pm, GObjectsTable& gobjects, size_t objects) {
+        const std::string suffix = " (" + std::to_string(objects / 1000) + "k objects)";
+        const uintptr_t actor = heap.GetInstances().back();
+        const uintptr_t actorClass = SDK::UObject(actor).GetClassAddress(pm);
+        size_t walked = 0;
+        bench.Heap = &heap;
+        bench.Case("ForEachInstanceFromTail walk" + suffix, [&](uint64_t) {
+            walked = gobjects.ForEachInstanceFromTail(pm, actorClass, [](const SDK::UObject&) { return true; });
+        }, 4);
+        bench.Case("GObjectsTable::Refresh first" + suffix, [&](uint64_t) {
+            g_Sink += gobjects.Refresh(pm);
+        }, 1, false);
+
+        // Every non-null slot must be tracked, and an actor must be found under its class.
+        size_t expected = 0;
+        const SDK::TArrayLayout layout = *pm.Read<SDK::TArrayLayout>(heap.GetModuleBase() + heap.GetGObjectsOffset());
+        std::vector<uintptr_t> slots(static_cast<size_t>(layout.ArrayCount));
+        pm.ReadBytes(layout.ArrayData, slots.data(), slots.size() * sizeof(uintptr_t));
+        for (uintptr_t object : slots) expected += object != 0;
+        const auto instances = gobjects.GetInstances(actorClass);
+        const bool actorFound = std::any_of(instances.begin(), instances.end(),
+            [&](const GObjectsTable::TrackedObject& instance) { return instance.Address == actor; });
+        if (gobjects.GetTrackedObjectCount() != expected || !actorFound) {
+            std::fprintf(stderr, "GObjectsTable::Refresh%s: tracked %zu of %zu objects, actor %s\n", suffix.c_str(),
+                         gobjects.GetTrackedObjectCount(), expected, actorFound ? "found" : "missing");
+            bench.Failed = true;
+        }
+
+        size_t indexed = 0;
+        bench.Case("ForEachInstanceFromTail indexed" + suffix, [&](uint64_t) {
+            indexed = gobjects.ForEachInstanceFromTail(pm, actorClass, [](const SDK::UObject&) { return true; });
+        });
+        std::vector<uintptr_t> copied;
+        bench.Case("GObjectsTable::CopyInstances" + suffix, [&](uint64_t) {
+            g_Sink += gobjects.CopyInstances(gobjects.FindClassId(actorClass), copied);
+        });
+        if (indexed != walked || copied.size() != walked) {
+            std::fprintf(stderr, "Instance index%s: walk found %zu, index %zu, copy %zu\n", suffix.c_str(),
+                         walked, indexed, copied.size());
+            bench.Failed = true;
+        }
+
+        GObjectsTable::ObjectDelta delta;
+        bench.Case("GObjectsTable::Refresh unchanged" + suffix, [&](uint64_t) {
+            gobjects.Refresh(pm, &delta);
+            g_Sink += delta.ChunksChanged;
+        });
+
+        constexpr size_t ChurnPerOp = 64;
+        uint64_t state = 0x9E3779B97F4A7C15ull;
+        bench.Case("GObjectsTable::Refresh 64 slots churned" + suffix, [&](uint64_t) {
+            for (size_t k = 0; k < ChurnPerOp; ++k) {
+                state = state * 6364136223846793005ull + 1442695040888963407ull;
+                const size_t a = static_cast<size_t>(state >> 33) % slots.size();
+                const size_t b = static_cast<size_t>(state >> 11) % slots.size();
+                std::swap(slots[a], slots[b]);
+                heap.WriteBytes(layout.ArrayData + a * sizeof(uintptr_t), &slots[a], sizeof(uintptr_t));
+                heap.WriteBytes(layout.ArrayData + b * sizeof(uintptr_t), &slots[b], sizeof(uintptr_t));
+            }
+            gobjects.Refresh(pm, &delta);
+            g_Sink += delta.Added.size() + delta.Removed.size();
+        });
+        if (gobjects.GetTrackedObjectCount() != expected) {
+            std::fprintf(stderr, "GObjectsTable::Refresh%s: %zu tracked after churn, expected %zu\n", suffix.c_str(),
+                         gobjects.GetTrackedObjectCount(), expected);
+            bench.Failed = true;
+        }
+        bench.Heap = nullptr;
+    }
+
+    void RunFieldOffsetCases(Bench& bench, SyntheticHeap& heap, MemoryManager& pm, const GNameTable& gnames,
+                             const GObjectsTable& gobjects, size_t objects) {
+        const std::string suffix = " (" + std::to_string(objects / 1000) + "k objects)";
+        SDK::FieldOffsetReport report;
+        bench.Heap = &heap;
+        bench.Case("ResolveFieldOffsets" + suffix, [&](uint64_t) {
+            report = SDK::ResolveFieldOffsets(pm, gnames, gobjects, false);
+            g_Sink += report.Verified;
+        });
+        bench.Heap = nullptr;
+        if (report.Verified != SDK::FieldOffsetReport::FieldCount) {
+            std::fprintf(stderr, "ResolveFieldOffsets%s: %zu of %zu fields verified (%zu moved, %zu rejected, %zu missing)\n",
+                         suffix.c_str(), report.Verified, SDK::FieldOffsetReport::FieldCount, report.Moved, report.Rejected, report.Missing);
+            bench.Failed = true;
+        }
+
+        // Move GameEvent's last field and an actor's Velocity in the reflection data: the accessors
+        // must follow, and the motion snapshot must fall back to per-field reads and still agree with them.
+        auto moveProperty = [&](SDK::FieldId field, int32_t offset) {
+            heap.WriteBytes(heap.GetFieldProperty(field) + SDK::UProperty::Offset_Offset, &offset, sizeof(offset));
+        };
+        moveProperty(SDK::FieldId::AGameEvent_RoundNum, 0x0968);
+        moveProperty(SDK::FieldId::AActor_Velocity, 0x01B0);
+        report = SDK::ResolveFieldOffsets(pm, gnames, gobjects);
+        const uintptr_t actor = heap.GetInstances().back();
+        SDK::ActorMotionSnapshot motion;
+        const bool followed = report.Moved == 2 && !report.LayoutRejected && SDK::AGameEvent::RoundNum::Offset() == 0x0968
+                              && !SDK::ActorMotionSnapshot::IsContiguous() && motion.Read(pm, actor)
+                              && motion.Get<SDK::AActor::Velocity>().X == SDK::AActor(actor).GetVelocity(pm).X
+                              && motion.Get<SDK::AActor::Location>().X == SDK::AActor(actor).GetLocation(pm).X;
+        moveProperty(SDK::FieldId::AGameEvent_RoundNum, static_cast<int32_t>(SDK::AGameEvent::RoundNum::DefaultOffset));
+        moveProperty(SDK::FieldId::AActor_Velocity, static_cast<int32_t>(SDK::AActor::Velocity::DefaultOffset));
+        report = SDK::ResolveFieldOffsets(pm, gnames, gobjects);
+        if (!followed || report.Verified != SDK::FieldOffsetReport::FieldCount || !SDK::ActorMotionSnapshot::IsContiguous()) {
+            std::fprintf(stderr, "ResolveFieldOffsets%s: moved fields were not %s\n", suffix.c_str(), followed ? "restored" : "followed");
+            bench.Failed = true;
+        }
+
+        // A member added to UObject moves every field: all of them must follow, and the snapshot
+        // keeps its one read since the fields kept their relative layout.
+        constexpr int32_t Shift = 0x8;
+        const uintptr_t objectClass = gobjects.FindStaticClass("Class Core.Object").Address;
+        uint32_t objectSize = 0;
+        heap.ReadBytes(objectClass + SDK::UStruct::Offset_PropertySize, &objectSize, sizeof(objectSize));
+        auto shiftLayout = [&](int32_t shift) {
+            const uint32_t shiftedSize = objectSize + static_cast<uint32_t>(shift);
+            heap.WriteBytes(objectClass + SDK::UStruct::Offset_PropertySize, &shiftedSize, sizeof(shiftedSize));
+            for (size_t field = 0; field < SDK::FieldOffsetReport::FieldCount; ++field) {
+                const SDK::FieldId id = static_cast<SDK::FieldId>(field);
+                moveProperty(id, static_cast<int32_t>(SDK::GetFieldInfo(id).DefaultOffset) + shift);
+            }
+        };
+        shiftLayout(Shift);
+        report = SDK::ResolveFieldOffsets(pm, gnames, gobjects);
+        const bool shifted = !report.LayoutRejected && report.Moved == SDK::FieldOffsetReport::FieldCount
+                             && SDK::AGameEvent::Cars::Offset() == SDK::AGameEvent::Cars::DefaultOffset + Shift
+                             && SDK::ActorMotionSnapshot::IsContiguous() && motion.Read(pm, actor)
+                             && motion.Get<SDK::AActor::Velocity>().X == SDK::AActor(actor).GetVelocity(pm).X;
+        shiftLayout(0);
+        report = SDK::ResolveFieldOffsets(pm, gnames, gobjects);
+        if (!shifted || report.Verified != SDK::FieldOffsetReport::FieldCount) {
+            std::fprintf(stderr, "ResolveFieldOffsets%s: a base class shift was not %s\n", suffix.c_str(), shifted ? "restored" : "followed");
+            bench.Failed = true;
+        }
+
+        // A wrong UProperty layout reads the same junk offset for every property: nothing may move.
+        for (size_t field = 0; field < SDK::FieldOffsetReport::FieldCount; ++field) {
+            moveProperty(static_cast<SDK::FieldId>(field), 0x10);
+        }
+        report = SDK::ResolveFieldOffsets(pm, gnames, gobjects);
+        const bool keptDefaults = report.LayoutRejected && SDK::AGameEvent::Cars::Offset() == SDK::AGameEvent::Cars::DefaultOffset
+                                  && SDK::ActorMotionSnapshot::IsContiguous();
+        for (size_t field = 0; field < SDK::FieldOffsetReport::FieldCount; ++field) {
+            const SDK::FieldId id = static_cast<SDK::FieldId>(field);
+            moveProperty(id, static_cast<int32_t>(SDK::GetFieldInfo(id).DefaultOffset));
+        }
+        report = SDK::ResolveFieldOffsets(pm, gnames, gobjects);
+        if (!keptDefaults || report.LayoutRejected || report.Verified != SDK::FieldOffsetReport::FieldCount) {
+            std::fprintf(stderr, "ResolveFieldOffsets%s: a wrong property layout was %s\n", suffix.c_str(),
+                         keptDefaults ? "not recovered from" : "trusted");
+            bench.Failed = true;
+        }
+    }
+
+    void RunInitCases(Bench& bench, uint64_t seed) {
+        for (size_t objects : { 100000, 250000, 1000000 }) {
+            const std::string suffix = " (" + std::to_string(objects / 1000) + "k objects)";
+            const std::string name = "GObjectsTable::Initialize" + suffix;
+            if (!bench.Selected(name)) continue;
+
+            SyntheticHeap::Config config;
+            config.ObjectCount = objects;
+            config.NameCount = (std::min)(static_cast<size_t>(500000), objects / 2);
+            config.Seed = seed;
+            SyntheticHeap heap;
+            MemoryManager pm(heap);
+            GNameTable gnames;
+            if (!heap.Build(config) || !gnames.Initialize(pm, heap.GetModuleBase(), heap.GetGNamesOffset())) {
+                std::fprintf(stderr, "%s: could not build the heap\n", name.c_str());
+                bench.Failed = true;
+                continue;
+            }
+
+            GObjectsTable gobjects;
+            bool initialized = false;
+            bench.Heap = &heap;
+            bench.Case(name, [&](uint64_t) {
+                initialized = gobjects.Initialize(pm, gnames, heap.GetModuleBase(), heap.GetGObjectsOffset());
+            }, 1, false);
+            bench.Heap = nullptr;
+
+            // The table must see exactly what was built, or the timing doesn't mean anything.
+            size_t missing = 0;
+            for (const std::string& className : heap.GetClassFullNames()) {
+                if (!gobjects.FindStaticClass(className).IsValid()) ++missing;
+            }
+            for (const std::string& functionName : heap.GetFunctionFullNames()) {
+                if (!gobjects.FindStaticFunction(functionName).IsValid()) ++missing;
+            }
+            if (!initialized || missing != 0) {
+                std::fprintf(stderr, "%s: %s, %zu generated classes/functions not mapped\n", name.c_str(),
+                             initialized ? "initialized" : "failed", missing);
+                bench.Failed = true;
+            }
+            if (initialized && !heap.GetFunctionFullNames().empty()) {
+                // Split once up front, like the constexpr hook names; what's left is the id lookup.
+                std::vector<SDK::ObjectPath> paths(heap.GetFunctionFullNames().begin(), heap.GetFunctionFullNames().end());
+                bench.Case("GObjectsTable::FindStaticFunction" + suffix, [&](uint64_t i) {
+                    g_Sink += gobjects.FindStaticFunction(paths[i % paths.size()]).Address;
+                });
+            }
+            if (initialized) {
+                RunRefreshCases(bench, heap, pm, gobjects, objects);
+                RunFieldOffsetCases(bench, heap, pm, gnames, gobjects, objects);
+            }
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    Bench bench;
+    SyntheticHeap::Config config;
+    bool runInit = true;
+    for (int i = 1; i < argc; ++i) {
+        const char* option = argv[i];
+        if (std::strcmp(option, "--skip-init") == 0) { runInit = false; continue; }
+        if (i + 1 >= argc) return Usage();
+        const char* value = argv[++i];
+        if (std::strcmp(option, "--filter") == 0) bench.Filter = value;
+        else if (std::strcmp(option, "--min-time") == 0) bench.MinSeconds = std::atof(value);
+        else if (std::strcmp(option, "--names") == 0) config.NameCount = std::strtoull(value, nullptr, 0);
+        else if (std::strcmp(option, "--objects") == 0) config.ObjectCount = std::strtoull(value, nullptr, 0);
+        else if (std::strcmp(option, "--seed") == 0) config.Seed = std::strtoull(value, nullptr, 0);
+        else return Usage();
+    }
+
+    bench.PrintHeader();
+    RunSdkCases(bench, config);
+    RunOverlayCases(bench);
+    if (runInit) RunInitCases(bench, config.Seed);
+    return bench.Failed ? 1 : 0;
+}
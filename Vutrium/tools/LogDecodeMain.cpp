@@ -0,0 +1,140 @@
+// Renders a binary .vlog (Logger::OpenBinaryLog) back to the text the console showed.
+// Not part of the DLL project; build it on its own, e.g. on Linux from this directory:
+//
+//   g++ -std=c++17 -O2 -I.. LogDecodeMain.cpp ../BinaryLog.cpp -o vutrium_logdecode
+//
+// Usage: vutrium_logdecode <log.vlog> [--level info|warn|error] [--grep <substring>] [--stats]
+//
+// Records are decoded with the format table stored in the file, so a log always decodes with
+// the strings of the build that wrote it. --stats prints per-format record counts instead.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "BinaryLog.h"
+
+namespace {
+    int Usage() {
+        std::fprintf(stderr, "usage: vutrium_logdecode <log.vlog> [--level info|warn|error] [--grep <substring>] [--stats]\n");
+        return 2;
+    }
+
+    struct Format {
+        LogLevel Level;
+        std::string Text;
+    };
+
+    std::string FormatTimestamp(int64_t unixMicroseconds) {
+        std::time_t seconds = static_cast<std::time_t>(unixMicroseconds / 1000000);
+        char date[32] = "TIMESTAMP_ERROR";
+#ifdef _MSC_VER
+#pragma warning(suppress : 4996)
+#endif
+        if (const std::tm* local = std::localtime(&seconds)) std::strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", local);
+        char buffer[48];
+        std::snprintf(buffer, sizeof(buffer), "%s.%03d", date, static_cast<int>(unixMicroseconds / 1000 % 1000));
+        return buffer;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) return Usage();
+    std::string path = argv[1];
+    LogLevel minLevel = LogLevel::Info;
+    std::string grep;
+    bool stats = false;
+    for (int i = 2; i < argc; ++i) {
+        if (!std::strcmp(argv[i], "--level") && i + 1 < argc) {
+            std::string level = argv[++i];
+            if (level == "warn") minLevel = LogLevel::Warning;
+            else if (level == "error") minLevel = LogLevel::Error;
+            else if (level != "info") return Usage();
+        }
+        else if (!std::strcmp(argv[i], "--grep") && i + 1 < argc) grep = argv[++i];
+        else if (!std::strcmp(argv[i], "--stats")) stats = true;
+        else return Usage();
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (file.size() < sizeof(BinaryLog::FileHeader)) {
+        std::fprintf(stderr, "%s: not a binary log\n", path.c_str());
+        return 1;
+    }
+
+    BinaryLog::FileHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.Magic, BinaryLog::Magic, sizeof(header.Magic)) != 0 || header.SchemaVersion != BinaryLog::SchemaVersion ||
+        header.BlockSize < sizeof(BinaryLog::BlockHeader) || header.HeaderSize > file.size()) {
+        std::fprintf(stderr, "%s: not a binary log, or schema %u is not supported\n", path.c_str(), header.SchemaVersion);
+        return 1;
+    }
+
+    std::vector<Format> formats;
+    size_t offset = sizeof(header);
+    for (uint32_t i = 0; i < header.FormatCount; ++i) {
+        BinaryLog::FormatEntry entry;
+        if (offset + sizeof(entry) > header.HeaderSize) break;
+        std::memcpy(&entry, file.data() + offset, sizeof(entry));
+        offset += sizeof(entry);
+        if (offset + entry.FormatLength > header.HeaderSize) break;
+        formats.push_back({ static_cast<LogLevel>(entry.Level), std::string(reinterpret_cast<const char*>(file.data() + offset), entry.FormatLength) });
+        offset += entry.FormatLength;
+    }
+
+    // Blocks in the order they were written; the file may be shorter than BlockCount blocks.
+    std::vector<std::pair<uint64_t, size_t>> blocks;
+    for (uint32_t b = 0; b < header.BlockCount; ++b) {
+        size_t blockOffset = header.HeaderSize + static_cast<size_t>(b) * header.BlockSize;
+        if (blockOffset + header.BlockSize > file.size()) break;
+        BinaryLog::BlockHeader block;
+        std::memcpy(&block, file.data() + blockOffset, sizeof(block));
+        if (block.Sequence != 0) blocks.emplace_back(block.Sequence, blockOffset);
+    }
+    std::sort(blocks.begin(), blocks.end());
+
+    std::vector<uint64_t> counts(formats.size() + 1, 0);
+    uint64_t records = 0;
+    for (const auto& [sequence, blockOffset] : blocks) {
+        BinaryLog::BlockHeader block;
+        std::memcpy(&block, file.data() + blockOffset, sizeof(block));
+        size_t end = blockOffset + std::min<size_t>(block.UsedBytes, header.BlockSize);
+        size_t position = blockOffset + sizeof(block);
+        while (position + sizeof(BinaryLog::RecordHeader) <= end) {
+            BinaryLog::RecordHeader record;
+            std::memcpy(&record, file.data() + position, sizeof(record));
+            position += sizeof(record);
+            if (position + record.PayloadSize > end) break;
+            const uint8_t* payload = file.data() + position;
+            position += record.PayloadSize;
+            ++records;
+
+            if (stats) {
+                counts[std::min<size_t>(record.FormatId, formats.size())]++;
+                continue;
+            }
+            LogLevel level = static_cast<LogLevel>(record.Level);
+            if (level < minLevel) continue;
+
+            std::string format = record.FormatId < formats.size() ? formats[record.FormatId].Text : "<unknown format " + std::to_string(record.FormatId) + ">";
+            std::string text = BinaryLog::RenderRecord(record.FormatId, format, payload, record.PayloadSize);
+            if (!grep.empty() && text.find(grep) == std::string::npos) continue;
+
+            int64_t unixMicroseconds = header.StartUnixMicroseconds + (record.SteadyNanoseconds - header.StartSteadyNanoseconds) / 1000;
+            std::printf("[%s] [%s] %s\n", FormatTimestamp(unixMicroseconds).c_str(), BinaryLog::LevelName(level), text.c_str());
+        }
+    }
+
+    if (stats) {
+        std::printf("%llu records in %zu blocks\n", static_cast<unsigned long long>(records), blocks.size());
+        for (size_t i = 0; i < counts.size(); ++i) {
+            if (counts[i] == 0) continue;
+            std::printf("%10llu  %s\n", static_cast<unsigned long long>(counts[i]), i < formats.size() ? formats[i].Text.c_str() : "<unknown format>");
+        }
+    }
+    return 0;
+}
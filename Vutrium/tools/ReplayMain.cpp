@@ -0,0 +1,86 @@
+// Headless replay of a .vrec match recording through the overlay/bridge pipeline.
+// Not part of the DLL project; build it on its own, e.g. on Linux from this directory:
+//
+//   g++ -std=c++17 -O2 -pthread -I.. -I<nlohmann include dir> ReplayMain.cpp ../MatchReplay.cpp ../FrameModel.cpp ../FieldState.cpp ../BallPredictor.cpp ../ArenaSDF.cpp ../BridgeProtocol.cpp -o vutrium_replay
+//
+// Usage: vutrium_replay <recording.vrec> [--realtime] [--no-predict] [--no-bridge]
+//                       [--sdf <arena_soccar.vsdf>] [--dump <messages.jsonl>]
+//
+// The printed digest covers everything the consumers produced, so two builds can be compared by
+// replaying the same file; --dump writes the bridge messages for a line-by-line diff.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include "ArenaSDF.h"
+#include "BallPredictor.h"
+#include "MatchReplay.h"
+
+namespace {
+    int Usage() {
+        std::fprintf(stderr, "usage: vutrium_replay <recording.vrec> [--realtime] [--no-predict] [--no-bridge] "
+                             "[--sdf <file>] [--dump <file>]\n");
+        return 2;
+    }
+
+    double PerFrameMicroseconds(double seconds, uint64_t frames) {
+        return frames > 0 ? seconds * 1e6 / static_cast<double>(frames) : 0.0;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) return Usage();
+
+    std::string recordingPath = argv[1];
+    std::string sdfPath;
+    std::string dumpPath;
+    MatchReplay::Options options;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--realtime") == 0) options.RealTime = true;
+        else if (std::strcmp(argv[i], "--no-predict") == 0) options.Predict = false;
+        else if (std::strcmp(argv[i], "--no-bridge") == 0) options.StreamBridge = false;
+        else if (std::strcmp(argv[i], "--sdf") == 0 && i + 1 < argc) sdfPath = argv[++i];
+        else if (std::strcmp(argv[i], "--dump") == 0 && i + 1 < argc) dumpPath = argv[++i];
+        else return Usage();
+    }
+
+    MatchReplayReader reader;
+    if (!reader.Open(recordingPath)) {
+        std::fprintf(stderr, "%s: %s\n", recordingPath.c_str(), reader.GetError().c_str());
+        return 1;
+    }
+
+    // Same arena setup as the DLL: the baked SDF if given, otherwise bake it in memory.
+    ArenaSDF arena;
+    if (sdfPath.empty() || !arena.LoadFromFile(sdfPath)) {
+        if (!sdfPath.empty()) std::fprintf(stderr, "%s missing or invalid, baking the arena SDF\n", sdfPath.c_str());
+        arena.BuildSoccar();
+    }
+    BallPredictor predictor;
+    predictor.SetArena(&arena);
+
+    std::ofstream dump;
+    if (!dumpPath.empty()) {
+        dump.open(dumpPath, std::ios::binary);
+        if (!dump) {
+            std::fprintf(stderr, "Could not open %s\n", dumpPath.c_str());
+            return 1;
+        }
+    }
+
+    MatchReplay replay(predictor);
+    MatchReplay::Stats stats = replay.Run(reader, options, [&dump](const FrameModel&, const std::string& message) {
+        if (dump.is_open() && !message.empty()) dump << message;
+    });
+
+    std::printf("%llu frames (%.1f Hz recording) in %.3f s: %.0f frames/s\n",
+                static_cast<unsigned long long>(stats.Frames), reader.GetTickRate(), stats.WallSeconds,
+                stats.WallSeconds > 0.0 ? static_cast<double>(stats.Frames) / stats.WallSeconds : 0.0);
+    std::printf("  pads     %8.2f us/frame\n", PerFrameMicroseconds(stats.PadSeconds, stats.Frames));
+    std::printf("  predict  %8.2f us/frame\n", PerFrameMicroseconds(stats.PredictSeconds, stats.Frames));
+    std::printf("  bridge   %8.2f us/frame (%llu messages, %llu bytes)\n", PerFrameMicroseconds(stats.BridgeSeconds, stats.Frames),
+                static_cast<unsigned long long>(stats.BridgeMessages), static_cast<unsigned long long>(stats.BridgeBytes));
+    std::printf("  digest   %016llx\n", static_cast<unsigned long long>(stats.Digest));
+    return 0;
+}
@@ -0,0 +1,70 @@
+"""Load a .vrec match recording (see MatchRecording.h) into numpy arrays.
+
+    from load_recording import load_recording
+    rec = load_recording("match_20240101_120000.vrec")
+    rec["ball_location"]   # (ticks, 3) float32
+    rec["car_location"]    # (ticks, 8, 3) float32
+"""
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = b"VRECORD\0"
+SUPPORTED_SCHEMA = 1
+
+_HEADER = struct.Struct("<8sIIIIIIQQdq64s")
+_COLUMN = struct.Struct("<32s8sII2I")
+
+
+def read_header(path):
+    with open(path, "rb") as f:
+        raw = f.read(_HEADER.size + 32 * _COLUMN.size)
+    (magic, schema, header_size, chunk_ticks, chunk_stride, column_count, max_cars,
+     chunk_count, tick_count, tick_rate, start_us, _) = _HEADER.unpack_from(raw)
+    if magic != MAGIC:
+        raise ValueError(f"{path}: not a match recording")
+    if schema != SUPPORTED_SCHEMA:
+        raise ValueError(f"{path}: schema {schema}, expected {SUPPORTED_SCHEMA}")
+
+    columns = []
+    for i in range(column_count):
+        name, dtype, offset, tick_bytes, s0, s1 = _COLUMN.unpack_from(raw, _HEADER.size + i * _COLUMN.size)
+        shape = tuple(d for d in (s0, s1) if d)
+        columns.append((name.rstrip(b"\0").decode(), dtype.rstrip(b"\0").decode(), offset, shape))
+
+    return {
+        "header_size": header_size, "chunk_ticks": chunk_ticks, "chunk_stride": chunk_stride,
+        "max_cars": max_cars, "chunk_count": chunk_count, "tick_count": tick_count,
+        "tick_rate": tick_rate, "start_unix_us": start_us, "columns": columns,
+    }
+
+
+def load_recording(path):
+    """Returns {column name: array with one row per recorded tick}, memory-mapped where possible."""
+    header = read_header(path)
+    ticks = header["chunk_ticks"]
+    chunk_dtype = np.dtype({
+        "names": ["tick_count"] + [c[0] for c in header["columns"]],
+        "formats": ["<u4"] + [(c[1], (ticks,) + c[3]) for c in header["columns"]],
+        "offsets": [4] + [c[2] for c in header["columns"]],
+        "itemsize": header["chunk_stride"],
+    })
+    chunks = np.memmap(path, dtype=chunk_dtype, mode="r", offset=header["header_size"],
+                       shape=(header["chunk_count"],))
+
+    counts = chunks["tick_count"]
+    result = {}
+    for name, _, _, shape in header["columns"]:
+        flat = chunks[name].reshape((-1,) + shape)
+        if len(counts) and counts[-1] < ticks:
+            flat = flat[: (len(counts) - 1) * ticks + int(counts[-1])]
+        result[name] = flat
+    return result
+
+
+if __name__ == "__main__":
+    info = read_header(sys.argv[1])
+    print(f"{info['tick_count']} ticks in {info['chunk_count']} chunks @ {info['tick_rate']:.1f} Hz")
+    for name, dtype, _, shape in info["columns"]:
+        print(f"  {name:24s} {dtype} {shape}")